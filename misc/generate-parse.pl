@@ -0,0 +1,603 @@
+#!/usr/bin/perl
+
+# Generates src/parse_builtin.c from the stock parse databases, eg:
+#
+#   generate-parse.pl profile/default/parse > src/parse_builtin.c
+#
+# Patterns made only of plain text, '.' wildcards, single character runs
+# (\S+, \d+, \w+, .*, [^/]+, ' +' and so on, captured or not) and the tags
+# which expand to them become C functions doing byte compares, filling in
+# the capture offsets just as PCRE would. Like the compiled regexps they
+# always match the whole line. At runtime they stand in for PCRE whenever a
+# database file is byte for byte the one it was generated from. Anything
+# else (alternations, word list tags, ...) is left to PCRE.
+
+use strict;
+use warnings;
+use Digest::SHA qw(sha256_hex);
+
+die "usage $0 [parse directory]\n" unless @ARGV == 1;
+
+# must agree with tag_list[] in src/parse.c
+my @tags = (
+    [ '{player}',  '(\w+)' ],
+    [ '{monster}', '(.+)'  ],
+    [ '{their}',   '(his|her|its)' ],
+    [ '{source}',  '(.+)'  ],
+    [ '{target}',  '(.+)'  ],
+    [ '{cash}',    '(\d+ (copper|silver|gold|platinum|runic))' ],
+    [ '{#}',       '(\d+)' ],
+    [ '{*}',       '(.*)'  ],
+    map { [ "{$_}", '(\S+)' ] } 1 .. 9,
+);
+
+my $captures_max = 9;  # PARSE_SUBSTR_NUM - 1
+
+my ($dir) = @ARGV;
+my (@dbs, @funcs);
+
+opendir (my $dh, $dir) or die "unable to open $dir: $!\n";
+my @files = sort grep { /\.db/ && -f "$dir/$_" } readdir ($dh);
+closedir ($dh);
+
+foreach my $file (@files)
+{
+    open (my $fh, '<:raw', "$dir/$file") or die "unable to open $file: $!\n";
+    my $contents = do { local $/; <$fh> };
+    close ($fh);
+
+    my @entries;
+
+    foreach my $line (split (/\n/, $contents))
+    {
+        $line =~ s/[\r\n].*//;  # strchomp()
+
+        next if $line eq '' || $line =~ /^[#%\s]/;
+
+        my $pattern = pattern_token ($line);
+        next unless defined $pattern;
+
+        my $func = 'NULL';
+        my $captures = 0;
+        my $spec = pattern_spec ($pattern);
+
+        if ($spec)
+        {
+            $func = sprintf ('parse_builtin_match_%d', scalar (@funcs));
+            $captures = $spec->{captures};
+            push (@funcs, { name => $func, pattern => $pattern, %$spec });
+        }
+
+        push (@entries, { pattern => $pattern, func => $func,
+            captures => $captures });
+    }
+
+    push (@dbs, { file => $file, digest => sha256_hex ($contents),
+        entries => \@entries });
+}
+
+print_header ();
+print_function ($_) foreach @funcs;
+print_tables ();
+
+exit 0;
+
+
+# pattern as read by get_token_as_str()
+sub pattern_token
+{
+    my ($line) = @_;
+
+    return $1 if $line =~ /^"([^"]*)"/;
+    return undef if $line =~ /^"/;  # unterminated
+
+    my ($token) = $line =~ /^([^:=,.]*)/;
+    $token =~ s/\s+$//;
+
+    return $token eq '' ? undef : $token;
+}
+
+# the pattern as compiled, see regexp_tag_substitution()
+sub pattern_expand
+{
+    my ($pattern) = @_;
+
+    foreach my $tag (@tags)
+    {
+        my ($name, $regexp) = @$tag;
+        my $pos;
+
+        while (($pos = index ($pattern, $name)) >= 0)
+        {
+            substr ($pattern, $pos, length ($name), $regexp);
+        }
+    }
+
+    return $pattern;
+}
+
+# character set, as a C test and a table of the bytes it holds
+sub set_new
+{
+    my ($test, $match) = @_;
+
+    return { test => $test, bytes => [ map { $match->($_) ? 1 : 0 } 0 .. 255 ] };
+}
+
+sub set_char
+{
+    my ($ch) = @_;
+
+    return set_new ('%s == ' . c_char ($ch), sub { $_[0] == ord ($ch) });
+}
+
+sub set_not_char
+{
+    my ($ch) = @_;
+
+    return set_new ('%s != ' . c_char ($ch), sub { $_[0] != ord ($ch) });
+}
+
+sub set_class
+{
+    my ($class) = @_;
+    my $space = sub { $_[0] == 32 || ($_[0] >= 9 && $_[0] <= 13) };
+    my $word  = sub { chr ($_[0]) =~ /^[0-9A-Za-z_]$/ };
+
+    return set_new ('!PARSE_BUILTIN_SPACE (%s)', sub { !$space->($_[0]) })
+        if $class eq 'S';
+    return set_new ('PARSE_BUILTIN_SPACE (%s)', $space) if $class eq 's';
+    return set_new ('g_ascii_isdigit (%s)', sub { $_[0] >= 48 && $_[0] <= 57 })
+        if $class eq 'd';
+    return set_new ('PARSE_BUILTIN_WORD (%s)', $word) if $class eq 'w';
+    return undef;
+}
+
+# one atom of a pattern (char, '.', \S etc or [^x]) at $$pos, undef if not
+# understood. ch is set for plain text, wild for '.' wildcards
+sub parse_atom
+{
+    my ($chars, $pos) = @_;
+    my $ch = $chars->[$$pos++];
+
+    return undef unless defined $ch;
+
+    if ($ch eq '\\')
+    {
+        my $next = $chars->[$$pos++];
+
+        return undef unless defined $next;
+
+        if ($next =~ /[0-9A-Za-z]/)
+        {
+            my $set = set_class ($next) or return undef;
+            return { set => $set };
+        }
+
+        return { set => set_char ($next), ch => $next };
+    }
+
+    if ($ch eq '.')
+    {
+        return { set => set_not_char ("\n"), wild => 1 };
+    }
+
+    if ($ch eq '[')
+    {
+        my $class = join ('', @$chars[$$pos .. $#$chars]);
+
+        return undef unless $class =~ /^\^(\\[^0-9A-Za-z]|[^\\\]\^\-])\]/;
+
+        $$pos += length ($&);
+        (my $not = $1) =~ s/^\\//;
+        return { set => set_not_char ($not) };
+    }
+
+    return undef if $ch =~ /[\^\$*+?()\]{}|]/;
+
+    return { set => set_char ($ch), ch => $ch };
+}
+
+# quantifier following an atom at $$pos, as (min, max) with max -1 for no
+# limit. Lazy and possessive forms are not understood
+sub parse_quantifier
+{
+    my ($chars, $pos) = @_;
+    my %quantifiers = ('+' => [1, -1], '*' => [0, -1], '?' => [0, 1]);
+    my $ch = $chars->[$$pos];
+
+    return (1, 1) unless defined $ch && $quantifiers{$ch};
+
+    $$pos++;
+    return () if defined $chars->[$$pos] && $chars->[$$pos] =~ /[?+]/;
+
+    return @{$quantifiers{$ch}};
+}
+
+# match specification for simple patterns, undef otherwise. items is the
+# pattern as fixed length text (bytes, with undef for '.' wildcards) and
+# character runs in between
+sub pattern_spec
+{
+    my ($pattern) = @_;
+    my (@items, $captures);
+
+    $pattern = pattern_expand ($pattern);
+
+    # compiled patterns are anchored at both ends, unless they end with an
+    # escaped '$', which stops the end anchor being added
+    return undef if $pattern =~ /(?<!\\)(\\\\)*\\\$$/;
+
+    $pattern =~ s/^\^//;
+    $pattern =~ s/\$$//;
+
+    my @chars = split (//, $pattern);
+    my $pos = 0;
+    $captures = 0;
+
+    while ($pos < @chars)
+    {
+        my ($atom, $group, @range);
+
+        if ($chars[$pos] eq '(')
+        {
+            $pos++;
+            $atom = parse_atom (\@chars, \$pos) or return undef;
+            @range = parse_quantifier (\@chars, \$pos) or return undef;
+            return undef unless ($chars[$pos++] // '') eq ')';
+            return undef if ($chars[$pos] // '') =~ /[*+?]/;
+
+            $group = ++$captures;
+        }
+        else
+        {
+            $atom = parse_atom (\@chars, \$pos) or return undef;
+            @range = parse_quantifier (\@chars, \$pos) or return undef;
+        }
+
+        # plain text and wildcards on their own make up fixed length text
+        if (!$group && $range[0] == 1 && $range[1] == 1 &&
+            (defined $atom->{ch} || $atom->{wild}))
+        {
+            push (@items, { bytes => [] }) unless @items && $items[-1]{bytes};
+            push (@{$items[-1]{bytes}}, $atom->{ch});
+            next;
+        }
+
+        push (@items, { set => $atom->{set}, min => $range[0],
+            max => $range[1], group => $group });
+    }
+
+    return undef if $captures > $captures_max;
+    return undef unless grep { $_->{bytes} && grep { defined } @{$_->{bytes}} }
+        @items;
+
+    return { items => \@items, captures => $captures };
+}
+
+# bytes which can start the match of items from index $i on
+sub first_set
+{
+    my ($items, $i) = @_;
+    my @bytes = (0) x 256;
+
+    for (; $i < @$items; $i++)
+    {
+        my $item = $items->[$i];
+
+        if ($item->{bytes})
+        {
+            my $ch = $item->{bytes}[0];
+            my $set = defined $ch ? set_char ($ch) : set_not_char ("\n");
+
+            $bytes[$_] ||= $set->{bytes}[$_] foreach 0 .. 255;
+            last;
+        }
+
+        $bytes[$_] ||= $item->{set}{bytes}[$_] foreach 0 .. 255;
+        last if $item->{min};
+    }
+
+    return \@bytes;
+}
+
+sub disjoint
+{
+    my ($a, $b) = @_;
+
+    return !grep { $a->[$_] && $b->[$_] } 0 .. 255;
+}
+
+# minimum length of items from index $i on
+sub min_length
+{
+    my ($items, $i) = @_;
+    my $length = 0;
+
+    foreach my $item (@$items[$i .. $#$items])
+    {
+        $length += $item->{bytes} ? scalar (@{$item->{bytes}}) : $item->{min};
+    }
+
+    return $length;
+}
+
+# C string literal for a run of bytes
+sub c_string
+{
+    my $str = '';
+
+    foreach my $ch (@_)
+    {
+        if ($ch eq '"' || $ch eq '\\') { $str .= "\\$ch"; }
+        elsif ($ch =~ /[ -~]/)         { $str .= $ch; }
+        else                           { $str .= sprintf ('\\%03o', ord ($ch)); }
+    }
+
+    return "\"$str\"";
+}
+
+sub c_comment
+{
+    my ($str) = @_;
+
+    $str =~ s{\*/}{*\\/}g;
+    return $str;
+}
+
+sub print_header
+{
+    print <<'EOF';
+/*  MudPRO: An advanced client for the online game MajorMUD
+ *  Copyright (C) 2002-2018  David Slusky
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+/* GENERATED by misc/generate-parse.pl from profile/default/parse, any
+ * changes made here will be lost */
+
+#include <string.h>
+
+#include "parse_builtin.h"
+
+/* \s and \w as PCRE sees them, without locale or Unicode support */
+#define PARSE_BUILTIN_SPACE(ch) ((ch) == ' ' || ((ch) >= '\t' && (ch) <= '\r'))
+#define PARSE_BUILTIN_WORD(ch) (g_ascii_isalnum (ch) || (ch) == '_')
+
+EOF
+}
+
+# code comparing fixed length text at p, then stepping over it
+sub block_code
+{
+    my ($bytes) = @_;
+    my $length = scalar (@$bytes);
+    my (@compares, $run);
+
+    for (my $i = 0; $i <= @$bytes; $i++)
+    {
+        if ($i < @$bytes && defined $bytes->[$i])
+        {
+            $run = { offset => $i, bytes => [] } unless $run;
+            push (@{$run->{bytes}}, $bytes->[$i]);
+            next;
+        }
+
+        if ($run)
+        {
+            my @b = @{$run->{bytes}};
+
+            push (@compares, @b == 1 ?
+                sprintf ("p[%d] == %s", $run->{offset}, c_char ($b[0])) :
+                sprintf ("!memcmp (p%s, %s, %d)",
+                    $run->{offset} ? " + $run->{offset}" : '',
+                    c_string (@b), scalar (@b)));
+            $run = undef;
+        }
+
+        push (@compares, "p[$i] != '\\n'") if $i < @$bytes;
+    }
+
+    my $test = @compares == 1 ? c_not ($compares[0]) :
+        "!(" . join ("\n\t\t\t&& ", @compares) . ")";
+
+    return "\tif (end - p < $length\n\t\t|| $test)\n\t\treturn FALSE;\n\n" .
+        "\tp += $length;\n\n";
+}
+
+# code recording where a run's capture starts or ends
+sub capture_code
+{
+    my ($run, $side, $offset, $indent) = @_;
+
+    return '' unless $run->{group};
+
+    return sprintf ("%sovector[%d] = %s - subject;\n", $indent // "\t",
+        $run->{group} * 2 + $side, $offset);
+}
+
+# code matching items from index $i on at p, which must finish at end. A
+# run the rest can't be matched after without backtracking gets the rest
+# in a function of its own, pushed to @$funcs, tried from its longest
+# match down as PCRE would
+sub sequence_code
+{
+    my ($f, $items, $i, $funcs, $vars) = @_;
+    my $code = '';
+
+    for (; $i < @$items; $i++)
+    {
+        my $item = $items->[$i];
+
+        if ($item->{bytes})
+        {
+            $code .= block_code ($item->{bytes});
+            next;
+        }
+
+        my $test = $item->{set}{test};
+        my $max = $item->{max} < 0 ? '' : " && n < $item->{max}";
+
+        $vars->{n} = 1;
+
+        if (!grep { $_->{set} } @$items[$i + 1 .. $#$items])
+        {
+            # last run, everything after it is fixed length
+            my $rest = min_length ($items, $i + 1);
+            my $min = $rest + $item->{min};
+
+            $vars->{q} = 1;
+            $code .= "\tif (end - p < $min)\n\t\treturn FALSE;\n\n" if $min;
+            $code .= "\tn = end - p" . ($rest ? " - $rest" : '') . ";\n";
+            $code .= "\tif (n > $item->{max})\n\t\treturn FALSE;\n"
+                if $item->{max} >= 0;
+            $code .= "\n\tfor (q = p; q < p + n; q++)\n\t{\n" .
+                "\t\tif (" . c_not (sprintf ($test, '*q')) . ")\n" .
+                "\t\t\treturn FALSE;\n\t}\n\n";
+            $code .= capture_code ($item, 0, 'p') .
+                capture_code ($item, 1, 'p + n');
+            $code .= "\tp += n;\n\n";
+            next;
+        }
+
+        $code .= "\tfor (n = 0; p + n < end && " . sprintf ($test, 'p[n]') .
+            "$max; n++)\n\t\t;\n\n";
+        $code .= "\tif (n < $item->{min})\n\t\treturn FALSE;\n\n" if $item->{min};
+
+        if (disjoint ($item->{set}{bytes}, first_set ($items, $i + 1)))
+        {
+            # what follows can't start with anything the run took
+            $code .= capture_code ($item, 0, 'p') .
+                capture_code ($item, 1, 'p + n');
+            $code .= "\tp += n;\n\n";
+            next;
+        }
+
+        my %rest_vars;
+        my $rest_code = sequence_code ($f, $items, $i + 1, $funcs, \%rest_vars);
+        my $rest = sprintf ('%s_%d', $f->{name}, scalar (@$funcs) + 1);
+
+        push (@$funcs, { name => $rest, code => $rest_code,
+            vars => \%rest_vars });
+
+        $code .= capture_code ($item, 0, 'p');
+        $code .= "\n" if $item->{group};
+        $code .= "\tfor (;; n--)\n\t{\n";
+        $code .= capture_code ($item, 1, 'p + n', "\t\t");
+        $code .= "\n" if $item->{group};
+        $code .= "\t\tif ($rest (subject, p + n, end, ovector))\n" .
+            "\t\t\treturn TRUE;\n\n" .
+            "\t\tif (n == $item->{min})\n\t\t\treturn FALSE;\n\t}\n";
+
+        return $code;
+    }
+
+    return $code . "\treturn p == end;\n";
+}
+
+sub vars_code
+{
+    my ($vars) = @_;
+    my $code = '';
+
+    $code .= "\tconst gchar *q;\n" if $vars->{q};
+    $code .= "\tgsize n;\n" if $vars->{n};
+
+    return $code;
+}
+
+sub print_function
+{
+    my ($f) = @_;
+    my $items = $f->{items};
+    my $min = min_length ($items, 0);
+    my (@funcs, %vars);
+
+    my $code = sequence_code ($f, $items, 0, \@funcs, \%vars);
+
+    print "/* " . c_comment ($f->{pattern}) . " */\n\n";
+
+    foreach my $rest (@funcs)
+    {
+        print "static gboolean $rest->{name} (const gchar *subject, const gchar *p,\n";
+        print "\tconst gchar *end, PCRE2_SIZE *ovector)\n{\n";
+        print vars_code ($rest->{vars}), "\n" if %{$rest->{vars}};
+        print $rest->{code}, "}\n\n";
+    }
+
+    print "static gboolean $f->{name} (const gchar *subject, gsize length,\n";
+    print "\tPCRE2_SIZE *ovector)\n{\n";
+    print "\tconst gchar *p = subject, *end = subject + length;\n";
+    print vars_code (\%vars), "\n";
+
+    if (grep { $_->{set} } @$items)
+    {
+        print "\tif (length < $min)\n\t\treturn FALSE;\n\n";
+    }
+    else
+    {
+        print "\tif (length != $min)\n\t\treturn FALSE;\n\n";
+    }
+
+    print "\tovector[0] = 0;\n\tovector[1] = length;\n\n";
+    print $code, "}\n\n\n";
+}
+
+# C test negated, for the tests made here
+sub c_not
+{
+    my ($test) = @_;
+
+    return $test =~ s/ == / != /r if $test =~ / == /;
+    return $test =~ s/ != / == /r if $test =~ / != /;
+    return $test =~ s/^!//r if $test =~ /^!/;
+    return "!$test";
+}
+
+sub c_char
+{
+    my ($ch) = @_;
+
+    return "'\\''" if $ch eq "'";
+    return "'\\\\'" if $ch eq '\\';
+    return "'\\n'" if $ch eq "\n";
+    return "'$ch'" if $ch =~ /[ -~]/;
+    return sprintf ("'\\%03o'", ord ($ch));
+}
+
+sub print_tables
+{
+    foreach my $i (0 .. $#dbs)
+    {
+        my $db = $dbs[$i];
+
+        print "static const parse_builtin_regexp_t parse_builtin_db_$i\[] = {\n";
+        foreach my $e (@{$db->{entries}})
+        {
+            printf("\t{ %s,\n\t\t%s, %d },\n",
+                c_string (split (//, $e->{pattern})), $e->{func}, $e->{captures});
+        }
+        print "\t{ NULL, NULL, 0 }\n};\n\n";
+    }
+
+    print "const parse_builtin_db_t parse_builtin_dbs[] = {\n";
+    foreach my $i (0 .. $#dbs)
+    {
+        printf("\t{ \"%s\",\n\t\t\"%s\",\n\t\tparse_builtin_db_%d },\n",
+            $dbs[$i]{file}, $dbs[$i]{digest}, $i);
+    }
+    print "\t{ NULL, NULL, NULL }\n};\n";
+}
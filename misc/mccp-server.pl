@@ -0,0 +1,161 @@
+#!/usr/bin/perl
+
+# Stand-in telnet server speaking MCCP v2, for trying out the client's
+# compression support without a MajorMUD server that has it, eg:
+#
+#   mccp-server.pl 2323 &
+#   mudpro -h localhost -p 2323 -c
+#
+# Compression is offered to each connection with IAC WILL COMPRESS2. Lines
+# sent by the client are echoed back, along with a few commands:
+#
+#   bulk [lines]   send a burst of text, to exercise large inflates
+#   end            end the compressed stream, continue uncompressed
+#   start          offer compression again
+#   quit           close the connection
+
+use strict;
+use warnings;
+use IO::Socket::INET;
+use Compress::Zlib;
+
+use constant {
+    IAC  => 255, DONT => 254, DO => 253, WONT => 252, WILL => 251,
+    SB   => 250, SE   => 240,
+    ECHO => 1,   SGA  => 3,   COMPRESS2 => 86,
+};
+
+die "usage $0 [port]\n" unless @ARGV <= 1;
+
+my $port = $ARGV[0] || 2323;
+my $server = IO::Socket::INET->new (LocalPort => $port, Listen => 1,
+    ReuseAddr => 1) or die "unable to listen on $port: $!\n";
+
+print "listening on port $port\n";
+
+while (my $client = $server->accept ())
+{
+    print "connection from " . $client->peerhost () . "\n";
+    session ($client);
+    close ($client);
+    print "connection closed\n";
+}
+
+exit 0;
+
+
+sub session
+{
+    my ($client) = @_;
+    my ($deflate, $line, $data) = (undef, '');
+
+    binmode ($client);
+    $client->autoflush (1);
+
+    # sends text, through the compressor once one is running
+    my $send = sub {
+        my ($text) = @_;
+
+        if ($deflate)
+        {
+            my ($out, $status) = $deflate->deflate ($text);
+            my ($flush) = $deflate->flush (Z_SYNC_FLUSH);
+            $text = $out . $flush;
+        }
+        syswrite ($client, $text);
+    };
+
+    syswrite ($client, pack ('C*', IAC, WILL, ECHO, IAC, WILL, SGA,
+        IAC, WILL, COMPRESS2));
+
+    $send->("MCCP stand-in server\r\n\r\n[HP=100/MA=50]:");
+
+    while (sysread ($client, $data, 4096))
+    {
+        my @bytes = unpack ('C*', $data);
+
+        while (@bytes)
+        {
+            my $c = shift (@bytes);
+
+            if ($c == IAC)
+            {
+                my ($cmd, $opt) = splice (@bytes, 0, 2);
+                next unless defined $opt;
+
+                if ($cmd == DO && $opt == COMPRESS2 && !$deflate)
+                {
+                    # everything after IAC SE is compressed
+                    syswrite ($client, pack ('C*', IAC, SB, COMPRESS2, IAC, SE));
+                    $deflate = deflateInit () or die "deflateInit failed\n";
+                    print "compression started\n";
+                }
+                elsif ($cmd == WILL)
+                {
+                    syswrite ($client, pack ('C*', IAC, DONT, $opt));
+                }
+                next;
+            }
+
+            if ($c == 10 || $c == 13)
+            {
+                next if $line eq '' && $c == 10;
+
+                return unless command ($client, \$deflate, $send, $line);
+                $line = '';
+                next;
+            }
+
+            if ($c == 8 || $c == 127)
+            {
+                chop ($line);
+                next;
+            }
+
+            $line .= chr ($c);
+        }
+    }
+}
+
+sub command
+{
+    my ($client, $deflate, $send, $line) = @_;
+
+    if ($line =~ /^bulk\s*(\d*)/)
+    {
+        my $count = $1 || 1000;
+
+        foreach my $i (1 .. $count)
+        {
+            $send->("\r\nLine $i of $count, The quick brown fox jumps over " .
+                "the lazy dog.");
+        }
+    }
+    elsif ($line eq 'end')
+    {
+        if ($$deflate)
+        {
+            # Z_STREAM_END, what follows is plain text again
+            my ($out) = $$deflate->flush (Z_FINISH);
+            syswrite ($client, $out);
+            undef $$deflate;
+            print "compression ended\n";
+        }
+    }
+    elsif ($line eq 'start')
+    {
+        syswrite ($client, pack ('C*', IAC, WILL, COMPRESS2));
+    }
+    elsif ($line eq 'quit')
+    {
+        return 0;
+    }
+    else
+    {
+        $send->("\r\nYou said: $line");
+    }
+
+    $send->("\r\n[HP=100/MA=50]:");
+
+    return 1;
+}
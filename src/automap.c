@@ -20,7 +20,10 @@
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
+#include <fcntl.h>
 #include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include "automap.h"
 #include "client_ai.h"
@@ -42,6 +45,96 @@
 
 automap_t automap;
 
+typedef struct /* secondary index key, fields unused by an index are ignored */
+{
+	GQuark name;
+	gulong exits;
+	glong x, y, z;
+} automap_index_key_t;
+
+typedef struct /* rooms sharing a secondary index key */
+{
+	automap_index_key_t key;
+	GSList *records;
+} automap_index_bucket_t;
+
+typedef struct /* fixed size chunks carved out of larger blocks */
+{
+	GSList *blocks;  /* blocks allocated so far, newest first */
+	gpointer free;   /* released chunks, linked through their first word */
+	gsize size;      /* chunk size */
+	guint per_block; /* chunks per block */
+	guint used;      /* chunks handed out from the newest block */
+	gulong chunks;   /* chunks currently in use */
+} automap_arena_t;
+
+#define AUTOMAP_ARENA_BLOCK 256 /* chunks per arena block */
+
+static automap_arena_t record_arena = { NULL, NULL,
+	sizeof (automap_record_t), AUTOMAP_ARENA_BLOCK, 0, 0 };
+
+static automap_arena_t exit_arena = { NULL, NULL,
+	sizeof (exit_info_t), AUTOMAP_ARENA_BLOCK, 0, 0 };
+
+#define AUTOMAP_CACHE_MAGIC   "MPAUTOMP" /* 8 bytes, no terminator */
+#define AUTOMAP_CACHE_VERSION 4
+#define AUTOMAP_CACHE_ORDER   0x01020304 /* reads differently if swapped */
+
+typedef struct /* automap.bin header, followed by rooms, exits, strings */
+{
+	gchar magic[8];
+	guint32 version;
+	guint32 byte_order;
+	guint32 rooms;      /* number of room records */
+	guint32 exits;      /* number of exit records */
+	guint32 strings;    /* size of the string table */
+	guint32 db_mtime_nsec; /* automap.db as it was when this was written, */
+	gint64 db_mtime;       /* which it must still match to be used */
+	guint64 db_size;
+} automap_cache_header_t;
+
+typedef struct /* automap.bin room record */
+{
+	guint32 id;         /* string table offset of the text ID */
+	guint32 name;       /* string table offset */
+	guint32 exits;
+	guint32 flags;
+	guint32 first_exit; /* index of the room's first exit record */
+	guint32 exit_count;
+	gint64 x, y, z;
+	gint64 session;
+} automap_cache_room_t;
+
+typedef struct /* automap.bin exit record */
+{
+	guint32 id;         /* string table offset of the text ID, 0 if unknown */
+	guint32 str;        /* string table offset, 0 for none */
+	guint32 required;   /* string table offset, 0 for none */
+	guint32 direction;
+	guint32 flags;
+} automap_cache_exit_t;
+
+typedef struct /* automap.bin contents as they are built up for writing */
+{
+	GArray *rooms;
+	GArray *exits;
+	GString *strings;
+	GHashTable *offsets; /* string table offsets, by string */
+} automap_cache_writer_t;
+
+static struct /* automap.bin while mapped, room names point into it */
+{
+	gchar *filename;
+	gpointer data;
+	gsize size;
+} automap_cache;
+
+static struct /* room IDs as written in automap.db, see automap_id_intern() */
+{
+	GHashTable *by_str; /* IDs by text */
+	GPtrArray *str;     /* text by ID, slot 0 being the unknown room */
+} automap_ids;
+
 static key_value_t exit_type[]=
 {
 	{ "secret passage ",    EXIT_SECRET },
@@ -85,15 +178,43 @@ exit_table_t exit_table[]=
 static void automap_report_exit_list (FILE *fp);
 static void automap_parse_exit_info (automap_record_t *record, gchar *str);
 static void automap_record_save (gpointer key, gpointer value, gpointer user_data);
+static gboolean automap_db_load_record (automap_record_t *record);
+static gboolean automap_cache_load (void);
+static gboolean automap_cache_verify (gpointer data, gsize size);
+static void automap_cache_save (struct stat *st_db);
+static void automap_cache_save_record (gpointer key, gpointer value, gpointer user_data);
+static guint32 automap_cache_string (automap_cache_writer_t *writer, const gchar *str);
+static void automap_cache_unmap (void);
 static void automap_record_deallocate (gpointer key, gpointer value, gpointer user_data);
 static void automap_movement_list_free (void);
 static automap_record_t *automap_find_location (void);
-static void automap_location_search (gpointer key, gpointer value, gpointer user_data);
-static void automap_duplicate_search (gpointer key, gpointer value, gpointer user_data);
-static void automap_location_dereference (gpointer key, gpointer value, gpointer user_data);
+static automap_record_t *automap_find_xyz_match (glong x, glong y, glong z, automap_record_t *exclude);
+static gpointer automap_arena_alloc (automap_arena_t *arena);
+static void automap_arena_release (automap_arena_t *arena, gpointer chunk);
+static void automap_arena_clear (automap_arena_t *arena);
+static void automap_index_new (void);
+static void automap_index_free (void);
+static void automap_index_insert (automap_record_t *record);
+static gboolean automap_index_remove (automap_record_t *record);
+static GSList *automap_index_lookup (GHashTable *index, automap_index_key_t *key);
+static void automap_index_add (GHashTable *index, automap_index_key_t *key, automap_record_t *record);
+static gboolean automap_index_del (GHashTable *index, automap_index_key_t *key, automap_record_t *record);
+static void automap_index_key (automap_index_key_t *key, automap_record_t *record);
+static void automap_index_bucket_free (gpointer data);
+static guint automap_index_name_hash (gconstpointer key);
+static gboolean automap_index_name_equal (gconstpointer a, gconstpointer b);
+static guint automap_index_xyz_hash (gconstpointer key);
+static gboolean automap_index_xyz_equal (gconstpointer a, gconstpointer b);
+static void automap_exit_attach (automap_record_t *record, exit_info_t *exit_info);
+static void automap_edge_add (exit_info_t *exit_info);
+static void automap_edge_del (exit_info_t *exit_info);
+static void automap_edge_set (exit_info_t *exit_info, guint32 id);
+static GSList *automap_edge_steal (guint32 id);
+static void automap_edge_list_free (gpointer key, gpointer value, gpointer user_data);
+static void automap_location_dereference (guint32 id);
 static automap_record_t *automap_location_get_next (automap_record_t *record, exit_table_t *et);
-static gchar *automap_get_exit_id (automap_record_t *location, gint direction);
-static void automap_set_exit_id (automap_record_t *location, gchar *id, gint direction, gchar *exit_str);
+static guint32 automap_get_exit_id (automap_record_t *location, gint direction);
+static void automap_set_exit_id (automap_record_t *location, guint32 id, gint direction, gchar *exit_str);
 static void automap_join_locations (automap_record_t *first, automap_record_t *second, exit_table_t *et);
 static void automap_update_location (void);
 static gint automap_get_exit_type (gchar *str, gchar **offset);
@@ -120,9 +241,17 @@ void automap_init (void)
 	automap.room_name = g_string_new ("");
 	automap_reset (TRUE /* full reset */);
 
+	/* kept until cleanup, so IDs held elsewhere survive reloads */
+	automap_ids.by_str = g_hash_table_new (g_str_hash, g_str_equal);
+	automap_ids.str = g_ptr_array_new ();
+	g_ptr_array_add (automap_ids.str, g_strdup ("0"));
+
 	mudpro_db.automap.filename = g_strdup_printf (
 		"%s%cautomap.db", character.data_path, G_DIR_SEPARATOR);
 
+	automap_cache.filename = g_strdup_printf (
+		"%s%cautomap.bin", character.data_path, G_DIR_SEPARATOR);
+
 	automap_db_load (); /* must come after automap.lost has been (un)set */
 }
 
@@ -140,8 +269,13 @@ void automap_cleanup (void)
 	automap_movement_list_free ();
 
 	g_free (mudpro_db.automap.filename);
+	g_free (automap_cache.filename);
 	g_string_free (automap.room_name, TRUE);
 
+	g_hash_table_destroy (automap_ids.by_str);
+	g_ptr_array_foreach (automap_ids.str, (GFunc) g_free, NULL);
+	g_ptr_array_free (automap_ids.str, TRUE);
+
 	g_string_free (automap.key, TRUE);
 	g_string_free (automap.user_input, TRUE);
 }
@@ -181,7 +315,8 @@ void automap_report (FILE *fp)
 		}
 
 		fprintf (fp, "\n  Automap Location: %s (%s)\n\n",
-			automap.location->id, record ? record->name : "N/A");
+			automap_id_to_str (automap.location->id),
+			record ? record->name : "N/A");
 
 		fprintf (fp, "    Last Visited .. %s\n", buf ? buf : "N/A");
 		fprintf (fp, "    Coordinates ... (X: %ld) (Y: %ld) (Z: %ld)\n",
@@ -204,6 +339,27 @@ void automap_report (FILE *fp)
 	fprintf (fp, "  Room Database Size ...... %d\n",
 		g_hash_table_size (automap.db));
 
+	fprintf (fp, "  Room Name/Exit Keys ..... %d\n",
+		g_hash_table_size (automap.db_by_name));
+
+	fprintf (fp, "  Room Position Keys ...... %d\n",
+		g_hash_table_size (automap.db_by_xyz));
+
+	fprintf (fp, "  Rooms With Entrances .... %d\n",
+		g_hash_table_size (automap.db_incoming));
+
+	fprintf (fp, "  Room Arena .............. %lu/%u chunks (%u blocks)\n",
+		record_arena.chunks, g_slist_length (record_arena.blocks) *
+		record_arena.per_block, g_slist_length (record_arena.blocks));
+
+	fprintf (fp, "  Exit Arena .............. %lu/%u chunks (%u blocks)\n",
+		exit_arena.chunks, g_slist_length (exit_arena.blocks) *
+		exit_arena.per_block, g_slist_length (exit_arena.blocks));
+
+	fprintf (fp, "  Room Cache .............. %s (%lu bytes mapped)\n",
+		automap_cache.data ? "Loaded" : "Not loaded",
+		(gulong) automap_cache.size);
+
 	fprintf (fp, "  Movement Queue Size ..... %d\n",
 		g_slist_length (automap.movement));
 
@@ -283,25 +439,22 @@ void automap_report (FILE *fp)
 
 static void automap_report_exit_list (FILE *fp)
 {
-	GSList *node;
 	automap_record_t *record;
 	exit_info_t *exit_info;
-	gint count = 1;
+	gint count = 1, i = 0;
 
 	g_assert (automap.location != NULL);
 
 	fprintf (fp, "    Exit List:\n\n");
 
-	if (!automap.location->exit_list)
+	if (!automap_exit_next (automap.location, &i))
 	{
 		fprintf (fp, "      None\n\n");
 		return;
 	}
 
-	for (node = automap.location->exit_list; node; node = node->next)
+	for (i = 0; (exit_info = automap_exit_next (automap.location, &i)); )
 	{
-		exit_info = node->data;
-
 		if ((record = automap_db_lookup (exit_info->id)) != NULL)
 		{
 			gchar *buf = NULL;
@@ -313,7 +466,7 @@ static void automap_report_exit_list (FILE *fp)
 			}
 
 			fprintf (fp, "      [%2d] ID: %s (%s)\n", count++,
-				record->id, record->name);
+				automap_id_to_str (record->id), record->name);
 			fprintf (fp, "           Last Visited: %s\n", buf ? buf : "N/A");
 			fprintf (fp, "           Coordinates: (X: %ld) (Y: %ld) (Z: %ld)\n",
 				record->x, record->y, record->z);
@@ -321,7 +474,8 @@ static void automap_report_exit_list (FILE *fp)
 			g_free (buf);
 		}
 		else
-			fprintf (fp, "      [%2d] ID: %s\n", count++, exit_info->id);
+			fprintf (fp, "      [%2d] ID: %s\n", count++,
+				automap_id_to_str (exit_info->id));
 
 		if (exit_info->str && exit_info->str[0] != '\0')
 			fprintf (fp, "           String: '%s'\n", exit_info->str);
@@ -399,16 +553,26 @@ void automap_disable (void)
 
 void automap_db_load (void)
 {
-	gchar buf[STD_STRBUF], *offset;
+	gchar buf[STD_STRBUF], *offset, *id;
 	automap_record_t *record = NULL;
+	struct stat st_db;
+	gboolean cache;
 	FILE *fp;
 
 	if (automap.db != NULL)
 		automap_db_free ();
 
-	automap.db = g_hash_table_new (g_str_hash, g_str_equal);
+	automap.db = g_hash_table_new (g_direct_hash, g_direct_equal);
+	automap_index_new ();
 	g_get_current_time (&mudpro_db.automap.access);
 
+	if (automap_cache_load ())
+	{
+		if (g_hash_table_size (automap.db) == 0)
+			automap_enable (); /* no rooms defined, start mapping ASAP */
+		return;
+	}
+
 	if ((fp = fopen (mudpro_db.automap.filename, "r")) == NULL)
 	{
 		/* no db, start mapping ASAP */
@@ -416,6 +580,9 @@ void automap_db_load (void)
 		return;
 	}
 
+	/* before reading, so the cache never claims edits it hasn't seen */
+	cache = !fstat (fileno (fp), &st_db);
+
 	g_hash_table_freeze (automap.db);
 
 	while (fgets (buf, sizeof (buf), fp))
@@ -435,10 +602,11 @@ void automap_db_load (void)
 			continue;
 		}
 
-		record = g_malloc0 (sizeof (automap_record_t));
+		record = automap_arena_alloc (&record_arena);
 
 		offset = buf;
-		record->id      = get_token_as_str (&offset);
+		id = get_token_as_str (&offset);
+		record->id      = automap_id_intern (id);
 		record->name    = get_token_as_str (&offset);
 		record->exits   = get_token_as_long (&offset);
 		record->flags   = get_token_as_long (&offset);
@@ -447,12 +615,17 @@ void automap_db_load (void)
 		record->z       = get_token_as_long (&offset);
 		record->session = get_token_as_long (&offset);
 
-		automap.session = MAX (automap.session, record->session);
-
-		if (record->flags & ROOM_FLAG_REGEN)
-			record->regen = REGEN_RECHARGE;
+		if (!automap_db_load_record (record))
+		{
+			printt ("Ignoring room '%s' in automap.db, its ID '%s' is %s",
+				record->name ? record->name : "", id ? id : "",
+				record->id ? "already in use" : "invalid");
 
-		g_hash_table_insert (automap.db, record->id, record);
+			g_free (record->name);
+			automap_arena_release (&record_arena, record);
+			record = NULL; /* along with its exits */
+		}
+		g_free (id);
 	}
 
 	g_hash_table_thaw (automap.db);
@@ -461,6 +634,339 @@ void automap_db_load (void)
 		automap_enable (); /* no rooms defined, start mapping ASAP */
 
 	fclose (fp);
+
+	if (cache)
+		automap_cache_save (&st_db); /* so the next load can skip parsing */
+}
+
+
+/* =========================================================================
+ = AUTOMAP_DB_LOAD_RECORD
+ =
+ = Adds a room read from file to the database and its indexes. Returns
+ = FALSE, leaving the record to the caller, if its ID is missing or taken
+ ======================================================================== */
+
+static gboolean automap_db_load_record (automap_record_t *record)
+{
+	if (record->id == 0 || automap_db_lookup (record->id) != NULL)
+		return FALSE;
+
+	automap.session = MAX (automap.session, record->session);
+
+	if (record->flags & ROOM_FLAG_REGEN)
+		record->regen = REGEN_RECHARGE;
+
+	g_hash_table_insert (automap.db, GUINT_TO_POINTER (record->id), record);
+	automap_index_insert (record);
+
+	return TRUE;
+}
+
+
+/* =========================================================================
+ = AUTOMAP_CACHE_LOAD
+ =
+ = Load the database from automap.bin, provided it was made from automap.db
+ = as it is now (same size and modification time, to the nanosecond). Room
+ = names are used in place within the mapped file
+ ======================================================================== */
+
+static gboolean automap_cache_load (void)
+{
+	automap_cache_header_t *header;
+	automap_cache_room_t *room;
+	automap_cache_exit_t *exits;
+	struct stat st_db, st_cache;
+	const gchar *strings;
+	gpointer data;
+	guint32 i, j;
+	int fd;
+
+	if (stat (mudpro_db.automap.filename, &st_db) ||
+		stat (automap_cache.filename, &st_cache))
+		return FALSE; /* automap.db has the final say */
+
+	if ((fd = open (automap_cache.filename, O_RDONLY)) == -1)
+		return FALSE;
+
+	data = mmap (NULL, st_cache.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close (fd);
+
+	if (data == MAP_FAILED)
+		return FALSE;
+
+	if (!automap_cache_verify (data, st_cache.st_size))
+	{
+		printt ("Automap cache is invalid, reading automap.db");
+		munmap (data, st_cache.st_size);
+		return FALSE;
+	}
+
+	header = data;
+
+	/* any change to automap.db at all, even one that turns the clock back
+	 * (a restored or regenerated copy), means it has to be read again */
+	if (header->db_size != (guint64) st_db.st_size ||
+		header->db_mtime != (gint64) st_db.st_mtim.tv_sec ||
+		header->db_mtime_nsec != (guint32) st_db.st_mtim.tv_nsec)
+	{
+		munmap (data, st_cache.st_size);
+		return FALSE;
+	}
+
+	automap_cache.data = data;
+	automap_cache.size = st_cache.st_size;
+
+	room    = (automap_cache_room_t *) (header + 1);
+	exits   = (automap_cache_exit_t *) (room + header->rooms);
+	strings = (const gchar *) (exits + header->exits);
+
+	for (i = 0; i < header->rooms; i++, room++)
+	{
+		automap_record_t *record = automap_arena_alloc (&record_arena);
+
+		record->id      = automap_id_intern (strings + room->id);
+		record->name    = (gchar *) strings + room->name;
+		record->exits   = room->exits;
+		record->flags   = room->flags;
+		record->x       = room->x;
+		record->y       = room->y;
+		record->z       = room->z;
+		record->session = room->session;
+
+		if (!automap_db_load_record (record))
+		{
+			automap_arena_release (&record_arena, record);
+			continue; /* written from the database, so never expected */
+		}
+
+		for (j = 0; j < room->exit_count; j++)
+		{
+			automap_cache_exit_t *ce = &exits[room->first_exit + j];
+			exit_info_t *exit_info = automap_arena_alloc (&exit_arena);
+
+			exit_info->id        = automap_id_intern (strings + ce->id);
+			exit_info->str       = ce->str ? g_strdup (strings + ce->str) : NULL;
+			exit_info->required  = ce->required ?
+				g_strdup (strings + ce->required) : NULL;
+			exit_info->direction = ce->direction;
+			exit_info->flags     = ce->flags;
+
+			automap_exit_attach (record, exit_info);
+			automap_edge_add (exit_info);
+		}
+	}
+
+	return TRUE;
+}
+
+
+/* =========================================================================
+ = AUTOMAP_CACHE_VERIFY
+ =
+ = Check that a mapped automap.bin is complete and every offset within it
+ = is in range
+ ======================================================================== */
+
+static gboolean automap_cache_verify (gpointer data, gsize size)
+{
+	automap_cache_header_t *header = data;
+	automap_cache_room_t *room;
+	automap_cache_exit_t *exits;
+	const gchar *strings;
+	guint32 i;
+
+	if (size < sizeof (automap_cache_header_t) ||
+		memcmp (header->magic, AUTOMAP_CACHE_MAGIC, sizeof (header->magic)) ||
+		header->version != AUTOMAP_CACHE_VERSION ||
+		header->byte_order != AUTOMAP_CACHE_ORDER)
+		return FALSE;
+
+	if (size != sizeof (automap_cache_header_t) +
+		(guint64) header->rooms * sizeof (automap_cache_room_t) +
+		(guint64) header->exits * sizeof (automap_cache_exit_t) +
+		header->strings)
+		return FALSE;
+
+	room    = (automap_cache_room_t *) (header + 1);
+	exits   = (automap_cache_exit_t *) (room + header->rooms);
+	strings = (const gchar *) (exits + header->exits);
+
+	/* offset 0 is the empty string, and the table ends in a terminator */
+	if (header->strings == 0 || strings[header->strings - 1] != '\0')
+		return FALSE;
+
+	for (i = 0; i < header->rooms; i++)
+	{
+		if (room[i].id == 0 || room[i].id >= header->strings ||
+			room[i].name >= header->strings ||
+			(guint64) room[i].first_exit + room[i].exit_count > header->exits)
+			return FALSE;
+	}
+
+	for (i = 0; i < header->exits; i++)
+	{
+		if (exits[i].id >= header->strings ||
+			exits[i].str >= header->strings ||
+			exits[i].required >= header->strings)
+			return FALSE;
+	}
+
+	return TRUE;
+}
+
+
+/* =========================================================================
+ = AUTOMAP_CACHE_SAVE
+ =
+ = Write the database out to automap.bin, replacing it in one step so a
+ = mapping of the previous file stays valid. st_db describes the automap.db
+ = the database was read from or just written to
+ ======================================================================== */
+
+static void automap_cache_save (struct stat *st_db)
+{
+	automap_cache_writer_t writer;
+	automap_cache_header_t header;
+	gchar *filename;
+	gboolean ok;
+	FILE *fp;
+
+	writer.rooms   = g_array_new (FALSE, FALSE, sizeof (automap_cache_room_t));
+	writer.exits   = g_array_new (FALSE, FALSE, sizeof (automap_cache_exit_t));
+	writer.strings = g_string_new (NULL);
+	writer.offsets = g_hash_table_new (g_str_hash, g_str_equal);
+
+	g_string_append_len (writer.strings, "", 1); /* offset 0 */
+
+	if (automap.db)
+		g_hash_table_foreach (automap.db, automap_cache_save_record, &writer);
+
+	memset (&header, 0, sizeof (header));
+	memcpy (header.magic, AUTOMAP_CACHE_MAGIC, sizeof (header.magic));
+	header.version    = AUTOMAP_CACHE_VERSION;
+	header.byte_order = AUTOMAP_CACHE_ORDER;
+	header.rooms      = writer.rooms->len;
+	header.exits      = writer.exits->len;
+	header.strings    = writer.strings->len;
+	header.db_size    = st_db->st_size;
+	header.db_mtime   = st_db->st_mtim.tv_sec;
+	header.db_mtime_nsec = st_db->st_mtim.tv_nsec;
+
+	filename = g_strdup_printf ("%s.tmp", automap_cache.filename);
+
+	if ((fp = fopen (filename, "wb")) != NULL)
+	{
+		ok = fwrite (&header, sizeof (header), 1, fp) == 1;
+		ok = ok && fwrite (writer.rooms->data, sizeof (automap_cache_room_t),
+			writer.rooms->len, fp) == writer.rooms->len;
+		ok = ok && fwrite (writer.exits->data, sizeof (automap_cache_exit_t),
+			writer.exits->len, fp) == writer.exits->len;
+		ok = ok && fwrite (writer.strings->str, 1, writer.strings->len, fp)
+			== writer.strings->len;
+		ok = (fclose (fp) == 0) && ok;
+
+		if (!ok || rename (filename, automap_cache.filename))
+		{
+			printt ("Unable to write automap cache");
+			unlink (filename);
+		}
+	}
+	else
+		printt ("Unable to open automap cache for writing");
+
+	g_free (filename);
+	g_hash_table_destroy (writer.offsets);
+	g_string_free (writer.strings, TRUE);
+	g_array_free (writer.exits, TRUE);
+	g_array_free (writer.rooms, TRUE);
+}
+
+
+/* =========================================================================
+ = AUTOMAP_CACHE_SAVE_RECORD
+ =
+ = Append room and its exits to automap.bin contents
+ ======================================================================== */
+
+static void automap_cache_save_record (gpointer key, gpointer value,
+	gpointer user_data)
+{
+	automap_cache_writer_t *writer = user_data;
+	automap_record_t *record = value;
+	automap_cache_room_t room;
+	automap_cache_exit_t ce;
+	exit_info_t *exit_info;
+	gint i;
+
+	memset (&room, 0, sizeof (room));
+	room.id         = automap_cache_string (writer,
+		automap_id_to_str (record->id));
+	room.name       = automap_cache_string (writer, record->name);
+	room.exits      = record->exits;
+	room.flags      = record->flags;
+	room.first_exit = writer->exits->len;
+	room.x          = record->x;
+	room.y          = record->y;
+	room.z          = record->z;
+	room.session    = record->session;
+
+	for (i = 0; (exit_info = automap_exit_next (record, &i)); )
+	{
+		ce.id        = exit_info->id ? automap_cache_string (writer,
+			automap_id_to_str (exit_info->id)) : 0;
+		ce.str       = automap_cache_string (writer, exit_info->str);
+		ce.required  = automap_cache_string (writer, exit_info->required);
+		ce.direction = exit_info->direction;
+		ce.flags     = exit_info->flags & ~EXIT_FLAG_BLOCKED;
+
+		g_array_append_val (writer->exits, ce);
+		room.exit_count++;
+	}
+
+	g_array_append_val (writer->rooms, room);
+}
+
+
+/* =========================================================================
+ = AUTOMAP_CACHE_STRING
+ =
+ = Returns the string table offset for str, adding it if it is new
+ ======================================================================== */
+
+static guint32 automap_cache_string (automap_cache_writer_t *writer,
+	const gchar *str)
+{
+	gpointer offset;
+
+	if (str == NULL || str[0] == '\0')
+		return 0;
+
+	if ((offset = g_hash_table_lookup (writer->offsets, str)) == NULL)
+	{
+		offset = GUINT_TO_POINTER (writer->strings->len);
+		g_hash_table_insert (writer->offsets, (gpointer) str, offset);
+		g_string_append_len (writer->strings, str, strlen (str) + 1);
+	}
+
+	return GPOINTER_TO_UINT (offset);
+}
+
+
+/* =========================================================================
+ = AUTOMAP_CACHE_UNMAP
+ =
+ = Release automap.bin, once nothing points into it
+ ======================================================================== */
+
+static void automap_cache_unmap (void)
+{
+	if (automap_cache.data)
+		munmap (automap_cache.data, automap_cache.size);
+
+	automap_cache.data = NULL;
+	automap_cache.size = 0;
 }
 
 
@@ -473,21 +979,24 @@ void automap_db_load (void)
 static void automap_parse_exit_info (automap_record_t *record, gchar *str)
 {
 	exit_info_t *exit_info;
-	gchar *offset;
+	gchar *offset, *id;
 
 	g_assert (record != NULL);
 	g_assert (str != NULL);
 
-	exit_info = g_malloc0 (sizeof (exit_info_t));
+	exit_info = automap_arena_alloc (&exit_arena);
 
 	offset = str;
-	exit_info->id        = get_token_as_str (&offset);
+	id = get_token_as_str (&offset);
+	exit_info->id        = automap_id_intern (id);
+	g_free (id);
 	exit_info->str       = get_token_as_str (&offset);
 	exit_info->required  = get_token_as_str (&offset);
 	exit_info->direction = get_token_as_long (&offset);
 	exit_info->flags     = get_token_as_long (&offset);
 
-	record->exit_list = g_slist_append (record->exit_list, exit_info);
+	automap_exit_attach (record, exit_info);
+	automap_edge_add (exit_info);
 }
 
 
@@ -497,9 +1006,12 @@ static void automap_parse_exit_info (automap_record_t *record, gchar *str)
  = Lookup room ID within automap database
  ======================================================================== */
 
-automap_record_t *automap_db_lookup (gchar *id)
+automap_record_t *automap_db_lookup (guint32 id)
 {
-	return g_hash_table_lookup (automap.db, id);
+	if (id == 0)
+		return NULL; /* unknown exit */
+
+	return g_hash_table_lookup (automap.db, GUINT_TO_POINTER (id));
 }
 
 
@@ -511,24 +1023,17 @@ automap_record_t *automap_db_lookup (gchar *id)
 
 automap_record_t *automap_db_add_location (void)
 {
-	automap_record_t *record, *tmp;
+	automap_record_t *record;
 	exit_table_t *et;
-	gchar *buf;
+	gchar id[16];
 
-	record = g_malloc0 (sizeof (automap_record_t));
+	record = automap_arena_alloc (&record_arena);
 
-	do /* get unique room ID */
-	{
-		buf = g_strdup_printf ("%d", rand ());
-
-		if ((tmp = automap_db_lookup (buf)) != NULL)
-		{
-			g_free (buf);
-			buf = NULL;
-		}
-	} while (buf == NULL);
+	do /* get text for a new room ID, "0" is reserved for unknown exits */
+		snprintf (id, sizeof (id), "%u", (guint) rand () + 1);
+	while (automap_id_from_str (id) != 0);
 
-	record->id      = buf;
+	record->id      = automap_id_intern (id);
 	record->name    = g_strdup (automap.room_name->str);
 	record->x       = automap.x;
 	record->y       = automap.y;
@@ -549,7 +1054,8 @@ automap_record_t *automap_db_add_location (void)
 		}
 	}
 
-	g_hash_table_insert (automap.db, record->id, record);
+	g_hash_table_insert (automap.db, GUINT_TO_POINTER (record->id), record);
+	automap_index_insert (record);
 
 	return record;
 }
@@ -563,6 +1069,7 @@ automap_record_t *automap_db_add_location (void)
 
 void automap_db_save (void)
 {
+	struct stat st_db;
 	FILE *fp;
 
 	if ((fp = fopen (mudpro_db.automap.filename, "w")) == NULL)
@@ -579,7 +1086,8 @@ void automap_db_save (void)
 	if (automap.db)
 		g_hash_table_foreach (automap.db, automap_record_save, fp);
 
-	fclose (fp);
+	if (fclose (fp) == 0 && !stat (mudpro_db.automap.filename, &st_db))
+		automap_cache_save (&st_db);
 
 	g_get_current_time (&mudpro_db.automap.access);
 }
@@ -596,26 +1104,26 @@ static void automap_record_save (gpointer key, gpointer value,
 {
 	automap_record_t *record = value;
 	exit_info_t *exit_info;
-	GSList *node;
+	gint i;
 	FILE *fp = user_data;
 
 	g_assert (record != NULL);
 	g_assert (fp != NULL);
 
 	fprintf (fp, "%s, \"%s\", %ld, %ld, %ld, %ld, %ld, %ld\n",
-		record->id,
+		automap_id_to_str (record->id),
 		record->name,
 		record->exits,
 		record->flags,
 		record->x, record->y, record->z,
 		record->session);
 
-	for (node = record->exit_list; node; node = node->next)
+	for (i = 0; (exit_info = automap_exit_next (record, &i)); )
 	{
-		exit_info = node->data;
 		FlagOFF (exit_info->flags, EXIT_FLAG_BLOCKED);
 
- 		fprintf (fp, "\t%s, \"%s\", \"%s\", %ld, %ld\n", exit_info->id,
+ 		fprintf (fp, "\t%s, \"%s\", \"%s\", %ld, %ld\n",
+			automap_id_to_str (exit_info->id),
 			(exit_info->str) ? exit_info->str : "",
 			(exit_info->required) ? exit_info->required : "",
 			exit_info->direction, exit_info->flags);
@@ -632,10 +1140,15 @@ static void automap_record_save (gpointer key, gpointer value,
 
 void automap_db_free (void)
 {
+	automap_index_free ();
 	g_hash_table_foreach (automap.db, automap_record_deallocate,
-		GINT_TO_POINTER (1) /* free key/value */);
+		GINT_TO_POINTER (0) /* records go with the arena */);
 	g_hash_table_destroy (automap.db);
 	automap.db = NULL;
+
+	automap_arena_clear (&exit_arena);
+	automap_arena_clear (&record_arena);
+	automap_cache_unmap ();
 }
 
 
@@ -669,27 +1182,31 @@ static void automap_record_deallocate (gpointer key, gpointer value,
 {
 	automap_record_t *record = value;
 	exit_info_t *exit_info;
-	GSList *node;
+	gint i;
 
-	g_assert (key != NULL);
 	g_assert (record != NULL);
 
-	for (node = record->exit_list; node; node = node->next)
+	for (i = 0; (exit_info = automap_exit_next (record, &i)); )
 	{
-		exit_info = node->data;
-		g_free (exit_info->id);
 		g_free (exit_info->str);
 		g_free (exit_info->required);
-		g_free (exit_info);
+
+		if (GPOINTER_TO_INT (user_data))
+		{
+			automap_edge_del (exit_info);
+			automap_arena_release (&exit_arena, exit_info);
+		}
 	}
-	g_slist_free (record->exit_list);
-	g_free (record->name);
+	g_slist_free (record->exit_special);
+
+	/* names loaded from automap.bin are not ours to free */
+	if (!automap_cache.data ||
+		record->name <  (gchar *) automap_cache.data ||
+		record->name >= (gchar *) automap_cache.data + automap_cache.size)
+		g_free (record->name);
 
 	if (GPOINTER_TO_INT (user_data))
-	{
-		g_free (key); /* record->id */
-		g_free (value);
-	}
+		automap_arena_release (&record_arena, record);
 }
 
 
@@ -913,20 +1430,27 @@ exit_info_t *automap_add_exit_info (automap_record_t *record, gint direction)
 	if (automap_get_exit_info (record, direction))
 		return NULL; /* exit already defined */
 
-	exit_info = g_malloc0 (sizeof (exit_info_t));
+	exit_info = automap_arena_alloc (&exit_arena);
 
-	exit_info->id        = g_strdup ("0");
+	exit_info->id        = 0;
 	exit_info->str       = NULL;
 	exit_info->required  = NULL;
 	exit_info->direction = direction;
 
     if (VISIBLE_EXITS & direction)
+    {
+        /* exits are part of the name index key */
+        gboolean indexed = automap_index_remove (record);
+
         FlagON (record->exits, direction);
+        if (indexed)
+            automap_index_insert (record);
+    }
 
 	if (VISIBLE_DOORS & direction)
 		FlagON (exit_info->flags, EXIT_FLAG_DOOR);
 
-	record->exit_list = g_slist_append (record->exit_list, exit_info);
+	automap_exit_attach (record, exit_info);
 
 	return exit_info;
 }
@@ -946,7 +1470,10 @@ exit_info_t *automap_get_exit_info (automap_record_t *record, gint direction)
 	if (!record)
 		return NULL;
 
-	for (node = record->exit_list; node; node = node->next)
+	if (EXIT_SLOTTED (direction))
+		return record->exit[EXIT_SLOT (direction)];
+
+	for (node = record->exit_special; node; node = node->next)
 	{
 		exit_info = node->data;
 		if (exit_info->direction == direction)
@@ -956,6 +1483,49 @@ exit_info_t *automap_get_exit_info (automap_record_t *record, gint direction)
 }
 
 
+/* =========================================================================
+ = AUTOMAP_EXIT_NEXT
+ =
+ = Returns the next exit at location, starting from *index = 0. Direction
+ = slots come first, in direction order, then the special exits
+ ======================================================================== */
+
+exit_info_t *automap_exit_next (automap_record_t *record, gint *index)
+{
+	g_assert (record != NULL);
+	g_assert (index != NULL);
+
+	while (*index < EXIT_SLOTS)
+	{
+		exit_info_t *exit_info = record->exit[(*index)++];
+
+		if (exit_info)
+			return exit_info;
+	}
+
+	return g_slist_nth_data (record->exit_special, (*index)++ - EXIT_SLOTS);
+}
+
+
+/* =========================================================================
+ = AUTOMAP_EXIT_ATTACH
+ =
+ = Stores exit info at location, in its direction slot where it has one
+ ======================================================================== */
+
+static void automap_exit_attach (automap_record_t *record,
+	exit_info_t *exit_info)
+{
+	gint direction = exit_info->direction;
+
+	if (EXIT_SLOTTED (direction) && !record->exit[EXIT_SLOT (direction)])
+		record->exit[EXIT_SLOT (direction)] = exit_info;
+	else
+		record->exit_special = g_slist_append (record->exit_special,
+			exit_info);
+}
+
+
 /* =========================================================================
  = AUTOMAP_FIND_LOCATION
  =
@@ -964,95 +1534,169 @@ exit_info_t *automap_get_exit_info (automap_record_t *record, gint direction)
 
 static automap_record_t *automap_find_location (void)
 {
-	automap_record_t *location = NULL;
-	g_hash_table_foreach (automap.db, automap_location_search, &location);
-	return location;
+	automap_record_t *location;
+	automap_index_key_t key;
+	GSList *node;
+
+	/* require a complete match */
+	location = automap_find_xyz_match (automap.x, automap.y, automap.z, NULL);
+
+	if (location || !automap.lost)
+		return location;
+
+	/* if lost, allow match without XYZ */
+	memset (&key, 0, sizeof (key));
+
+	if ((key.name = g_quark_try_string (automap.room_name->str)) == 0)
+		return NULL; /* no room by this name */
+
+	key.exits = VISIBLE_EXITS;
+
+	node = automap_index_lookup (automap.db_by_name, &key);
+	return node ? node->data : NULL;
 }
 
 
 /* =========================================================================
- = AUTOMAP_LOCATION_SEARCH
+ = AUTOMAP_FIND_XYZ_MATCH
  =
- = Performs search for automap_find_location, do not call directly
+ = Returns a room at XYZ matching the current room name and exits
  ======================================================================== */
 
-static void automap_location_search (gpointer key, gpointer value,
-	gpointer user_data)
+static automap_record_t *automap_find_xyz_match (glong x, glong y, glong z,
+	automap_record_t *exclude)
 {
-	automap_record_t *record = value, **location = user_data;
+	automap_record_t *record;
+	automap_index_key_t key;
+	GSList *node;
 
-	g_assert (record != NULL);
-	g_assert (location != NULL);
+	memset (&key, 0, sizeof (key));
+	key.x = x;
+	key.y = y;
+	key.z = z;
 
-	if (automap.lost) /* if lost, allow match without XYZ */
+	for (node = automap_index_lookup (automap.db_by_xyz, &key);
+		node; node = node->next)
 	{
-		if (!strcmp (record->name, automap.room_name->str)
-			&& record->exits == VISIBLE_EXITS)
-			*location = record;
+		record = node->data;
+
+		if (record != exclude
+			&& record->exits == VISIBLE_EXITS
+			&& !strcmp (record->name, automap.room_name->str))
+			return record;
 	}
 
-	/* otherwise require a complete match */
+	return NULL;
+}
+
 
-	if (!strcmp (record->name, automap.room_name->str)
-		&& record->exits == VISIBLE_EXITS
-		&& record->x == automap.x
-		&& record->y == automap.y
-		&& record->z == automap.z)
-		*location = record;
+/* =========================================================================
+ = AUTOMAP_LOCATION_DEREFERENCE
+ =
+ = Remove any reference to location
+ ======================================================================== */
+
+static void automap_location_dereference (guint32 id)
+{
+	GSList *incoming, *node;
+
+	incoming = automap_edge_steal (id);
+
+	for (node = incoming; node; node = node->next)
+	{
+		exit_info_t *exit_info = node->data;
+		exit_info->id = 0;
+	}
+
+	g_slist_free (incoming);
 }
 
 
 /* =========================================================================
- = AUTOMAP_DUPLICATE_SEARCH
+ = AUTOMAP_EDGE_ADD
  =
- = Performs search for automap_merge_duplicates, do not call directly
+ = Record exit as an entrance to the room it leads to
  ======================================================================== */
 
-static void automap_duplicate_search (gpointer key, gpointer value,
-	gpointer user_data)
+static void automap_edge_add (exit_info_t *exit_info)
 {
-	automap_record_t *record = value, **location = user_data;
+	gpointer key = GUINT_TO_POINTER (exit_info->id);
 
-	g_assert (record != NULL);
-	g_assert (location != NULL);
+	if (exit_info->id == 0)
+		return; /* leads nowhere known */
 
-	if (!strcmp (record->name, automap.room_name->str)
-		&& strcmp (record->id, automap.location->id)
-		&& record->exits == VISIBLE_EXITS
-		&& record->x == automap.x
-		&& record->y == automap.y
-		&& record->z == automap.z)
-		*location = record;
+	g_hash_table_insert (automap.db_incoming, key, g_slist_prepend (
+		g_hash_table_lookup (automap.db_incoming, key), exit_info));
 }
 
 
 /* =========================================================================
- = AUTOMAP_LOCATION_DEREFERENCE
+ = AUTOMAP_EDGE_DEL
  =
- = Remove any reference to location
+ = Forget exit as an entrance to the room it leads to
  ======================================================================== */
 
-static void automap_location_dereference (gpointer key, gpointer value,
-	gpointer user_data)
+static void automap_edge_del (exit_info_t *exit_info)
 {
-	automap_record_t *record = value;
-	exit_info_t *exit_info;
-	gchar *id = user_data;
-	GSList *node;
+	gpointer key = GUINT_TO_POINTER (exit_info->id);
+	GSList *incoming;
 
-	g_assert (record != NULL);
-	g_assert (id != NULL);
+	if (exit_info->id == 0)
+		return;
 
-	for (node = record->exit_list; node; node = node->next)
-	{
-		exit_info = node->data;
+	incoming = g_slist_remove (
+		g_hash_table_lookup (automap.db_incoming, key), exit_info);
 
-		if (strcmp (exit_info->id, id))
-			continue;
+	if (incoming)
+		g_hash_table_insert (automap.db_incoming, key, incoming);
+	else
+		g_hash_table_remove (automap.db_incoming, key);
+}
 
-		g_free (exit_info->id);
-		exit_info->id = g_strdup ("0");
-	}
+
+/* =========================================================================
+ = AUTOMAP_EDGE_SET
+ =
+ = Point exit at another room, keeping the entrance lists in step
+ ======================================================================== */
+
+static void automap_edge_set (exit_info_t *exit_info, guint32 id)
+{
+	automap_edge_del (exit_info);
+	exit_info->id = id;
+	automap_edge_add (exit_info);
+}
+
+
+/* =========================================================================
+ = AUTOMAP_EDGE_STEAL
+ =
+ = Returns the exits leading to room ID, which are no longer tracked. The
+ = caller owns the list
+ ======================================================================== */
+
+static GSList *automap_edge_steal (guint32 id)
+{
+	gpointer key = GUINT_TO_POINTER (id);
+	GSList *incoming;
+
+	if ((incoming = g_hash_table_lookup (automap.db_incoming, key)) != NULL)
+		g_hash_table_remove (automap.db_incoming, key);
+
+	return incoming;
+}
+
+
+/* =========================================================================
+ = AUTOMAP_EDGE_LIST_FREE
+ =
+ = Free list of exits leading to a room
+ ======================================================================== */
+
+static void automap_edge_list_free (gpointer key, gpointer value,
+	gpointer user_data)
+{
+	g_slist_free (value);
 }
 
 
@@ -1065,8 +1709,6 @@ static void automap_location_dereference (gpointer key, gpointer value,
 static automap_record_t *automap_location_get_next (automap_record_t *record,
 	exit_table_t *et)
 {
-	gchar *id;
-
 	if (record == NULL)
 		return NULL;
 
@@ -1075,7 +1717,7 @@ static automap_record_t *automap_location_get_next (automap_record_t *record,
 		GSList *node;
 		exit_info_t *exit_info;
 
-		for (node = record->exit_list; node; node = node->next)
+		for (node = record->exit_special; node; node = node->next)
 		{
 			exit_info = node->data;
 			if (exit_info->str &&
@@ -1086,13 +1728,8 @@ static automap_record_t *automap_location_get_next (automap_record_t *record,
 		return NULL;
 	}
 
-	if ((id = automap_get_exit_id (record, et->direction)) != NULL)
-	{
-		if (id[0] != '\0') /* if connected to room, look it up */
-			return automap_db_lookup (id);
-	}
-
-	return NULL;
+	/* if connected to room, look it up */
+	return automap_db_lookup (automap_get_exit_id (record, et->direction));
 }
 
 
@@ -1105,37 +1742,28 @@ static automap_record_t *automap_location_get_next (automap_record_t *record,
 void automap_location_merge (automap_record_t *original,
 	automap_record_t *duplicate)
 {
-	GSList *node1, *node2;
-	automap_record_t *record;
+	GSList *incoming, *node;
 
 	g_assert (original != NULL);
 	g_assert (duplicate != NULL);
 
-	/* scan exits defined for the original location */
-	for (node1 = original->exit_list; node1; node1 = node1->next)
-	{
-		exit_info_t *exit_info = node1->data;
+	/* replace all references to duplicate record with original */
+	incoming = automap_edge_steal (duplicate->id);
 
-		if ((record = automap_db_lookup (exit_info->id)) == NULL)
-			continue;
-
-		/* replace all references to duplicate record with original */
-		for (node2 = record->exit_list; node2; node2 = node2->next)
-		{
-			exit_info_t *exit_info = node2->data;
-
-			if (strcmp (exit_info->id, duplicate->id))
-				continue;
+	for (node = incoming; node; node = node->next)
+	{
+		exit_info_t *exit_info = node->data;
 
-			g_free (exit_info->id);
-			exit_info->id = g_strdup (original->id);
-		}
+		exit_info->id = original->id;
+		automap_edge_add (exit_info);
 	}
 
+	g_slist_free (incoming);
+
 	/* remove duplicate from database */
-	g_hash_table_remove (automap.db, duplicate->id);
-	automap_record_deallocate (duplicate->id, duplicate,
-		GINT_TO_POINTER (1));
+	automap_index_remove (duplicate);
+	g_hash_table_remove (automap.db, GUINT_TO_POINTER (duplicate->id));
+	automap_record_deallocate (NULL, duplicate, GINT_TO_POINTER (1));
 
 	/* update automap location */
 	automap_set_location (original);
@@ -1150,12 +1778,13 @@ void automap_location_merge (automap_record_t *original,
 
 void automap_duplicate_merge (void)
 {
-	automap_record_t *original = NULL;
+	automap_record_t *original;
 
 	if (!automap.location)
 		return;
 
-	g_hash_table_foreach (automap.db, automap_duplicate_search, &original);
+	original = automap_find_xyz_match (automap.x, automap.y, automap.z,
+		automap.location);
 
 	if (original)
 		automap_location_merge (original, automap.location);
@@ -1168,26 +1797,20 @@ void automap_duplicate_merge (void)
  = Returns the exit ID for the given exit at location
  ======================================================================== */
 
-static gchar *automap_get_exit_id (automap_record_t *record, gint direction)
+static guint32 automap_get_exit_id (automap_record_t *record, gint direction)
 {
 	exit_info_t *exit_info;
-	GSList *node;
 
 	if (record == NULL)
-		return NULL;
+		return 0;
 
 	g_assert (direction > 0);
 
 	/* see if the ID is available */
-	for (node = record->exit_list; node; node = node->next)
-	{
-		exit_info = node->data;
+	if ((exit_info = automap_get_exit_info (record, direction)) != NULL)
+		return exit_info->id;
 
-		if (exit_info->direction == direction)
-			return exit_info->id;
-	}
-
-	return NULL;
+	return 0;
 }
 
 
@@ -1197,45 +1820,35 @@ static gchar *automap_get_exit_id (automap_record_t *record, gint direction)
  = Sets the exit ID for the given direction
  ======================================================================== */
 
-static void automap_set_exit_id (automap_record_t *record, gchar *id,
+static void automap_set_exit_id (automap_record_t *record, guint32 id,
 	gint direction, gchar *exit_str)
 {
 	exit_info_t *exit_info = NULL;
-	GSList *node;
 
 	if (direction == 0)
 		return;
 
 	g_assert (record != NULL);
-	g_assert (id != NULL);
+	g_assert (id != 0);
 
 	if (direction == EXIT_SPECIAL)
 	{
 		g_assert (exit_str != NULL);
 		if ((exit_info = automap_add_exit_info (record, direction)) == NULL)
 		{
-			printt ("SET_EXIT_ID: Failed to set exit '%s' for %s", exit_str, id);
+			printt ("SET_EXIT_ID: Failed to set exit '%s' for %s", exit_str,
+				automap_id_to_str (id));
 			return;
 		}
-		g_free (exit_info->id);
-		exit_info->id  = g_strdup (id);
+		automap_edge_set (exit_info, id);
 		exit_info->str = g_strdup (exit_str);
 		FlagON (exit_info->flags, EXIT_FLAG_EXITSTR);
 		return;
 	}
 
 	/* set ID for direction */
-	for (node = record->exit_list; node; node = node->next)
-	{
-		exit_info = node->data;
-
-		if (exit_info->direction != direction)
-			continue;
-
-		g_free (exit_info->id);
-		exit_info->id = g_strdup (id);
-		return;
-	}
+	if ((exit_info = automap_get_exit_info (record, direction)) != NULL)
+		automap_edge_set (exit_info, id);
 }
 
 
@@ -1400,12 +2013,12 @@ void automap_remove_location (void)
 	if (automap.lost || !automap.location)
 		return; /* cannot remove location */
 
-	g_hash_table_foreach (automap.db, automap_location_dereference,
-		automap.location->id);
+	automap_location_dereference (automap.location->id);
 
-	automap_record_deallocate (automap.location->id, automap.location,
-		GINT_TO_POINTER (0) /* do not free key/value yet */);
-	g_hash_table_remove (automap.db, automap.location->id);
+	automap_index_remove (automap.location);
+	g_hash_table_remove (automap.db, GUINT_TO_POINTER (automap.location->id));
+	automap_record_deallocate (NULL, automap.location,
+		GINT_TO_POINTER (1) /* return record to the arena */);
 	automap.location = NULL;
 	automap_disable ();
 }
@@ -1419,6 +2032,8 @@ void automap_remove_location (void)
 
 void automap_adjust_xyz (gint xyz, gint adj)
 {
+	gboolean indexed = automap_index_remove (automap.location);
+
 	switch (xyz)
 	{
 	case 'x':
@@ -1437,6 +2052,9 @@ void automap_adjust_xyz (gint xyz, gint adj)
 		automap.location->z = automap.z;
 		break;
 	}
+
+	if (indexed)
+		automap_index_insert (automap.location);
 }
 
 
@@ -1516,6 +2134,61 @@ gint automap_get_exit_as_int (gchar *str)
 	return 0;
 }
 
+
+/* =========================================================================
+ = AUTOMAP_ID_INTERN
+ =
+ = Returns the room ID for its text form, as written in automap.db (eg
+ = "123", or "1/123" as misc/generate-automap.pl writes them), assigning
+ = the next free one to text not seen before. Empty or "0" is 0, unknown
+ ======================================================================== */
+
+guint32 automap_id_intern (const gchar *str)
+{
+	guint32 id;
+
+	if ((id = automap_id_from_str (str)) != 0 ||
+		str == NULL || str[0] == '\0' || !strcmp (str, "0"))
+		return id;
+
+	id = automap_ids.str->len;
+	g_ptr_array_add (automap_ids.str, g_strdup (str));
+	g_hash_table_insert (automap_ids.by_str,
+		g_ptr_array_index (automap_ids.str, id), GUINT_TO_POINTER (id));
+
+	return id;
+}
+
+
+/* =========================================================================
+ = AUTOMAP_ID_FROM_STR
+ =
+ = Returns the room ID for the given text, 0 if it has none
+ ======================================================================== */
+
+guint32 automap_id_from_str (const gchar *str)
+{
+	if (str == NULL)
+		return 0;
+
+	return GPOINTER_TO_UINT (g_hash_table_lookup (automap_ids.by_str, str));
+}
+
+
+/* =========================================================================
+ = AUTOMAP_ID_TO_STR
+ =
+ = Returns the text form of a room ID, for writing it out
+ ======================================================================== */
+
+const gchar *automap_id_to_str (guint32 id)
+{
+	if (id >= automap_ids.str->len)
+		return "0";
+
+	return g_ptr_array_index (automap_ids.str, id);
+}
+
 /* =========================================================================
  = AUTOMAP_SET_OBVIOUS_EXIT
  =
@@ -1561,3 +2234,295 @@ void automap_set_secret (automap_record_t *record, gint direction)
 	if (mapview.visible)
 		mapview_update ();
 }
+
+
+/* =========================================================================
+ = AUTOMAP_ARENA_ALLOC
+ =
+ = Returns a zeroed chunk from the arena, reusing released chunks first
+ ======================================================================== */
+
+static gpointer automap_arena_alloc (automap_arena_t *arena)
+{
+	gpointer chunk;
+
+	if (arena->free)
+	{
+		chunk = arena->free;
+		arena->free = *(gpointer *) chunk;
+	}
+	else
+	{
+		if (!arena->blocks || arena->used == arena->per_block)
+		{
+			arena->blocks = g_slist_prepend (arena->blocks,
+				g_malloc (arena->size * arena->per_block));
+			arena->used = 0;
+		}
+
+		chunk = (gchar *) arena->blocks->data + arena->size * arena->used++;
+	}
+
+	arena->chunks++;
+
+	return memset (chunk, 0, arena->size);
+}
+
+
+/* =========================================================================
+ = AUTOMAP_ARENA_RELEASE
+ =
+ = Return a single chunk to the arena for reuse
+ ======================================================================== */
+
+static void automap_arena_release (automap_arena_t *arena, gpointer chunk)
+{
+	g_assert (chunk != NULL);
+	g_assert (arena->chunks > 0);
+
+	*(gpointer *) chunk = arena->free;
+	arena->free = chunk;
+	arena->chunks--;
+}
+
+
+/* =========================================================================
+ = AUTOMAP_ARENA_CLEAR
+ =
+ = Free every block in the arena, along with any chunks still in use
+ ======================================================================== */
+
+static void automap_arena_clear (automap_arena_t *arena)
+{
+	GSList *node;
+
+	for (node = arena->blocks; node; node = node->next)
+		g_free (node->data);
+
+	g_slist_free (arena->blocks);
+	arena->blocks = NULL;
+	arena->free   = NULL;
+	arena->used   = 0;
+	arena->chunks = 0;
+}
+
+
+/* =========================================================================
+ = AUTOMAP_INDEX_NEW
+ =
+ = Create the secondary room indexes
+ ======================================================================== */
+
+static void automap_index_new (void)
+{
+	automap.db_by_name = g_hash_table_new_full (automap_index_name_hash,
+		automap_index_name_equal, NULL, automap_index_bucket_free);
+
+	automap.db_by_xyz = g_hash_table_new_full (automap_index_xyz_hash,
+		automap_index_xyz_equal, NULL, automap_index_bucket_free);
+
+	automap.db_incoming = g_hash_table_new (g_direct_hash, g_direct_equal);
+}
+
+
+/* =========================================================================
+ = AUTOMAP_INDEX_FREE
+ =
+ = Free the secondary room indexes, records are left alone
+ ======================================================================== */
+
+static void automap_index_free (void)
+{
+	if (automap.db_by_name)
+		g_hash_table_destroy (automap.db_by_name);
+
+	if (automap.db_by_xyz)
+		g_hash_table_destroy (automap.db_by_xyz);
+
+	if (automap.db_incoming)
+	{
+		g_hash_table_foreach (automap.db_incoming, automap_edge_list_free,
+			NULL);
+		g_hash_table_destroy (automap.db_incoming);
+	}
+
+	automap.db_by_name  = NULL;
+	automap.db_by_xyz   = NULL;
+	automap.db_incoming = NULL;
+}
+
+
+/* =========================================================================
+ = AUTOMAP_INDEX_INSERT
+ =
+ = Add record to the secondary indexes
+ ======================================================================== */
+
+static void automap_index_insert (automap_record_t *record)
+{
+	automap_index_key_t key;
+
+	g_assert (record != NULL);
+
+	automap_index_key (&key, record);
+	automap_index_add (automap.db_by_name, &key, record);
+	automap_index_add (automap.db_by_xyz, &key, record);
+}
+
+
+/* =========================================================================
+ = AUTOMAP_INDEX_REMOVE
+ =
+ = Remove record from the secondary indexes, returns FALSE if not indexed.
+ = Must be called before changing the name, exits or XYZ of a record
+ ======================================================================== */
+
+static gboolean automap_index_remove (automap_record_t *record)
+{
+	automap_index_key_t key;
+	gboolean indexed;
+
+	if (record == NULL || automap.db_by_name == NULL)
+		return FALSE;
+
+	automap_index_key (&key, record);
+	indexed = automap_index_del (automap.db_by_name, &key, record);
+	automap_index_del (automap.db_by_xyz, &key, record);
+
+	return indexed;
+}
+
+
+/* =========================================================================
+ = AUTOMAP_INDEX_LOOKUP
+ =
+ = Returns the records sharing the given key
+ ======================================================================== */
+
+static GSList *automap_index_lookup (GHashTable *index, automap_index_key_t *key)
+{
+	automap_index_bucket_t *bucket;
+
+	if (index == NULL)
+		return NULL;
+
+	bucket = g_hash_table_lookup (index, key);
+	return bucket ? bucket->records : NULL;
+}
+
+
+/* =========================================================================
+ = AUTOMAP_INDEX_ADD
+ =
+ = Add record to the bucket for key, creating it if needed
+ ======================================================================== */
+
+static void automap_index_add (GHashTable *index, automap_index_key_t *key,
+	automap_record_t *record)
+{
+	automap_index_bucket_t *bucket;
+
+	if ((bucket = g_hash_table_lookup (index, key)) == NULL)
+	{
+		bucket = g_malloc0 (sizeof (automap_index_bucket_t));
+		bucket->key = *key;
+		g_hash_table_insert (index, &bucket->key, bucket);
+	}
+
+	bucket->records = g_slist_prepend (bucket->records, record);
+}
+
+
+/* =========================================================================
+ = AUTOMAP_INDEX_DEL
+ =
+ = Remove record from the bucket for key, dropping the bucket once empty
+ ======================================================================== */
+
+static gboolean automap_index_del (GHashTable *index, automap_index_key_t *key,
+	automap_record_t *record)
+{
+	automap_index_bucket_t *bucket;
+
+	if ((bucket = g_hash_table_lookup (index, key)) == NULL
+		|| !g_slist_find (bucket->records, record))
+		return FALSE;
+
+	bucket->records = g_slist_remove (bucket->records, record);
+
+	if (bucket->records == NULL)
+		g_hash_table_remove (index, &bucket->key); /* frees bucket */
+
+	return TRUE;
+}
+
+
+/* =========================================================================
+ = AUTOMAP_INDEX_KEY
+ =
+ = Fill in the index key for record
+ ======================================================================== */
+
+static void automap_index_key (automap_index_key_t *key,
+	automap_record_t *record)
+{
+	key->name  = g_quark_from_string (record->name);
+	key->exits = record->exits;
+	key->x     = record->x;
+	key->y     = record->y;
+	key->z     = record->z;
+}
+
+
+/* =========================================================================
+ = AUTOMAP_INDEX_BUCKET_FREE
+ =
+ = Free memory allocated to an index bucket
+ ======================================================================== */
+
+static void automap_index_bucket_free (gpointer data)
+{
+	automap_index_bucket_t *bucket = data;
+
+	g_slist_free (bucket->records);
+	g_free (bucket);
+}
+
+
+/* =========================================================================
+ = AUTOMAP_INDEX_NAME_HASH/EQUAL
+ =
+ = Hashing for the (name, exits) index
+ ======================================================================== */
+
+static guint automap_index_name_hash (gconstpointer key)
+{
+	const automap_index_key_t *k = key;
+	return k->name * 31 + (guint) k->exits;
+}
+
+static gboolean automap_index_name_equal (gconstpointer a, gconstpointer b)
+{
+	const automap_index_key_t *k1 = a, *k2 = b;
+	return k1->name == k2->name && k1->exits == k2->exits;
+}
+
+
+/* =========================================================================
+ = AUTOMAP_INDEX_XYZ_HASH/EQUAL
+ =
+ = Hashing for the (x, y, z) index
+ ======================================================================== */
+
+static guint automap_index_xyz_hash (gconstpointer key)
+{
+	const automap_index_key_t *k = key;
+	return ((guint) k->x * 73856093U) ^ ((guint) k->y * 19349663U)
+		^ ((guint) k->z * 83492791U);
+}
+
+static gboolean automap_index_xyz_equal (gconstpointer a, gconstpointer b)
+{
+	const automap_index_key_t *k1 = a, *k2 = b;
+	return k1->x == k2->x && k1->y == k2->y && k1->z == k2->z;
+}
@@ -36,14 +36,22 @@
 #define DOOR_CLOSED(x)    (automap.obvious.doors_closed & x)
 #define DOOR_UNLOCKED(x)  (automap.obvious.doors_unlocked & x)
 
+#define EXIT_SLOTS        10 /* EXIT_NORTH through EXIT_DOWN */
+
+/* exits kept in automap_record_t.exit[], indexed by EXIT_SLOT() */
+#define EXIT_SLOTTED(x) \
+	((x) >= EXIT_NORTH && (x) <= EXIT_DOWN && !((x) & ((x) - 1)))
+#define EXIT_SLOT(x)      (g_bit_nth_lsf ((x), -1) - 1)
+
 #define MOVEMENT_STR(x)	 exit_table[po2(x)].short_str
 #define DIRECTION_STR(x) exit_table[po2(x)].long_str
 
 typedef struct
 {
 	GTimeVal visited;     /* time of last visit */
-	GSList *exit_list;    /* list of exits */
-	gchar *id;            /* room ID */
+	struct exit_info_s *exit[EXIT_SLOTS]; /* exits by direction */
+	GSList *exit_special; /* special exits, plus any not in exit[] */
+	guint32 id;           /* room ID */
 	gchar *name;          /* room name */
 	gint regen;           /* regen index */
 	gulong exits;         /* visible exits (including doors) */
@@ -56,6 +64,9 @@ typedef struct
 typedef struct	/* automapper data */
 {
 	GHashTable *db;             /* automap room database */
+	GHashTable *db_by_name;     /* rooms indexed by name and exits */
+	GHashTable *db_by_xyz;      /* rooms indexed by XYZ position */
+	GHashTable *db_incoming;    /* exits indexed by the room they lead to */
 	GSList *movement;           /* player movement queue */
 	GString *room_name;         /* name of the room we're in */
 	GString *key;				/* last key used */
@@ -75,9 +86,9 @@ typedef struct	/* automapper data */
 	} obvious;
 } automap_t;
 
-typedef struct
+typedef struct exit_info_s
 {
-	gchar *id;			/* exit room ID */
+	guint32 id;			/* exit room ID (0 if unknown) */
 	gchar *str;			/* special action string */
 	gchar *required;    /* require key/item */
 	gulong direction;	/* direction of exit */
@@ -154,7 +165,7 @@ void automap_report (FILE *fp);
 void automap_enable (void);
 void automap_disable (void);
 void automap_db_load (void);
-automap_record_t *automap_db_lookup (gchar *id);
+automap_record_t *automap_db_lookup (guint32 id);
 automap_record_t *automap_db_add_location (void);
 void automap_db_save (void);
 void automap_db_free (void);
@@ -167,6 +178,7 @@ exit_table_t *automap_movement_get_next (void);
 void automap_movement_update (void);
 exit_info_t *automap_add_exit_info (automap_record_t *record, gint direction);
 exit_info_t *automap_get_exit_info (automap_record_t *record, gint direction);
+exit_info_t *automap_exit_next (automap_record_t *record, gint *index);
 void automap_location_merge (automap_record_t *original, automap_record_t *duplicate);
 void automap_duplicate_merge (void);
 void automap_set_location (automap_record_t *location);
@@ -175,6 +187,9 @@ void automap_remove_location (void);
 void automap_adjust_xyz (gint xyz, gint adj);
 void automap_reset (gboolean full_reset);
 gint automap_get_exit_as_int (gchar *str);
+guint32 automap_id_intern (const gchar *str);
+guint32 automap_id_from_str (const gchar *str);
+const gchar *automap_id_to_str (guint32 id);
 void automap_set_secret (automap_record_t *record, gint direction);
 
 #endif /* __AUTOMAP_H__ */
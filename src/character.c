@@ -28,11 +28,17 @@
 #include "monster.h"
 #include "mudpro.h"
 #include "navigation.h"
+#include "osd.h"
+#include "parse.h"
 #include "sockbuf.h"
+#include "stats.h"
 #include "terminal.h"
 #include "timers.h"
 #include "utils.h"
 
+#define STR_LOGIN_USERNAME "Otherwise type \"new\": "
+#define STR_LOGIN_PASSWORD "Enter your password: "
+
 character_t character;
 
 key_value_t character_races[]=
@@ -77,6 +83,8 @@ static void character_options_reset (void);
 static void character_options_parse (gchar *option, gchar *arguments);
 static void character_triggers_add (gchar *str, gchar *response);
 static void character_triggers_free (void);
+static void character_triggers_build (void);
+static guint character_triggers_insert (const gchar *str);
 static void character_triggers_execute (trigger_t *trigger);
 static void character_taunts_add (gchar *str);
 static void character_taunts_free (void);
@@ -182,6 +190,10 @@ static void character_options_reset (void)
 	character.line_style   = 1;
 	character.light_mode   = LIGHT_RESERVE_HIGH;
 	character.target_mode  = TARGET_MODE_DEFAULT;
+	character.parse_mode   = PARSE_MODE_LITERAL;
+	character.parse_jit_stack = 256;
+	character.parse_profile = FALSE;
+	character.parse_adaptive = FALSE;
 	character.prefix       = '.';
 
 	character.attempts.bash_door = 10;
@@ -249,6 +261,7 @@ void character_options_load (void)
 	}
 
 	character_vitals_calibrate ();
+	character_triggers_build ();
 
 	fclose (fp);
 }
@@ -509,6 +522,40 @@ static void character_options_parse (gchar *option, gchar *arguments)
 		character.wait.parcmd = CLAMP (value, 3, 60);
 	}
 
+	else if (!strcasecmp (option, "ParseAdapt"))
+	{
+		value = get_token_as_long (&arguments);
+		character.parse_adaptive = CLAMP (value, 0, 1);
+	}
+
+	else if (!strcasecmp (option, "ParseMode"))
+	{
+		if ((tmp = get_token_as_str (&arguments)) != NULL)
+		{
+			if (!strcasecmp (tmp, "Linear"))
+				character.parse_mode = PARSE_MODE_LINEAR;
+
+			else if (!strcasecmp (tmp, "Literal"))
+				character.parse_mode = PARSE_MODE_LITERAL;
+
+			else if (!strcasecmp (tmp, "Automaton"))
+				character.parse_mode = PARSE_MODE_AUTOMATON;
+		}
+	}
+
+	else if (!strcasecmp (option, "ParseStats"))
+	{
+		value = get_token_as_long (&arguments);
+		character.parse_profile = CLAMP (value, 0, 1);
+	}
+
+	else if (!strcasecmp (option, "ParseStack"))
+	{
+		value = get_token_as_long (&arguments);
+		character.parse_jit_stack = CLAMP (value, PARSE_JIT_STACK_MIN,
+			PARSE_JIT_STACK_MAX);
+	}
+
 	else if (!strcasecmp (option, "PartyWait"))
 	{
 		value = get_token_as_long (&arguments);
@@ -722,6 +769,57 @@ void character_vitals_calibrate (void)
 }
 
 
+/* =========================================================================
+ = CHARACTER_HP_UPDATE
+ =
+ = Update current hit points, as reported by the prompt
+ ======================================================================== */
+
+void character_hp_update (gint now)
+{
+	static gint last_value = 0;
+
+	character.hp.now = now;
+
+	if (character.hp.now != last_value)
+	{
+		stats.lowhp = MIN (stats.lowhp, character.hp.now);
+		osd_vitals_update ();
+		last_value = character.hp.now;
+	}
+}
+
+
+/* =========================================================================
+ = CHARACTER_MA_UPDATE
+ =
+ = Update current mana/kai, as reported by the prompt
+ ======================================================================== */
+
+void character_ma_update (gint now)
+{
+	static gint last_value = 0;
+
+	character.ma.now = now;
+
+	if (character.ma.now != last_value)
+	{
+		if (character.ma.now > last_value
+			&& character.ma.now != character.ma.max
+			&& character.state != STATE_ENGAGED
+			&& !command_pending (CMD_CAST))
+		{
+			character.tick.current = character.ma.now - last_value;
+			stats.mana_tick.total += character.tick.current;
+			stats.mana_tick.count++;
+		}
+
+		osd_vitals_update ();
+		last_value = character.ma.now;
+	}
+}
+
+
 /* =========================================================================
  = CHARACTER_TRIGGERS_ADD
  =
@@ -764,33 +862,200 @@ static void character_triggers_free (void)
 	}
 	g_slist_free (character.triggers);
 	character.triggers = NULL;
+
+	if (character.trigger_trie.edges)
+	{
+		g_hash_table_destroy (character.trigger_trie.edges);
+		g_array_free (character.trigger_trie.states, TRUE);
+		character.trigger_trie.edges = NULL;
+		character.trigger_trie.states = NULL;
+	}
 }
 
 
 /* =========================================================================
- = CHARACTER_TRIGGERS_PARSE
+ = CHARACTER_TRIGGERS_BUILD
  =
- = Parses message against triggers
+ = Build trie over the login prompts and triggers
  ======================================================================== */
 
-void character_triggers_parse (gchar *str)
+static void character_triggers_build (void)
 {
-	GSList *node;
+	trigger_state_t root = { 0, NULL, TRIGGER_LOGIN_NONE };
+	trigger_state_t *ts;
 	trigger_t *trigger;
+	GSList *node;
+	guint state;
+
+	character.trigger_trie.edges = g_hash_table_new (g_direct_hash,
+		g_direct_equal);
+	character.trigger_trie.states = g_array_new (FALSE, TRUE,
+		sizeof (trigger_state_t));
+	g_array_append_val (character.trigger_trie.states, root);
+
+	state = character_triggers_insert (STR_LOGIN_USERNAME);
+	g_array_index (character.trigger_trie.states, trigger_state_t,
+		state).login = TRIGGER_LOGIN_USERNAME;
+
+	state = character_triggers_insert (STR_LOGIN_PASSWORD);
+	g_array_index (character.trigger_trie.states, trigger_state_t,
+		state).login = TRIGGER_LOGIN_PASSWORD;
 
 	for (node = character.triggers; node; node = node->next)
 	{
 		trigger = node->data;
+		state = character_triggers_insert (trigger->str);
+		ts = &g_array_index (character.trigger_trie.states,
+			trigger_state_t, state);
 
-		if (strcmp (str, trigger->str))
-			continue;
+		if (!ts->trigger) /* earlier duplicates take precedence */
+			ts->trigger = trigger;
+	}
+
+	/* a line in progress is re-synced when it is next cleared */
+	character.trigger_trie.state = 0;
+	character.trigger_trie.depth = 0;
+}
+
+
+/* =========================================================================
+ = CHARACTER_TRIGGERS_INSERT
+ =
+ = Add string to the trigger trie, returns the state it ends in
+ ======================================================================== */
 
-		character_triggers_execute (trigger);
+static guint character_triggers_insert (const gchar *str)
+{
+	trigger_state_t ts = { 0, NULL, TRIGGER_LOGIN_NONE };
+	gpointer key;
+	guint state = 0, next;
+
+	g_assert (str != NULL);
+
+	for (; *str; str++)
+	{
+		key = GUINT_TO_POINTER (state << 8 | (guchar) *str);
+		next = GPOINTER_TO_UINT (g_hash_table_lookup (
+			character.trigger_trie.edges, key));
+
+		if (!next) /* state 0 is never a destination */
+		{
+			ts.parent = state;
+			next = character.trigger_trie.states->len;
+			g_array_append_val (character.trigger_trie.states, ts);
+			g_hash_table_insert (character.trigger_trie.edges, key,
+				GUINT_TO_POINTER (next));
+		}
+
+		state = next;
+	}
+
+	return state;
+}
+
+
+/* =========================================================================
+ = CHARACTER_TRIGGERS_RESET
+ =
+ = Start matching a new line
+ ======================================================================== */
+
+void character_triggers_reset (void)
+{
+	character.trigger_trie.state = 0;
+	character.trigger_trie.depth = 0;
+}
+
+
+/* =========================================================================
+ = CHARACTER_TRIGGERS_ADVANCE
+ =
+ = Follow byte appended to the line, now length bytes long. Once the line
+ = leaves the trie it stays off it until truncated back
+ ======================================================================== */
+
+void character_triggers_advance (guchar ch, gsize length)
+{
+	guint next;
+
+	if (!character.trigger_trie.edges
+		|| character.trigger_trie.depth + 1 != length)
 		return;
+
+	next = GPOINTER_TO_UINT (g_hash_table_lookup (character.trigger_trie.edges,
+		GUINT_TO_POINTER (character.trigger_trie.state << 8 | ch)));
+
+	if (next)
+	{
+		character.trigger_trie.state = next;
+		character.trigger_trie.depth = length;
 	}
 }
 
 
+/* =========================================================================
+ = CHARACTER_TRIGGERS_TRUNCATE
+ =
+ = Follow the line being cut back to length bytes
+ ======================================================================== */
+
+void character_triggers_truncate (gsize length)
+{
+	if (!character.trigger_trie.edges)
+		return;
+
+	while (character.trigger_trie.depth > length)
+	{
+		character.trigger_trie.state = g_array_index (
+			character.trigger_trie.states, trigger_state_t,
+			character.trigger_trie.state).parent;
+		character.trigger_trie.depth--;
+	}
+}
+
+
+/* =========================================================================
+ = CHARACTER_TRIGGERS_MATCHING
+ =
+ = Returns TRUE while the line, length bytes long, could still become a
+ = login prompt or trigger
+ ======================================================================== */
+
+gboolean character_triggers_matching (gsize length)
+{
+	return character.trigger_trie.edges && character.trigger_trie.depth == length;
+}
+
+
+/* =========================================================================
+ = CHARACTER_TRIGGERS_PARSE
+ =
+ = Respond if the line, length bytes long, is a login prompt or trigger
+ ======================================================================== */
+
+void character_triggers_parse (gsize length)
+{
+	trigger_state_t *ts;
+
+	if (!character.trigger_trie.edges || character.trigger_trie.depth != length)
+		return; /* line isn't in the trie */
+
+	ts = &g_array_index (character.trigger_trie.states, trigger_state_t,
+		character.trigger_trie.state);
+
+	if (ts->login == TRIGGER_LOGIN_USERNAME
+		&& !character.flag.ready && character.username)
+		send_line (character.username);
+
+	else if (ts->login == TRIGGER_LOGIN_PASSWORD
+		&& !character.flag.ready && character.password)
+		send_line (character.password);
+
+	else if (ts->trigger)
+		character_triggers_execute (ts->trigger);
+}
+
+
 /* =========================================================================
  = CHARACTER_TRIGGERS_EXECUTE
  =
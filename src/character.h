@@ -68,6 +68,10 @@ typedef struct
 	gint line_style;   /* character set to use */
 	gint light_mode;   /* light convservation mode */
 	gint target_mode;  /* target selection mode */
+	gint parse_mode;   /* regexp list matching mode */
+	gint parse_jit_stack; /* regexp JIT stack size (kilobytes) */
+	gboolean parse_profile; /* collect per-pattern match statistics */
+	gboolean parse_adaptive; /* reorder exclusive regexps by hit frequency */
 	player_t *leader;  /* party leader */
 	GTimeVal rollcall; /* time of last rollcall */
 
@@ -205,6 +209,14 @@ typedef struct
 		GSList *list;
 		gint count;
 	} taunt;
+
+	struct /* triggers and login prompts as a trie, walked as bytes arrive */
+	{
+		GHashTable *edges; /* (state << 8 | byte) -> next state */
+		GArray *states;    /* trigger_state_t, state 0 is the empty line */
+		guint state;       /* state reached by the line received so far */
+		gsize depth;       /* length of the line that state accounts for */
+	} trigger_trie;
 } character_t;
 
 typedef struct
@@ -213,6 +225,20 @@ typedef struct
 	gchar *response;
 } trigger_t;
 
+typedef struct
+{
+	guint parent;       /* state before the last byte */
+	trigger_t *trigger; /* first trigger for the line ending here */
+	gint login;         /* TRIGGER_LOGIN_* prompt ending here */
+} trigger_state_t;
+
+enum /* login prompts answered from the profile */
+{
+	TRIGGER_LOGIN_NONE,
+	TRIGGER_LOGIN_USERNAME,
+	TRIGGER_LOGIN_PASSWORD,
+};
+
 enum /* character states */
 {
 	STATE_NONE,
@@ -282,7 +308,13 @@ void character_cleanup (void);
 void character_options_load (void);
 void character_options_save (void);
 void character_vitals_calibrate (void);
-void character_triggers_parse (gchar *str);
+void character_hp_update (gint now);
+void character_ma_update (gint now);
+void character_triggers_reset (void);
+void character_triggers_advance (guchar ch, gsize length);
+void character_triggers_truncate (gsize length);
+gboolean character_triggers_matching (gsize length);
+void character_triggers_parse (gsize length);
 void character_equipment_disarmed (void);
 gint character_race_as_int (gchar *str);
 const gchar *character_race_as_str (gint value);
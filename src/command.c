@@ -425,6 +425,36 @@ void command_timers_update (void)
 }
 
 
+/* =========================================================================
+ = COMMAND_TIMERS_NEXT_TIMEOUT
+ =
+ = Microseconds until the first pending command times out
+ ======================================================================== */
+
+gulong command_timers_next_timeout (void)
+{
+	GSList *node;
+	command_t *command;
+	GTimeVal now;
+	glong usec;
+	gulong next = G_MAXULONG;
+
+	g_get_current_time (&now);
+
+	for (node = character.commands; node; node = node->next)
+	{
+		if ((command = node->data) == NULL)
+			break;
+
+		usec = (command->timeout.tv_sec - now.tv_sec) * G_USEC_PER_SEC
+			+ (command->timeout.tv_usec - now.tv_usec);
+
+		next = MIN (next, (gulong) MAX (usec, 0));
+	}
+	return next;
+}
+
+
 /* =========================================================================
  = COMMAND_PENDING
  =
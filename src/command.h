@@ -58,6 +58,7 @@ gboolean command_del (gint type);
 void command_recall (void);
 void command_list_free (GSList *slist);
 void command_timers_update (void);
+gulong command_timers_next_timeout (void);
 gboolean command_pending (gint type);
 
 #endif /* __COMMAND_H__ */
@@ -0,0 +1,1080 @@
+/*  MudPRO: An advanced client for the online game MajorMUD
+ *  Copyright (C) 2002-2018  David Slusky
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "dfa.h"
+
+#define SET_ADD(set, b) ((set)[(b) >> 3] |= (1 << ((b) & 7)))
+#define SET_HAS(set, b) ((set)[(b) >> 3] & (1 << ((b) & 7)))
+
+typedef struct /* partially built NFA, end state is left dangling */
+{
+	gint start;
+	gint end;
+} dfa_frag_t;
+
+typedef struct
+{
+	dfa_t *dfa;
+	const gchar *p;   /* current position */
+	const gchar *end; /* end of pattern body (trailing '$') */
+	gboolean error;   /* pattern uses something we cannot handle */
+} dfa_parser_t;
+
+static gint dfa_nfa_new (dfa_t *dfa, gint type, gint out, gint out1, gint arg);
+static gint dfa_set_new (dfa_t *dfa);
+static gboolean dfa_byte_in_class (gchar type, guchar b);
+static gboolean dfa_escape_byte (gchar c, gboolean in_class, guchar *b);
+static gboolean dfa_set_add_escape (guchar *set, gchar c, gboolean in_class);
+static gboolean dfa_set_add_posix (guchar *set, const gchar *name, gint len);
+static dfa_frag_t dfa_frag_set (dfa_t *dfa, gint set);
+static dfa_frag_t dfa_frag_empty (dfa_t *dfa);
+static dfa_frag_t dfa_frag_cat (dfa_t *dfa, dfa_frag_t a, dfa_frag_t b);
+static dfa_frag_t dfa_frag_alt (dfa_t *dfa, dfa_frag_t a, dfa_frag_t b);
+static dfa_frag_t dfa_frag_optional (dfa_t *dfa, dfa_frag_t a);
+static dfa_frag_t dfa_frag_star (dfa_t *dfa, dfa_frag_t a);
+static dfa_frag_t dfa_frag_plus (dfa_t *dfa, dfa_frag_t a);
+static gboolean dfa_parse_count (dfa_parser_t *ps, const gchar *p,
+	gint *min, gint *max, const gchar **next);
+static gboolean dfa_parse_class (dfa_parser_t *ps, guchar *set);
+static dfa_frag_t dfa_parse_atom (dfa_parser_t *ps);
+static dfa_frag_t dfa_parse_repeat (dfa_parser_t *ps);
+static dfa_frag_t dfa_parse_concat (dfa_parser_t *ps);
+static dfa_frag_t dfa_parse_alt (dfa_parser_t *ps);
+static void dfa_classes_build (dfa_t *dfa);
+static guint dfa_state_hash (gconstpointer key);
+static gboolean dfa_state_equal (gconstpointer a, gconstpointer b);
+static gint dfa_int_compare (const void *a, const void *b);
+static gint dfa_closure (dfa_t *dfa, gint sp);
+static gint dfa_state_intern (dfa_t *dfa, gint count);
+static void dfa_cache_flush (dfa_t *dfa);
+static gint dfa_start_state (dfa_t *dfa);
+static gint dfa_step (dfa_t *dfa, gint current, gint cls);
+
+
+/* =========================================================================
+ = DFA_NEW
+ =
+ = Allocate an empty automaton
+ ======================================================================== */
+
+dfa_t *dfa_new (void)
+{
+	dfa_t *dfa = g_malloc0 (sizeof (dfa_t));
+
+	dfa->start = -1;
+
+	return dfa;
+}
+
+
+/* =========================================================================
+ = DFA_FREE
+ =
+ = Free memory allocated to automaton
+ ======================================================================== */
+
+void dfa_free (dfa_t *dfa)
+{
+	if (!dfa)
+		return;
+
+	if (dfa->cache)
+	{
+		dfa_cache_flush (dfa);
+		g_hash_table_destroy (dfa->cache);
+	}
+
+	g_free (dfa->states);
+	g_free (dfa->nfa);
+	g_free (dfa->sets);
+	g_free (dfa->starts);
+	g_free (dfa->data);
+	g_free (dfa->stack);
+	g_free (dfa->scratch);
+	g_free (dfa->marks);
+	g_free (dfa);
+}
+
+
+/* =========================================================================
+ = DFA_NFA_NEW
+ =
+ = Append a new NFA state, returns its index
+ ======================================================================== */
+
+static gint dfa_nfa_new (dfa_t *dfa, gint type, gint out, gint out1, gint arg)
+{
+	dfa_nfa_t *nfa;
+
+	if (dfa->nfa_count == dfa->nfa_max)
+	{
+		dfa->nfa_max = MAX (256, dfa->nfa_max * 2);
+		dfa->nfa = g_realloc (dfa->nfa, dfa->nfa_max * sizeof (dfa_nfa_t));
+	}
+
+	nfa = &dfa->nfa[dfa->nfa_count];
+	nfa->type = type;
+	nfa->out  = out;
+	nfa->out1 = out1;
+	nfa->arg  = arg;
+
+	return dfa->nfa_count++;
+}
+
+
+/* =========================================================================
+ = DFA_SET_NEW
+ =
+ = Append a new (empty) byte set, returns its index
+ ======================================================================== */
+
+static gint dfa_set_new (dfa_t *dfa)
+{
+	if (dfa->set_count == dfa->set_max)
+	{
+		dfa->set_max = MAX (256, dfa->set_max * 2);
+		dfa->sets = g_realloc (dfa->sets, dfa->set_max * sizeof (dfa->sets[0]));
+	}
+
+	memset (dfa->sets[dfa->set_count], 0, sizeof (dfa->sets[0]));
+
+	return dfa->set_count++;
+}
+
+
+/* =========================================================================
+ = DFA_BYTE_IN_CLASS
+ =
+ = Test byte against \d, \w or \s (PCRE defaults, ASCII only)
+ ======================================================================== */
+
+static gboolean dfa_byte_in_class (gchar type, guchar b)
+{
+	switch (tolower (type))
+	{
+	case 'd': return (b >= '0' && b <= '9');
+	case 'w': return (b < 128 && (isalnum (b) || b == '_'));
+	case 's': return (b == ' ' || (b >= '\t' && b <= '\r'));
+	}
+
+	g_assert_not_reached ();
+	return FALSE;
+}
+
+
+/* =========================================================================
+ = DFA_ESCAPE_BYTE
+ =
+ = Resolve an escape matching a single byte, FALSE if it isn't one
+ ======================================================================== */
+
+static gboolean dfa_escape_byte (gchar c, gboolean in_class, guchar *b)
+{
+	switch (c)
+	{
+	case 'a': *b = '\a'; return TRUE;
+	case 'e': *b = 27;   return TRUE;
+	case 'f': *b = '\f'; return TRUE;
+	case 'n': *b = '\n'; return TRUE;
+	case 'r': *b = '\r'; return TRUE;
+	case 't': *b = '\t'; return TRUE;
+	case 'b': /* backspace in a class, word boundary otherwise */
+		*b = '\b';
+		return in_class;
+	}
+
+	if (c == '\0' || isalnum ((guchar) c))
+		return FALSE; /* backrefs, \x, \Q, assertions, etc */
+
+	*b = (guchar) c;
+	return TRUE;
+}
+
+
+/* =========================================================================
+ = DFA_SET_ADD_ESCAPE
+ =
+ = Add bytes matched by escape to set, FALSE if escape is unsupported
+ ======================================================================== */
+
+static gboolean dfa_set_add_escape (guchar *set, gchar c, gboolean in_class)
+{
+	gboolean want = islower ((guchar) c) ? TRUE : FALSE;
+	guchar b;
+	gint i;
+
+	if (strchr ("dDwWsS", c))
+	{
+		for (i = 0; i < 256; i++)
+			if (dfa_byte_in_class (c, i) == want)
+				SET_ADD (set, i);
+		return TRUE;
+	}
+
+	if (!dfa_escape_byte (c, in_class, &b))
+		return FALSE;
+
+	SET_ADD (set, b);
+	return TRUE;
+}
+
+
+/* =========================================================================
+ = DFA_SET_ADD_POSIX
+ =
+ = Add bytes matched by a [:name:] class to set
+ ======================================================================== */
+
+static gboolean dfa_set_add_posix (guchar *set, const gchar *str, gint len)
+{
+	gchar name[8];
+	gint i, match;
+
+	if (len <= 0 || len >= sizeof (name))
+		return FALSE;
+
+	memcpy (name, str, len);
+	name[len] = '\0';
+
+	for (i = 0; i < 128; i++)
+	{
+		if (!strcmp (name, "alpha"))       match = isalpha (i);
+		else if (!strcmp (name, "digit"))  match = isdigit (i);
+		else if (!strcmp (name, "alnum"))  match = isalnum (i);
+		else if (!strcmp (name, "space"))  match = isspace (i);
+		else if (!strcmp (name, "upper"))  match = isupper (i);
+		else if (!strcmp (name, "lower"))  match = islower (i);
+		else if (!strcmp (name, "punct"))  match = ispunct (i);
+		else if (!strcmp (name, "print"))  match = isprint (i);
+		else if (!strcmp (name, "graph"))  match = isgraph (i);
+		else if (!strcmp (name, "cntrl"))  match = iscntrl (i);
+		else if (!strcmp (name, "xdigit")) match = isxdigit (i);
+		else if (!strcmp (name, "blank"))  match = (i == ' ' || i == '\t');
+		else if (!strcmp (name, "word"))   match = (isalnum (i) || i == '_');
+		else
+			return FALSE;
+
+		if (match)
+			SET_ADD (set, i);
+	}
+
+	return TRUE;
+}
+
+
+/* =========================================================================
+ = DFA_FRAG_*
+ =
+ = Thompson construction of NFA fragments
+ ======================================================================== */
+
+static dfa_frag_t dfa_frag_set (dfa_t *dfa, gint set)
+{
+	dfa_frag_t f;
+
+	f.end   = dfa_nfa_new (dfa, DFA_NFA_EMPTY, -1, -1, 0);
+	f.start = dfa_nfa_new (dfa, DFA_NFA_CHAR, f.end, -1, set);
+
+	return f;
+}
+
+static dfa_frag_t dfa_frag_empty (dfa_t *dfa)
+{
+	dfa_frag_t f;
+
+	f.start = f.end = dfa_nfa_new (dfa, DFA_NFA_EMPTY, -1, -1, 0);
+
+	return f;
+}
+
+static dfa_frag_t dfa_frag_cat (dfa_t *dfa, dfa_frag_t a, dfa_frag_t b)
+{
+	dfa_frag_t f;
+
+	dfa->nfa[a.end].out = b.start;
+
+	f.start = a.start;
+	f.end   = b.end;
+
+	return f;
+}
+
+static dfa_frag_t dfa_frag_alt (dfa_t *dfa, dfa_frag_t a, dfa_frag_t b)
+{
+	dfa_frag_t f;
+
+	f.end   = dfa_nfa_new (dfa, DFA_NFA_EMPTY, -1, -1, 0);
+	f.start = dfa_nfa_new (dfa, DFA_NFA_SPLIT, a.start, b.start, 0);
+
+	dfa->nfa[a.end].out = f.end;
+	dfa->nfa[b.end].out = f.end;
+
+	return f;
+}
+
+static dfa_frag_t dfa_frag_optional (dfa_t *dfa, dfa_frag_t a)
+{
+	dfa_frag_t f;
+
+	f.end   = dfa_nfa_new (dfa, DFA_NFA_EMPTY, -1, -1, 0);
+	f.start = dfa_nfa_new (dfa, DFA_NFA_SPLIT, a.start, f.end, 0);
+
+	dfa->nfa[a.end].out = f.end;
+
+	return f;
+}
+
+static dfa_frag_t dfa_frag_star (dfa_t *dfa, dfa_frag_t a)
+{
+	dfa_frag_t f;
+
+	f.end   = dfa_nfa_new (dfa, DFA_NFA_EMPTY, -1, -1, 0);
+	f.start = dfa_nfa_new (dfa, DFA_NFA_SPLIT, a.start, f.end, 0);
+
+	dfa->nfa[a.end].out = f.start;
+
+	return f;
+}
+
+static dfa_frag_t dfa_frag_plus (dfa_t *dfa, dfa_frag_t a)
+{
+	dfa_frag_t f = dfa_frag_star (dfa, a);
+
+	f.start = a.start;
+
+	return f;
+}
+
+
+/* =========================================================================
+ = DFA_PARSE_COUNT
+ =
+ = Parse a {n}, {n,} or {n,m} quantifier at p. Returns FALSE if p does
+ = not start one (PCRE treats the brace as a literal)
+ ======================================================================== */
+
+static gboolean dfa_parse_count (dfa_parser_t *ps, const gchar *p,
+	gint *min, gint *max, const gchar **next)
+{
+	g_assert (*p == '{');
+
+	if (++p >= ps->end || !isdigit ((guchar) *p))
+		return FALSE;
+
+	*min = atoi (p);
+	while (p < ps->end && isdigit ((guchar) *p)) p++;
+
+	*max = *min;
+
+	if (p < ps->end && *p == ',')
+	{
+		p++;
+		*max = (p < ps->end && isdigit ((guchar) *p)) ? atoi (p) : -1;
+		while (p < ps->end && isdigit ((guchar) *p)) p++;
+	}
+
+	if (p >= ps->end || *p != '}')
+		return FALSE;
+
+	*next = p + 1;
+
+	if (*min > DFA_REPEAT_MAX || *max > DFA_REPEAT_MAX ||
+		(*max >= 0 && *max < *min))
+		ps->error = TRUE;
+
+	return TRUE;
+}
+
+
+/* =========================================================================
+ = DFA_PARSE_CLASS
+ =
+ = Parse a [...] character class into set
+ ======================================================================== */
+
+static gboolean dfa_parse_class (dfa_parser_t *ps, guchar *set)
+{
+	guchar items[32];
+	guchar lo, hi;
+	gboolean negate = FALSE, first = TRUE;
+	const gchar *close;
+	gint i;
+
+	memset (items, 0, sizeof (items));
+
+	ps->p++; /* opening bracket */
+
+	if (ps->p < ps->end && *ps->p == '^')
+	{
+		negate = TRUE;
+		ps->p++;
+	}
+
+	for (;; first = FALSE)
+	{
+		if (ps->p >= ps->end)
+			return FALSE;
+
+		if (*ps->p == ']' && !first)
+		{
+			ps->p++;
+			break;
+		}
+
+		if (*ps->p == '[' && ps->p[1] == ':')
+		{
+			if ((close = strstr (ps->p + 2, ":]")) == NULL || close >= ps->end)
+				return FALSE;
+			if (!dfa_set_add_posix (items, ps->p + 2, close - (ps->p + 2)))
+				return FALSE;
+			ps->p = close + 2;
+			continue;
+		}
+
+		if (*ps->p == '\\')
+		{
+			if (ps->p + 1 >= ps->end)
+				return FALSE;
+
+			ps->p += 2;
+
+			if (strchr ("dDwWsS", ps->p[-1]))
+			{
+				dfa_set_add_escape (items, ps->p[-1], TRUE);
+				continue;
+			}
+			if (!dfa_escape_byte (ps->p[-1], TRUE, &lo))
+				return FALSE;
+		}
+		else
+			lo = *(ps->p++);
+
+		if (ps->p + 1 < ps->end && *ps->p == '-' && ps->p[1] != ']')
+		{
+			ps->p++;
+
+			if (*ps->p == '\\')
+			{
+				if (ps->p + 1 >= ps->end)
+					return FALSE;
+				ps->p += 2;
+				if (!dfa_escape_byte (ps->p[-1], TRUE, &hi))
+					return FALSE;
+			}
+			else if (*ps->p == '[')
+				return FALSE;
+			else
+				hi = *(ps->p++);
+
+			if (hi < lo)
+				return FALSE;
+
+			for (i = lo; i <= hi; i++)
+				SET_ADD (items, i);
+		}
+		else
+			SET_ADD (items, lo);
+	}
+
+	for (i = 0; i < 32; i++)
+		set[i] = negate ? ~items[i] : items[i];
+
+	return TRUE;
+}
+
+
+/* =========================================================================
+ = DFA_PARSE_ATOM
+ =
+ = Parse a single character, class or group
+ ======================================================================== */
+
+static dfa_frag_t dfa_parse_atom (dfa_parser_t *ps)
+{
+	dfa_frag_t f;
+	const gchar *next;
+	gint set, min, max;
+	guchar b;
+
+	switch (*ps->p)
+	{
+	case '(':
+		ps->p++;
+
+		if (ps->p < ps->end && *ps->p == '?')
+		{
+			if (ps->p + 1 >= ps->end || ps->p[1] != ':')
+			{
+				ps->error = TRUE; /* lookaround, options, named groups */
+				return dfa_frag_empty (ps->dfa);
+			}
+			ps->p += 2;
+		}
+
+		f = dfa_parse_alt (ps);
+
+		if (!ps->error && (ps->p >= ps->end || *ps->p != ')'))
+			ps->error = TRUE;
+		else
+			ps->p++;
+
+		return f;
+
+	case '[':
+		set = dfa_set_new (ps->dfa);
+		if (!dfa_parse_class (ps, ps->dfa->sets[set]))
+			ps->error = TRUE;
+		return dfa_frag_set (ps->dfa, set);
+
+	case '.':
+		set = dfa_set_new (ps->dfa);
+		memset (ps->dfa->sets[set], 0xff, sizeof (ps->dfa->sets[0]));
+		ps->dfa->sets[set]['\n' >> 3] &= ~(1 << ('\n' & 7));
+		ps->p++;
+		return dfa_frag_set (ps->dfa, set);
+
+	case '\\':
+		set = dfa_set_new (ps->dfa);
+		if (ps->p + 1 >= ps->end ||
+			!dfa_set_add_escape (ps->dfa->sets[set], ps->p[1], FALSE))
+			ps->error = TRUE;
+		ps->p += 2;
+		return dfa_frag_set (ps->dfa, set);
+
+	case '{':
+		if (dfa_parse_count (ps, ps->p, &min, &max, &next))
+			ps->error = TRUE; /* nothing to repeat */
+		break;
+
+	case '*':
+	case '+':
+	case '?':
+	case '^':
+	case '$':
+		ps->error = TRUE;
+		return dfa_frag_empty (ps->dfa);
+	}
+
+	b = *(ps->p++);
+	set = dfa_set_new (ps->dfa);
+	SET_ADD (ps->dfa->sets[set], b);
+
+	return dfa_frag_set (ps->dfa, set);
+}
+
+
+/* =========================================================================
+ = DFA_PARSE_REPEAT
+ =
+ = Parse an atom and any quantifier following it
+ ======================================================================== */
+
+static dfa_frag_t dfa_parse_repeat (dfa_parser_t *ps)
+{
+	dfa_frag_t f, g, r;
+	const gchar *atom = ps->p, *next;
+	gint min, max, i, copies = 0;
+	gboolean have = FALSE;
+
+	f = dfa_parse_atom (ps);
+
+	if (ps->error || ps->p >= ps->end)
+		return f;
+
+	switch (*ps->p)
+	{
+	case '?':
+		f = dfa_frag_optional (ps->dfa, f);
+		ps->p++;
+		break;
+
+	case '*':
+		f = dfa_frag_star (ps->dfa, f);
+		ps->p++;
+		break;
+
+	case '+':
+		f = dfa_frag_plus (ps->dfa, f);
+		ps->p++;
+		break;
+
+	case '{':
+		if (!dfa_parse_count (ps, ps->p, &min, &max, &next))
+			return f; /* literal brace, handled as the next atom */
+
+		if (ps->error)
+			return f;
+
+		/* expand by parsing the atom again for each extra copy */
+		for (i = 0; i < MAX (min, max); i++)
+		{
+			if (copies++)
+			{
+				ps->p = atom;
+				g = dfa_parse_atom (ps);
+			}
+			else
+				g = f;
+
+			if (i >= min)
+				g = dfa_frag_optional (ps->dfa, g);
+
+			r = have ? dfa_frag_cat (ps->dfa, r, g) : g;
+			have = TRUE;
+		}
+
+		if (max < 0)
+		{
+			if (copies++)
+			{
+				ps->p = atom;
+				g = dfa_parse_atom (ps);
+			}
+			else
+				g = f;
+
+			g = dfa_frag_star (ps->dfa, g);
+			r = have ? dfa_frag_cat (ps->dfa, r, g) : g;
+			have = TRUE;
+		}
+
+		f = have ? r : dfa_frag_empty (ps->dfa);
+		ps->p = next;
+		break;
+
+	default:
+		return f;
+	}
+
+	if (ps->p < ps->end && *ps->p == '?')
+		ps->p++; /* lazy quantifiers accept the same lines */
+
+	if (ps->p < ps->end && (*ps->p == '+' || *ps->p == '*' || *ps->p == '?' ||
+		(*ps->p == '{' && dfa_parse_count (ps, ps->p, &min, &max, &next))))
+		ps->error = TRUE; /* possessive, or nothing to repeat */
+
+	return f;
+}
+
+
+/* =========================================================================
+ = DFA_PARSE_CONCAT
+ =
+ = Parse a sequence of atoms
+ ======================================================================== */
+
+static dfa_frag_t dfa_parse_concat (dfa_parser_t *ps)
+{
+	dfa_frag_t f = dfa_frag_empty (ps->dfa);
+
+	while (!ps->error && ps->p < ps->end && *ps->p != '|' && *ps->p != ')')
+		f = dfa_frag_cat (ps->dfa, f, dfa_parse_repeat (ps));
+
+	return f;
+}
+
+
+/* =========================================================================
+ = DFA_PARSE_ALT
+ =
+ = Parse alternatives
+ ======================================================================== */
+
+static dfa_frag_t dfa_parse_alt (dfa_parser_t *ps)
+{
+	dfa_frag_t f = dfa_parse_concat (ps);
+
+	while (!ps->error && ps->p < ps->end && *ps->p == '|')
+	{
+		ps->p++;
+		f = dfa_frag_alt (ps->dfa, f, dfa_parse_concat (ps));
+	}
+
+	return f;
+}
+
+
+/* =========================================================================
+ = DFA_ADD
+ =
+ = Add an anchored ^...$ pattern to the automaton. Returns FALSE if the
+ = pattern uses features the automaton cannot represent
+ ======================================================================== */
+
+gboolean dfa_add (dfa_t *dfa, const gchar *pattern, gpointer data)
+{
+	dfa_parser_t ps;
+	dfa_frag_t f;
+	const gchar *p;
+	gint len, nfa_count, set_count, escapes = 0;
+
+	g_assert (dfa != NULL);
+	g_assert (pattern != NULL);
+	g_assert (dfa->cache == NULL); /* must come before dfa_compile */
+
+	len = strlen (pattern);
+
+	if (len < 2 || pattern[0] != '^' || pattern[len-1] != '$')
+		return FALSE;
+
+	/* make sure the trailing anchor isn't an escaped dollar sign */
+	for (p = pattern + len - 2; p > pattern && *p == '\\'; p--)
+		escapes++;
+
+	if (escapes % 2)
+		return FALSE;
+
+	nfa_count = dfa->nfa_count;
+	set_count = dfa->set_count;
+
+	ps.dfa   = dfa;
+	ps.p     = pattern + 1;
+	ps.end   = pattern + len - 1;
+	ps.error = FALSE;
+
+	f = dfa_parse_alt (&ps);
+
+	if (ps.error || ps.p != ps.end)
+	{
+		dfa->nfa_count = nfa_count;
+		dfa->set_count = set_count;
+		return FALSE;
+	}
+
+	dfa->nfa[f.end].out = dfa_nfa_new (dfa,
+		DFA_NFA_MATCH, -1, -1, dfa->patterns);
+
+	if (dfa->patterns == dfa->pattern_max)
+	{
+		dfa->pattern_max = MAX (64, dfa->pattern_max * 2);
+		dfa->starts = g_realloc (dfa->starts, dfa->pattern_max * sizeof (gint));
+		dfa->data = g_realloc (dfa->data, dfa->pattern_max * sizeof (gpointer));
+	}
+
+	dfa->starts[dfa->patterns] = f.start;
+	dfa->data[dfa->patterns] = data;
+	dfa->patterns++;
+
+	return TRUE;
+}
+
+
+/* =========================================================================
+ = DFA_CLASSES_BUILD
+ =
+ = Partition bytes into classes no byte set can tell apart
+ ======================================================================== */
+
+static void dfa_classes_build (dfa_t *dfa)
+{
+	guchar next[256];
+	gint map[512];
+	gint i, b, key, count;
+
+	memset (dfa->classes, 0, sizeof (dfa->classes));
+	dfa->class_count = 1;
+
+	for (i = 0; i < dfa->set_count; i++)
+	{
+		for (key = 0; key < dfa->class_count * 2; key++)
+			map[key] = -1;
+
+		for (b = 0, count = 0; b < 256; b++)
+		{
+			key = dfa->classes[b] * 2 + (SET_HAS (dfa->sets[i], b) ? 1 : 0);
+			if (map[key] < 0)
+				map[key] = count++;
+			next[b] = map[key];
+		}
+
+		memcpy (dfa->classes, next, sizeof (dfa->classes));
+		dfa->class_count = count;
+	}
+
+	for (b = 255; b >= 0; b--)
+		dfa->class_rep[dfa->classes[b]] = b;
+}
+
+
+/* =========================================================================
+ = DFA_COMPILE
+ =
+ = Prepare automaton for matching (must follow the last dfa_add)
+ ======================================================================== */
+
+void dfa_compile (dfa_t *dfa)
+{
+	g_assert (dfa != NULL);
+
+	dfa_classes_build (dfa);
+
+	dfa->stack   = g_malloc ((dfa->nfa_count * 3 + 1) * sizeof (gint));
+	dfa->scratch = g_malloc ((dfa->nfa_count + 1) * sizeof (gint));
+	dfa->marks   = g_malloc0 ((dfa->nfa_count + 1) * sizeof (guint));
+	dfa->states  = g_malloc0 (DFA_CACHE_MAX * sizeof (dfa_state_t *));
+	dfa->cache   = g_hash_table_new (dfa_state_hash, dfa_state_equal);
+	dfa->mark    = 0;
+	dfa->start   = -1;
+}
+
+
+/* =========================================================================
+ = DFA_STATE_HASH / DFA_STATE_EQUAL
+ =
+ = Hash table callbacks keyed on a DFA state's NFA state set
+ ======================================================================== */
+
+static guint dfa_state_hash (gconstpointer key)
+{
+	const dfa_state_t *state = key;
+	guint hash = 2166136261U;
+	gint i;
+
+	for (i = 0; i < state->count; i++)
+		hash = (hash ^ (guint) state->nfa[i]) * 16777619U;
+
+	return hash;
+}
+
+static gboolean dfa_state_equal (gconstpointer a, gconstpointer b)
+{
+	const dfa_state_t *x = a, *y = b;
+
+	return (x->count == y->count &&
+		!memcmp (x->nfa, y->nfa, x->count * sizeof (gint)));
+}
+
+static gint dfa_int_compare (const void *a, const void *b)
+{
+	return *(const gint *) a - *(const gint *) b;
+}
+
+
+/* =========================================================================
+ = DFA_CLOSURE
+ =
+ = Epsilon closure of the sp states on the stack, result in scratch
+ ======================================================================== */
+
+static gint dfa_closure (dfa_t *dfa, gint sp)
+{
+	dfa_nfa_t *nfa;
+	gint state, count = 0;
+
+	if (++dfa->mark == 0)
+	{
+		memset (dfa->marks, 0, (dfa->nfa_count + 1) * sizeof (guint));
+		dfa->mark = 1;
+	}
+
+	while (sp > 0)
+	{
+		state = dfa->stack[--sp];
+
+		if (state < 0 || dfa->marks[state] == dfa->mark)
+			continue;
+
+		dfa->marks[state] = dfa->mark;
+		nfa = &dfa->nfa[state];
+
+		switch (nfa->type)
+		{
+		case DFA_NFA_SPLIT:
+			dfa->stack[sp++] = nfa->out1;
+			/* fall through */
+		case DFA_NFA_EMPTY:
+			dfa->stack[sp++] = nfa->out;
+			break;
+		default:
+			dfa->scratch[count++] = state;
+		}
+	}
+
+	qsort (dfa->scratch, count, sizeof (gint), dfa_int_compare);
+
+	return count;
+}
+
+
+/* =========================================================================
+ = DFA_STATE_INTERN
+ =
+ = Returns the cached DFA state for the NFA set in scratch, creating it
+ = (and flushing the cache if it is full) as needed
+ ======================================================================== */
+
+static gint dfa_state_intern (dfa_t *dfa, gint count)
+{
+	dfa_state_t key, *state;
+	gpointer index;
+	gint i;
+
+	key.nfa   = dfa->scratch;
+	key.count = count;
+
+	if ((index = g_hash_table_lookup (dfa->cache, &key)) != NULL)
+		return GPOINTER_TO_INT (index) - 1;
+
+	if (dfa->state_count >= DFA_CACHE_MAX)
+		dfa_cache_flush (dfa);
+
+	state = g_malloc0 (sizeof (dfa_state_t));
+	state->count = count;
+	state->nfa = g_malloc ((count + 1) * sizeof (gint));
+	memcpy (state->nfa, dfa->scratch, count * sizeof (gint));
+
+	state->matches = g_malloc ((count + 1) * sizeof (gint));
+	for (i = 0; i < count; i++)
+		if (dfa->nfa[state->nfa[i]].type == DFA_NFA_MATCH)
+			state->matches[state->match_count++] = dfa->nfa[state->nfa[i]].arg;
+
+	state->next = g_malloc (dfa->class_count * sizeof (gint));
+	for (i = 0; i < dfa->class_count; i++)
+		state->next[i] = -1;
+
+	dfa->states[dfa->state_count] = state;
+	g_hash_table_insert (dfa->cache, state, GINT_TO_POINTER (dfa->state_count + 1));
+
+	return dfa->state_count++;
+}
+
+
+/* =========================================================================
+ = DFA_CACHE_FLUSH
+ =
+ = Discard all cached DFA states
+ ======================================================================== */
+
+static void dfa_cache_flush (dfa_t *dfa)
+{
+	dfa_state_t *state;
+	gint i;
+
+	g_hash_table_remove_all (dfa->cache);
+
+	for (i = 0; i < dfa->state_count; i++)
+	{
+		state = dfa->states[i];
+		g_free (state->nfa);
+		g_free (state->matches);
+		g_free (state->next);
+		g_free (state);
+	}
+
+	dfa->state_count = 0;
+	dfa->start = -1;
+	dfa->flushes++;
+}
+
+
+/* =========================================================================
+ = DFA_START_STATE
+ =
+ = Returns the start state, where every pattern is still possible
+ ======================================================================== */
+
+static gint dfa_start_state (dfa_t *dfa)
+{
+	gint start;
+
+	if (dfa->start < 0)
+	{
+		memcpy (dfa->stack, dfa->starts, dfa->patterns * sizeof (gint));
+		start = dfa_state_intern (dfa, dfa_closure (dfa, dfa->patterns));
+		dfa->start = start;
+	}
+
+	return dfa->start;
+}
+
+
+/* =========================================================================
+ = DFA_STEP
+ =
+ = Compute (and cache) the transition from current on byte class cls
+ ======================================================================== */
+
+static gint dfa_step (dfa_t *dfa, gint current, gint cls)
+{
+	dfa_state_t *state = dfa->states[current];
+	dfa_nfa_t *nfa;
+	gulong flushes = dfa->flushes;
+	guchar b = dfa->class_rep[cls];
+	gint i, next, sp = 0;
+
+	for (i = 0; i < state->count; i++)
+	{
+		nfa = &dfa->nfa[state->nfa[i]];
+
+		if (nfa->type == DFA_NFA_CHAR && SET_HAS (dfa->sets[nfa->arg], b))
+			dfa->stack[sp++] = nfa->out;
+	}
+
+	next = dfa_state_intern (dfa, dfa_closure (dfa, sp));
+
+	if (flushes == dfa->flushes) /* otherwise state is gone */
+		state->next[cls] = next;
+
+	return next;
+}
+
+
+/* =========================================================================
+ = DFA_EXEC
+ =
+ = Run subject through the automaton, calling func with the data of each
+ = pattern matching the entire subject
+ ======================================================================== */
+
+void dfa_exec (dfa_t *dfa, const gchar *subject, gint len,
+	GFunc func, gpointer user_data)
+{
+	const guchar *p, *end;
+	dfa_state_t *state;
+	gint current, next, i;
+
+	g_assert (dfa != NULL);
+	g_assert (dfa->cache != NULL);
+
+	if (!dfa->patterns)
+		return;
+
+	current = dfa_start_state (dfa);
+
+	for (p = (const guchar *) subject, end = p + len; p < end; p++)
+	{
+		state = dfa->states[current];
+
+		if (!state->count)
+			return; /* dead state, no pattern can match */
+
+		if ((next = state->next[dfa->classes[*p]]) < 0)
+			next = dfa_step (dfa, current, dfa->classes[*p]);
+
+		current = next;
+	}
+
+	state = dfa->states[current];
+
+	for (i = 0; i < state->match_count; i++)
+		func (dfa->data[state->matches[i]], user_data);
+}
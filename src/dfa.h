@@ -0,0 +1,80 @@
+/*  MudPRO: An advanced client for the online game MajorMUD
+ *  Copyright (C) 2002-2018  David Slusky
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+#ifndef __DFA_H__
+#define __DFA_H__
+
+#include <glib.h>
+
+#define DFA_CACHE_MAX  4096 /* cached DFA states before the cache is flushed */
+#define DFA_REPEAT_MAX 64   /* largest {n,m} repetition we will expand */
+
+enum /* NFA state types */
+{
+	DFA_NFA_EMPTY, /* epsilon transition to out */
+	DFA_NFA_SPLIT, /* epsilon transitions to out and out1 */
+	DFA_NFA_CHAR,  /* consume a byte from set arg, continue at out */
+	DFA_NFA_MATCH, /* pattern arg accepted */
+};
+
+typedef struct
+{
+	gint type;     /* NFA state type */
+	gint out;      /* next state */
+	gint out1;     /* alternate next state (split) */
+	gint arg;      /* byte set (char) or pattern id (match) */
+} dfa_nfa_t;
+
+typedef struct
+{
+	gint *nfa;     /* sorted NFA states making up this DFA state */
+	gint count;    /* NFA state count */
+	gint *matches; /* pattern ids accepted in this state */
+	gint match_count;
+	gint *next;    /* transition per byte class (-1 if not yet computed) */
+} dfa_state_t;
+
+typedef struct /* lazily built DFA over the union of anchored patterns */
+{
+	dfa_nfa_t *nfa;
+	gint nfa_count, nfa_max;
+	guchar (*sets)[32];      /* byte sets for DFA_NFA_CHAR states */
+	gint set_count, set_max;
+	gint *starts;            /* start state for each pattern */
+	gpointer *data;          /* user data for each pattern */
+	gint patterns, pattern_max;
+	guchar classes[256];     /* byte -> equivalence class */
+	guchar class_rep[256];   /* class -> representative byte */
+	gint class_count;
+	dfa_state_t **states;    /* cached DFA states */
+	gint state_count;
+	gint start;              /* start DFA state (-1 if not cached) */
+	GHashTable *cache;       /* NFA state set -> DFA state */
+	gint *stack, *scratch;   /* work areas sized to nfa_count */
+	guint *marks, mark;
+	gulong flushes;          /* number of times the cache was flushed */
+} dfa_t;
+
+dfa_t *dfa_new (void);
+void dfa_free (dfa_t *dfa);
+gboolean dfa_add (dfa_t *dfa, const gchar *pattern, gpointer data);
+void dfa_compile (dfa_t *dfa);
+void dfa_exec (dfa_t *dfa, const gchar *subject, gint len,
+	GFunc func, gpointer user_data);
+
+#endif /* __DFA_H__ */
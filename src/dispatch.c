@@ -40,95 +40,506 @@
 #include "terminal.h"
 #include "utils.h"
 
-#define SUBSTR_SIZE 1024
+/* captures of the current match, converted at most once per match */
+#define CAPTURE_SPAN(x)      parse_capture_span (captures, x)
+#define CAPTURE_STR(x)       parse_capture_str (captures, x)
+#define CAPTURE_INT(x)       parse_capture_int (captures, x)
+#define CAPTURE_DIRECTION(x) parse_capture_direction (captures, x)
 
-#define GET_PCRE_SUBSTR(x) \
-    pcre_copy_substring (subject, ovector, strings, x, pcre_substr, SUBSTR_SIZE)
+enum /* parse action types (parse_action_t op) */
+{
+    ACT_AUDITLOG,
+    ACT_AUTOMAP,
+    ACT_CHARACTER,
+    ACT_CHATLOG,
+    ACT_CLEANUP_EVENT,
+    ACT_COMBAT,
+    ACT_COMMAND_DEL,
+    ACT_COMMAND_RECALL,
+    ACT_COMMAND_SEND,
+    ACT_COMMAND_SPEAK,
+    ACT_DAMAGE_DELT,
+    ACT_DISCONNECT,
+    ACT_ITEM,
+    ACT_NAVIGATION,
+    ACT_OSD_DOCK,
+    ACT_PARSE_COMMAND,
+    ACT_PLAYER,
+    ACT_PRINT_STATS,
+    ACT_PRINT_TERM,
+    ACT_RANDOM_TAUNT,
+    ACT_REQUIRE,
+    ACT_REQUIRE_FLAG,
+    ACT_REQUIRE_OPTION,
+    ACT_REQUIRE_ROOM,
+    ACT_REQUIRE_STATE,
+    ACT_RESET_STATE,
+    ACT_ROUND_SYNC,
+    ACT_SEND_LINE,
+    ACT_SET_FLAG,
+    ACT_SET_STATE,
+    ACT_SET_STATUS,
+    ACT_STATS,
+    ACT_TARGET,
+    ACT_VITALS_OSD,
+    ACT_MAX
+};
+
+enum /* parse action arguments (parse_action_t code) */
+{
+    ARG_ADD_ALWAYS = 1, /* zero is no argument */
+    ARG_ADD_KILL,       ARG_ADD_MEMBER,     ARG_ADD_MOVEMENT,
+    ARG_ADD_REGEN,      ARG_ADD_SECRET,     ARG_ADD_UNIQUE,
+    ARG_AGILITY,        ARG_ARMED,          ARG_ARMOR_CLASS,
+    ARG_ATTACKING,      ARG_AUCTION,        ARG_AUTOMAP_LOST,
+    ARG_AUTOROAM,       ARG_AUTO_ALL,       ARG_AUTO_GET,
+    ARG_BACKSTAB_HIT,   ARG_BLIND,          ARG_CALIBRATE_VITALS,
+    ARG_CASH_DROP,      ARG_CHARM,          ARG_CLASS,
+    ARG_COLLISION,      ARG_CONFUSED,       ARG_CRITICAL_HIT,
+    ARG_DAMAGE_RES,     ARG_DESELECT,       ARG_DISABLED,
+    ARG_DISARMED,       ARG_DISEASED,       ARG_DOOR_CLOSED,
+    ARG_DOOR_LOCKED,    ARG_DOOR_OPENED,    ARG_DOOR_UNLOCKED,
+    ARG_ENGAGE,         ARG_ENGAGED,        ARG_EXP_GAINED,
+    ARG_EXP_NEEDED,     ARG_EXP_READ,       ARG_EXP_TOTAL,
+    ARG_EXTRA_HIT,      ARG_FIRST_NAME,     ARG_FOLLOWER,
+    ARG_FOLLOWER_ADD,   ARG_FOLLOWER_DEL,   ARG_FOLLOW_ATTACK,
+    ARG_GANGPATH,       ARG_GANGPATHING,    ARG_GOSSIP,
+    ARG_HEALTH,         ARG_HEALTH_READ,    ARG_HELD,
+    ARG_HP_MAX,         ARG_HP_NOW,         ARG_HP_UPDATE,
+    ARG_INTELLECT,      ARG_INVENTORY_ADD,  ARG_INVENTORY_DEL,
+    ARG_INVENTORY_READ, ARG_INVITED,        ARG_JOINED,
+    ARG_KEY_REQUIRED,   ARG_KEY_USED,       ARG_LAST_NAME,
+    ARG_LEADER,         ARG_LEVEL,          ARG_LIVES,
+    ARG_LOOKING,        ARG_LOOKUP_EXITS,   ARG_MAGICAL_HIT,
+    ARG_MAGIC_RES,      ARG_MANA,           ARG_MARTIAL_ARTS,
+    ARG_MA_MAX,         ARG_MA_NOW,         ARG_MA_UPDATE,
+    ARG_MEDITATING,     ARG_MISSED,         ARG_MONSTER_CHECK,
+    ARG_MORTAL,         ARG_MOVEMENT,       ARG_MOVEMENT_DELETE,
+    ARG_MOVEMENT_UPDATE, ARG_NONE,          ARG_NORMAL_HIT,
+    ARG_NOT_JOINED,     ARG_NOT_PRESENT,    ARG_NOT_READY,
+    ARG_NO_SNEAK,       ARG_OFFLINE,        ARG_ONLINE,
+    ARG_OVERRIDE,       ARG_PERCEPTION,     ARG_PICKLOCKS,
+    ARG_POISONED,       ARG_PRESENT,        ARG_RACE,
+    ARG_RANK,           ARG_READY,          ARG_REMOVE,
+    ARG_RESET,          ARG_RESTACK,        ARG_RESTING,
+    ARG_ROLLCALL,       ARG_ROOM,           ARG_ROOM_DARK,
+    ARG_SCANNING,       ARG_SCAN_READ,      ARG_SEARCHING,
+    ARG_SELECT,         ARG_SET_COMMAND,    ARG_SET_SECRET,
+    ARG_SINGLE,         ARG_SNEAKING,       ARG_SPEAKING,
+    ARG_SPECIAL_MOVEMENT, ARG_SPELLCASTING, ARG_SPOKEN,
+    ARG_STATS_READ,     ARG_STEALTH,        ARG_STRENGTH,
+    ARG_TARGET,         ARG_TELEPATH,       ARG_THIEVERY,
+    ARG_TRACKING,       ARG_TRAPS,          ARG_UPDATE,
+    ARG_VISIBLE_ADD,    ARG_VISIBLE_DEL,    ARG_WILLPOWER
+};
+
+typedef gboolean (*parse_action_func_t) (parse_action_t *action, gchar *subject,
+    parse_regexp_t *parse_regexp, parse_captures_t *captures);
+
+typedef struct
+{
+    gchar *type;              /* action type, as written in parse db */
+    parse_action_func_t func; /* executes the action */
+    gboolean arg_required;    /* action needs an argument */
+    key_value_t *args;        /* valid arguments (NULL for any text) */
+} parse_action_type_t;
 
 player_t *selected_player = NULL;
 
-/* regexp substring buffer */
-static gchar pcre_substr[SUBSTR_SIZE];
-
 static gboolean parse_action_auditlog (parse_action_t *action, gchar *subject,
-    parse_regexp_t *parse_regexp, gint *ovector, gint strings);
+    parse_regexp_t *parse_regexp, parse_captures_t *captures);
 static gboolean parse_action_automap (parse_action_t *action, gchar *subject,
-    parse_regexp_t *parse_regexp, gint *ovector, gint strings);
+    parse_regexp_t *parse_regexp, parse_captures_t *captures);
 static gboolean parse_action_character (parse_action_t *action, gchar *subject,
-    parse_regexp_t *parse_regexp, gint *ovector, gint strings);
+    parse_regexp_t *parse_regexp, parse_captures_t *captures);
 static gboolean parse_action_chatlog (parse_action_t *action, gchar *subject,
-    parse_regexp_t *parse_regexp, gint *ovector, gint strings);
+    parse_regexp_t *parse_regexp, parse_captures_t *captures);
 static gboolean parse_action_command (parse_action_t *action, gchar *subject,
-    parse_regexp_t *parse_regexp, gint *ovector, gint strings);
+    parse_regexp_t *parse_regexp, parse_captures_t *captures);
 static gboolean parse_action_item (parse_action_t *action, gchar *subject,
-    parse_regexp_t *parse_regexp, gint *ovector, gint strings);
+    parse_regexp_t *parse_regexp, parse_captures_t *captures);
 static gboolean parse_action_misc (parse_action_t *action, gchar *subject,
-    parse_regexp_t *parse_regexp, gint *ovector, gint strings);
+    parse_regexp_t *parse_regexp, parse_captures_t *captures);
 static gboolean parse_action_navigation (parse_action_t *action, gchar *subject,
-    parse_regexp_t *parse_regexp, gint *ovector, gint strings);
+    parse_regexp_t *parse_regexp, parse_captures_t *captures);
 static gboolean parse_action_player (parse_action_t *action, gchar *subject,
-    parse_regexp_t *parse_regexp, gint *ovector, gint strings);
+    parse_regexp_t *parse_regexp, parse_captures_t *captures);
 static gboolean parse_action_require (parse_action_t *action, gchar *subject,
-    parse_regexp_t *parse_regexp, gint *ovector, gint strings);
+    parse_regexp_t *parse_regexp, parse_captures_t *captures);
 static gboolean parse_action_stats (parse_action_t *action, gchar *subject,
-    parse_regexp_t *parse_regexp, gint *ovector, gint strings);
+    parse_regexp_t *parse_regexp, parse_captures_t *captures);
 static gboolean parse_action_target (parse_action_t *action, gchar *subject,
-    parse_regexp_t *parse_regexp, gint *ovector, gint strings);
+    parse_regexp_t *parse_regexp, parse_captures_t *captures);
+
+static key_value_t automap_args[] = {
+    { "AddMovement",     ARG_ADD_MOVEMENT },
+    { "AddRegen",        ARG_ADD_REGEN },
+    { "AddSecret",       ARG_ADD_SECRET },
+    { "Disabled",        ARG_DISABLED },
+    { "KeyRequired",     ARG_KEY_REQUIRED },
+    { "KeyUsed",         ARG_KEY_USED },
+    { "MovementDelete",  ARG_MOVEMENT_DELETE },
+    { "MovementUpdate",  ARG_MOVEMENT_UPDATE },
+    { "Reset",           ARG_RESET },
+    { "SpecialMovement", ARG_SPECIAL_MOVEMENT },
+    { NULL, 0 }
+};
+
+static key_value_t character_args[] = {
+    { "Agility",         ARG_AGILITY },
+    { "ArmorClass",      ARG_ARMOR_CLASS },
+    { "CalibrateVitals", ARG_CALIBRATE_VITALS },
+    { "Charm",           ARG_CHARM },
+    { "Class",           ARG_CLASS },
+    { "DamageRes",       ARG_DAMAGE_RES },
+    { "FirstName",       ARG_FIRST_NAME },
+    { "Health",          ARG_HEALTH },
+    { "HPMax",           ARG_HP_MAX },
+    { "HPNow",           ARG_HP_NOW },
+    { "HPUpdate",        ARG_HP_UPDATE },
+    { "Intellect",       ARG_INTELLECT },
+    { "LastName",        ARG_LAST_NAME },
+    { "Level",           ARG_LEVEL },
+    { "Lives",           ARG_LIVES },
+    { "MagicRes",        ARG_MAGIC_RES },
+    { "MAMax",           ARG_MA_MAX },
+    { "MANow",           ARG_MA_NOW },
+    { "MAUpdate",        ARG_MA_UPDATE },
+    { "MartialArts",     ARG_MARTIAL_ARTS },
+    { "Perception",      ARG_PERCEPTION },
+    { "Picklocks",       ARG_PICKLOCKS },
+    { "Race",            ARG_RACE },
+    { "Rank",            ARG_RANK },
+    { "Spellcasting",    ARG_SPELLCASTING },
+    { "Stealth",         ARG_STEALTH },
+    { "Strength",        ARG_STRENGTH },
+    { "Thievery",        ARG_THIEVERY },
+    { "Tracking",        ARG_TRACKING },
+    { "Traps",           ARG_TRAPS },
+    { "Willpower",       ARG_WILLPOWER },
+    { NULL, 0 }
+};
+
+static key_value_t chatlog_args[] = {
+    { "Auction",  ARG_AUCTION },
+    { "Gangpath", ARG_GANGPATH },
+    { "Gossip",   ARG_GOSSIP },
+    { "Spoken",   ARG_SPOKEN },
+    { "Telepath", ARG_TELEPATH },
+    { NULL, 0 }
+};
+
+static key_value_t combat_args[] = {
+    { "Reset", ARG_RESET },
+    { NULL, 0 }
+};
+
+static key_value_t command_del_args[] = {
+    { "Arming",        CMD_ARM },
+    { "Attacking",     CMD_ATTACK },
+    { "Bashing",       CMD_BASH },
+    { "Buying",        CMD_BUY },
+    { "Casting",       CMD_CAST },
+    { "ChangingRank",  CMD_RANKCH },
+    { "CheckingParty", CMD_PARTY },
+    { "Depositing",    CMD_DEPOSIT },
+    { "Dropping",      CMD_DROP },
+    { "Exiting",       CMD_EXIT },
+    { "CheckExp",      CMD_EXP },
+    { "CheckHealth",   CMD_HEALTH },
+    { "CheckStats",    CMD_STATS },
+    { "Hiding",        CMD_HIDE },
+    { "Gangpathing",   CMD_GANGPATH },
+    { "Inviting",      CMD_INVITE },
+    { "Joining",       CMD_JOIN },
+    { "Meditating",    CMD_MEDITATE },
+    { "Moving",        CMD_MOVE },
+    { "Opening",       CMD_OPEN },
+    { "PickingLock",   CMD_PICKLOCK },
+    { "PickingUp",     CMD_PICKUP },
+    { "Removing",      CMD_REMOVE },
+    { "Resting",       CMD_REST },
+    { "Scanning",      CMD_SCAN },
+    { "Searching",     CMD_SEARCH },
+    { "Selling",       CMD_SELL },
+    { "Sneaking",      CMD_SNEAK },
+    { "Speaking",      CMD_SPEAK },
+    { "Targeting",     CMD_TARGET },
+    { "Telepathing",   CMD_TELEPATH },
+    { "Using",         CMD_USE },
+    { "Withdrawing",   CMD_WITHDRAW },
+    { NULL, 0 }
+};
+
+static key_value_t command_send_args[] = {
+    { "Target", ARG_TARGET },
+    { NULL, 0 }
+};
+
+static key_value_t damage_delt_args[] = {
+    { "Room",   ARG_ROOM },
+    { "Single", ARG_SINGLE },
+    { NULL, 0 }
+};
+
+static key_value_t item_args[] = {
+    { "Armed",        ARG_ARMED },
+    { "AutoGet",      ARG_AUTO_GET },
+    { "CashDrop",     ARG_CASH_DROP },
+    { "Disarmed",     ARG_DISARMED },
+    { "InventoryAdd", ARG_INVENTORY_ADD },
+    { "InventoryDel", ARG_INVENTORY_DEL },
+    { "Reset",        ARG_RESET },
+    { "VisibleAdd",   ARG_VISIBLE_ADD },
+    { "VisibleDel",   ARG_VISIBLE_DEL },
+    { NULL, 0 }
+};
+
+static key_value_t navigation_args[] = {
+    { "Autoroam",     ARG_AUTOROAM },
+    { "Collision",    ARG_COLLISION },
+    { "DoorClosed",   ARG_DOOR_CLOSED },
+    { "DoorLocked",   ARG_DOOR_LOCKED },
+    { "DoorOpened",   ARG_DOOR_OPENED },
+    { "DoorUnlocked", ARG_DOOR_UNLOCKED },
+    { "LookupExits",  ARG_LOOKUP_EXITS },
+    { "Reset",        ARG_RESET },
+    { "RoomDark",     ARG_ROOM_DARK },
+    { "SetCommand",   ARG_SET_COMMAND },
+    { "SetSecret",    ARG_SET_SECRET },
+    { NULL, 0 }
+};
+
+static key_value_t osd_dock_args[] = {
+    { "Restack", ARG_RESTACK },
+    { NULL, 0 }
+};
+
+static key_value_t parse_command_args[] = {
+    { "Gangpath", PARTY_MSG_GANGPATH },
+    { "Spoken",   PARTY_MSG_SPOKEN },
+    { "Telepath", PARTY_MSG_TELEPATH },
+    { NULL, 0 }
+};
+
+static key_value_t player_args[] = {
+    { "AddMember",   ARG_ADD_MEMBER },
+    { "AddUnique",   ARG_ADD_UNIQUE },
+    { "Deselect",    ARG_DESELECT },
+    { "FollowerAdd", ARG_FOLLOWER_ADD },
+    { "FollowerDel", ARG_FOLLOWER_DEL },
+    { "Health",      ARG_HEALTH },
+    { "Invited",     ARG_INVITED },
+    { "Joined",      ARG_JOINED },
+    { "Leader",      ARG_LEADER },
+    { "Mana",        ARG_MANA },
+    { "NotJoined",   ARG_NOT_JOINED },
+    { "NotPresent",  ARG_NOT_PRESENT },
+    { "NotReady",    ARG_NOT_READY },
+    { "Offline",     ARG_OFFLINE },
+    { "Online",      ARG_ONLINE },
+    { "Present",     ARG_PRESENT },
+    { "Ready",       ARG_READY },
+    { "Rollcall",    ARG_ROLLCALL },
+    { "Select",      ARG_SELECT },
+    { NULL, 0 }
+};
+
+static key_value_t require_args[] = {
+    { "Attacking",   ARG_ATTACKING },
+    { "AutomapLost", ARG_AUTOMAP_LOST },
+    { "Firstname",   ARG_FIRST_NAME },
+    { "Follower",    ARG_FOLLOWER },
+    { "Gangpathing", ARG_GANGPATHING },
+    { "Leader",      ARG_LEADER },
+    { "Movement",    ARG_MOVEMENT },
+    { "Scanning",    ARG_SCANNING },
+    { "Speaking",    ARG_SPEAKING },
+    { NULL, 0 }
+};
+
+static key_value_t require_flag_args[] = {
+    { "Ready", ARG_READY },
+    { NULL, 0 }
+};
+
+static key_value_t require_option_args[] = {
+    { "AutoAll",      ARG_AUTO_ALL },
+    { "FollowAttack", ARG_FOLLOW_ATTACK },
+    { "MonsterCheck", ARG_MONSTER_CHECK },
+    { NULL, 0 }
+};
+
+static key_value_t set_flag_args[] = {
+    { "ExpRead",       ARG_EXP_READ },
+    { "HealthRead",    ARG_HEALTH_READ },
+    { "InventoryRead", ARG_INVENTORY_READ },
+    { "Looking",       ARG_LOOKING },
+    { "NoSneak",       ARG_NO_SNEAK },
+    { "Ready",         ARG_READY },
+    { "ScanRead",      ARG_SCAN_READ },
+    { "Searching",     ARG_SEARCHING },
+    { "Sneaking",      ARG_SNEAKING },
+    { "StatsRead",     ARG_STATS_READ },
+    { NULL, 0 }
+};
+
+static key_value_t set_state_args[] = {
+    { "None",       ARG_NONE },
+    { "Engaged",    ARG_ENGAGED },
+    { "Meditating", ARG_MEDITATING },
+    { "Resting",    ARG_RESTING },
+    { NULL, 0 }
+};
+
+static key_value_t set_status_args[] = {
+    { "Blind",    ARG_BLIND },
+    { "Confused", ARG_CONFUSED },
+    { "Diseased", ARG_DISEASED },
+    { "Held",     ARG_HELD },
+    { "Mortal",   ARG_MORTAL },
+    { "Poisoned", ARG_POISONED },
+    { NULL, 0 }
+};
+
+static key_value_t state_args[] = {
+    { "Engaged",    ARG_ENGAGED },
+    { "Meditating", ARG_MEDITATING },
+    { "Resting",    ARG_RESTING },
+    { NULL, 0 }
+};
+
+static key_value_t stats_args[] = {
+    { "AddKill",     ARG_ADD_KILL },
+    { "BackstabHit", ARG_BACKSTAB_HIT },
+    { "CriticalHit", ARG_CRITICAL_HIT },
+    { "ExpGained",   ARG_EXP_GAINED },
+    { "ExpNeeded",   ARG_EXP_NEEDED },
+    { "ExpTotal",    ARG_EXP_TOTAL },
+    { "ExtraHit",    ARG_EXTRA_HIT },
+    { "MagicalHit",  ARG_MAGICAL_HIT },
+    { "Missed",      ARG_MISSED },
+    { "NormalHit",   ARG_NORMAL_HIT },
+    { NULL, 0 }
+};
+
+static key_value_t target_args[] = {
+    { "AddAlways", ARG_ADD_ALWAYS },
+    { "AddUnique", ARG_ADD_UNIQUE },
+    { "Engage",    ARG_ENGAGE },
+    { "Override",  ARG_OVERRIDE },
+    { "Remove",    ARG_REMOVE },
+    { "Reset",     ARG_RESET },
+    { NULL, 0 }
+};
+
+static key_value_t vitals_osd_args[] = {
+    { "Update", ARG_UPDATE },
+    { NULL, 0 }
+};
+
+/* indexed by parse_action_t op */
+static parse_action_type_t action_types[ACT_MAX] = {
+    [ACT_AUDITLOG]       = { "AuditLog",      parse_action_auditlog,   TRUE,  NULL },
+    [ACT_AUTOMAP]        = { "Automap",       parse_action_automap,    TRUE,  automap_args },
+    [ACT_CHARACTER]      = { "Character",     parse_action_character,  TRUE,  character_args },
+    [ACT_CHATLOG]        = { "ChatLog",       parse_action_chatlog,    TRUE,  chatlog_args },
+    [ACT_CLEANUP_EVENT]  = { "CleanupEvent",  parse_action_misc,       FALSE, NULL },
+    [ACT_COMBAT]         = { "Combat",        parse_action_misc,       TRUE,  combat_args },
+    [ACT_COMMAND_DEL]    = { "CommandDel",    parse_action_command,    TRUE,  command_del_args },
+    [ACT_COMMAND_RECALL] = { "CommandRecall", parse_action_command,    FALSE, NULL },
+    [ACT_COMMAND_SEND]   = { "CommandSend",   parse_action_command,    TRUE,  command_send_args },
+    [ACT_COMMAND_SPEAK]  = { "CommandSpeak",  parse_action_command,    TRUE,  NULL },
+    [ACT_DAMAGE_DELT]    = { "DamageDelt",    parse_action_misc,       TRUE,  damage_delt_args },
+    [ACT_DISCONNECT]     = { "Disconnect",    parse_action_misc,       FALSE, NULL },
+    [ACT_ITEM]           = { "Item",          parse_action_item,       TRUE,  item_args },
+    [ACT_NAVIGATION]     = { "Navigation",    parse_action_navigation, TRUE,  navigation_args },
+    [ACT_OSD_DOCK]       = { "OSDDock",       parse_action_misc,       TRUE,  osd_dock_args },
+    [ACT_PARSE_COMMAND]  = { "ParseCommand",  parse_action_misc,       TRUE,  parse_command_args },
+    [ACT_PLAYER]         = { "Player",        parse_action_player,     TRUE,  player_args },
+    [ACT_PRINT_STATS]    = { "PrintStats",    parse_action_misc,       FALSE, NULL },
+    [ACT_PRINT_TERM]     = { "PrintTerm",     parse_action_misc,       TRUE,  NULL },
+    [ACT_RANDOM_TAUNT]   = { "RandomTaunt",   parse_action_misc,       FALSE, NULL },
+    [ACT_REQUIRE]        = { "Require",       parse_action_require,    TRUE,  require_args },
+    [ACT_REQUIRE_FLAG]   = { "RequireFlag",   parse_action_require,    TRUE,  require_flag_args },
+    [ACT_REQUIRE_OPTION] = { "RequireOption", parse_action_require,    TRUE,  require_option_args },
+    [ACT_REQUIRE_ROOM]   = { "RequireRoom",   parse_action_require,    TRUE,  NULL },
+    [ACT_REQUIRE_STATE]  = { "RequireState",  parse_action_require,    TRUE,  state_args },
+    [ACT_RESET_STATE]    = { "ResetState",    parse_action_misc,       TRUE,  state_args },
+    [ACT_ROUND_SYNC]     = { "RoundSync",     parse_action_misc,       FALSE, NULL },
+    [ACT_SEND_LINE]      = { "SendLine",      parse_action_misc,       TRUE,  NULL },
+    [ACT_SET_FLAG]       = { "SetFlag",       parse_action_misc,       TRUE,  set_flag_args },
+    [ACT_SET_STATE]      = { "SetState",      parse_action_misc,       TRUE,  set_state_args },
+    [ACT_SET_STATUS]     = { "SetStatus",     parse_action_misc,       TRUE,  set_status_args },
+    [ACT_STATS]          = { "Stats",         parse_action_stats,      TRUE,  stats_args },
+    [ACT_TARGET]         = { "Target",        parse_action_target,     TRUE,  target_args },
+    [ACT_VITALS_OSD]     = { "VitalsOSD",     parse_action_misc,       TRUE,  vitals_osd_args },
+};
 
 
 /* =========================================================================
- = PARSE_ACTION_DISPATCH
+ = PARSE_ACTION_RESOLVE
  =
- = Dispatch parse actions to be executed
+ = Resolve action type and argument for dispatch, returns FALSE if the
+ = action is not recognized
  ======================================================================== */
 
-gboolean parse_action_dispatch (parse_action_t *action, gchar *subject,
-    parse_regexp_t *parse_regexp, gint *ovector, gint strings)
+gboolean parse_action_resolve (parse_action_t *action)
 {
+    parse_action_type_t *at;
+    key_value_t *kv;
+    gint op;
+
     g_assert (action != NULL);
 
     if (action->type == NULL || action->type[0] == '\0')
-        return TRUE; /* invalid parse action */
-
-    memset (&pcre_substr, 0, sizeof (pcre_substr));
-
-    if (!strcasecmp (action->type, "AuditLog") && action->arg)
-        return parse_action_auditlog (action, subject, parse_regexp, ovector, strings);
+        return FALSE;
 
-    else if (!strcasecmp (action->type, "Automap") && action->arg)
-        return parse_action_automap (action, subject, parse_regexp, ovector, strings);
+    for (op = 0; op < ACT_MAX; op++)
+        if (!strcasecmp (action->type, action_types[op].type)) break;
 
-    else if (!strcasecmp (action->type, "Character") && action->arg)
-        return parse_action_character (action, subject, parse_regexp, ovector, strings);
+    if (op == ACT_MAX)
+        return FALSE; /* unknown action type */
 
-    else if (!strcasecmp (action->type, "ChatLog") && action->arg)
-        return parse_action_chatlog (action, subject, parse_regexp, ovector, strings);
+    at = &action_types[op];
+    action->op   = op;
+    action->code = 0;
 
-    else if (!strncasecmp (action->type, "Command", 7))
-        return parse_action_command (action, subject, parse_regexp, ovector, strings);
+    if (!at->arg_required)
+        return TRUE;
 
-    else if (!strcasecmp (action->type, "Item") && action->arg)
-        return parse_action_item (action, subject, parse_regexp, ovector, strings);
+    if (action->arg == NULL)
+        return FALSE;
 
-    else if (!strcasecmp (action->type, "Navigation") && action->arg)
-        return parse_action_navigation (action, subject, parse_regexp, ovector, strings);
+    if (at->args == NULL)
+        return TRUE; /* argument is free text */
 
-    else if (!strcasecmp (action->type, "Player") && action->arg)
-        return parse_action_player (action, subject, parse_regexp, ovector, strings);
+    for (kv = at->args; kv->key; kv++)
+    {
+        if (!strcasecmp (action->arg, kv->key))
+        {
+            action->code = kv->value;
+            return TRUE;
+        }
+    }
 
-    else if (!strncasecmp (action->type, "Require", 7) && action->arg)
-        return parse_action_require (action, subject, parse_regexp, ovector, strings);
+    return FALSE; /* unknown argument */
+}
 
-    else if (!strcasecmp (action->type, "Stats") && action->arg)
-        return parse_action_stats (action, subject, parse_regexp, ovector, strings);
 
-    else if (!strcasecmp (action->type, "Target") && action->arg)
-        return parse_action_target (action, subject, parse_regexp, ovector, strings);
+/* =========================================================================
+ = PARSE_ACTION_DISPATCH
+ =
+ = Dispatch parse actions to be executed
+ ======================================================================== */
 
-    else
-        return parse_action_misc (action, subject, parse_regexp, ovector, strings);
+gboolean parse_action_dispatch (parse_action_t *action, gchar *subject,
+    parse_regexp_t *parse_regexp, parse_captures_t *captures)
+{
+    g_assert (action != NULL);
+    g_assert (action->op >= 0 && action->op < ACT_MAX);
 
-    return TRUE;
+    return action_types[action->op].func (action, subject, parse_regexp, captures);
 }
 
 
@@ -139,11 +550,9 @@ gboolean parse_action_dispatch (parse_action_t *action, gchar *subject,
  ======================================================================== */
 
 static gboolean parse_action_auditlog (parse_action_t *action, gchar *subject,
-    parse_regexp_t *parse_regexp, gint *ovector, gint strings)
+    parse_regexp_t *parse_regexp, parse_captures_t *captures)
 {
-    GET_PCRE_SUBSTR (action->value);
-
-    mudpro_audit_log_append (action->arg, pcre_substr);
+    mudpro_audit_log_append (action->arg, CAPTURE_STR (action->value));
 
     return TRUE;
 }
@@ -156,21 +565,21 @@ static gboolean parse_action_auditlog (parse_action_t *action, gchar *subject,
  ======================================================================== */
 
 static gboolean parse_action_automap (parse_action_t *action, gchar *subject,
-    parse_regexp_t *parse_regexp, gint *ovector, gint strings)
+    parse_regexp_t *parse_regexp, parse_captures_t *captures)
 {
     exit_table_t *et;
 
-    if (!strcasecmp (action->arg, "MovementDelete"))
+    if (action->code == ARG_MOVEMENT_DELETE)
     {
         automap_movement_del ();
     }
 
-    else if (!strcasecmp (action->arg, "MovementUpdate"))
+    else if (action->code == ARG_MOVEMENT_UPDATE)
     {
         automap_movement_update ();
     }
 
-    else if (!strcasecmp (action->arg, "SpecialMovement"))
+    else if (action->code == ARG_SPECIAL_MOVEMENT)
     {
         if (automap.user_input->len == 0)
             return TRUE;
@@ -189,15 +598,13 @@ static gboolean parse_action_automap (parse_action_t *action, gchar *subject,
     if (!automap.location || automap.lost)
         return TRUE;
 
-    if (!strcasecmp (action->arg, "AddMovement") && action->value)
+    if (action->code == ARG_ADD_MOVEMENT && action->value)
     {
         exit_table_t *et;
 
-        GET_PCRE_SUBSTR (action->value);
-
         for (et = exit_table; et->long_str; et++)
         {
-            if (!strcasecmp (pcre_substr, et->long_str))
+            if (!strcasecmp (CAPTURE_STR (action->value), et->long_str))
             {
                 automap_movement_add (et);
                 return TRUE;
@@ -205,7 +612,7 @@ static gboolean parse_action_automap (parse_action_t *action, gchar *subject,
         }
     }
 
-    else if (!strcasecmp (action->arg, "AddRegen") && action->value)
+    else if (action->code == ARG_ADD_REGEN && action->value)
     {
         exit_info_t *exit_info;
         automap_record_t *record;
@@ -215,8 +622,7 @@ static gboolean parse_action_automap (parse_action_t *action, gchar *subject,
             direction = action->value - PARSE_VALUE_DIRECTION;
         else
         {
-            GET_PCRE_SUBSTR (action->value);
-            direction = automap_get_exit_as_int (pcre_substr);
+            direction = CAPTURE_DIRECTION (action->value);
         }
 
         /* get record for the specified direction */
@@ -242,7 +648,7 @@ static gboolean parse_action_automap (parse_action_t *action, gchar *subject,
     if (!automap.enabled)
         return TRUE;
 
-    if (!strcasecmp (action->arg, "AddSecret") && action->value)
+    if (action->code == ARG_ADD_SECRET && action->value)
     {
         gint direction;
 
@@ -250,25 +656,23 @@ static gboolean parse_action_automap (parse_action_t *action, gchar *subject,
             direction = action->value - PARSE_VALUE_DIRECTION;
         else
         {
-            GET_PCRE_SUBSTR (action->value);
-            direction = automap_get_exit_as_int (pcre_substr);
+            direction = CAPTURE_DIRECTION (action->value);
         }
 
         automap_set_secret (automap.location, direction);
     }
 
-    else if (!strcasecmp (action->arg, "Disabled"))
+    else if (action->code == ARG_DISABLED)
     {
         automap_disable ();
     }
 
-    else if (!strcasecmp (action->arg, "KeyRequired") && action->value)
+    else if (action->code == ARG_KEY_REQUIRED && action->value)
     {
         exit_info_t *exit_info;
 
-        GET_PCRE_SUBSTR (action->value);
         exit_info = automap_get_exit_info (automap.location,
-            automap_get_exit_as_int (pcre_substr));
+            CAPTURE_DIRECTION (action->value));
 
         if (!exit_info || automap.key->str[0] == '\0')
         {
@@ -281,17 +685,15 @@ static gboolean parse_action_automap (parse_action_t *action, gchar *subject,
         FlagON (exit_info->flags, EXIT_FLAG_KEYREQ);
     }
 
-    else if (!strcasecmp (action->arg, "KeyUsed") && action->value)
+    else if (action->code == ARG_KEY_USED && action->value)
     {
-        GET_PCRE_SUBSTR (action->value);
-
-        if (!item_list_lookup (character.inventory, pcre_substr))
+        if (!item_list_lookup (character.inventory, CAPTURE_STR (action->value)))
             printt ("Warning: Key used not in inventory!?");
 
-        automap.key = g_string_assign (automap.key, pcre_substr);
+        automap.key = g_string_assign (automap.key, CAPTURE_STR (action->value));
     }
 
-    else if (!strcasecmp (action->arg, "Reset"))
+    else if (action->code == ARG_RESET)
     {
         automap_reset (TRUE /* full reset */);
     }
@@ -307,9 +709,9 @@ static gboolean parse_action_automap (parse_action_t *action, gchar *subject,
  ======================================================================== */
 
 static gboolean parse_action_character (parse_action_t *action, gchar *subject,
-    parse_regexp_t *parse_regexp, gint *ovector, gint strings)
+    parse_regexp_t *parse_regexp, parse_captures_t *captures)
 {
-    if (!strcasecmp (action->arg, "CalibrateVitals"))
+    if (action->code == ARG_CALIBRATE_VITALS)
     {
         character_vitals_calibrate ();
     }
@@ -317,147 +719,114 @@ static gboolean parse_action_character (parse_action_t *action, gchar *subject,
     /* ================================================================== */
 
     if (!action->value)
-        return TRUE; /* pcre_substr required beyond this point */
+        return TRUE; /* capture required beyond this point */
 
-    GET_PCRE_SUBSTR (action->value);
+    if (action->code == ARG_AGILITY)
+        character.stat.agility = CAPTURE_INT (action->value);
 
-    if (!strcasecmp (action->arg, "Agility"))
-        character.stat.agility = atoi (pcre_substr);
+    else if (action->code == ARG_ARMOR_CLASS)
+        character.stat.armor_class = CAPTURE_INT (action->value);
 
-    else if (!strcasecmp (action->arg, "ArmorClass"))
-        character.stat.armor_class = atoi (pcre_substr);
+    else if (action->code == ARG_CHARM)
+        character.stat.charm = CAPTURE_INT (action->value);
 
-    else if (!strcasecmp (action->arg, "Charm"))
-        character.stat.charm = atoi (pcre_substr);
+    else if (action->code == ARG_CLASS)
+        character.stat.klass = character_class_as_int (CAPTURE_STR (action->value));
 
-    else if (!strcasecmp (action->arg, "Class"))
-        character.stat.klass = character_class_as_int (pcre_substr);
+    else if (action->code == ARG_DAMAGE_RES)
+        character.stat.damage_res = CAPTURE_INT (action->value);
 
-    else if (!strcasecmp (action->arg, "DamageRes"))
-        character.stat.damage_res = atoi (pcre_substr);
-
-    else if (!strcasecmp (action->arg, "FirstName"))
+    else if (action->code == ARG_FIRST_NAME)
     {
         g_free (character.first_name);
-        character.first_name = g_strdup (pcre_substr);
+        character.first_name = g_strdup (CAPTURE_STR (action->value));
     }
 
-    else if (!strcasecmp (action->arg, "Health"))
-        character.stat.health = atoi (pcre_substr);
-
-    else if (!strcasecmp (action->arg, "HPMax"))
-        character.hp.max = atoi (pcre_substr);
+    else if (action->code == ARG_HEALTH)
+        character.stat.health = CAPTURE_INT (action->value);
 
-    else if (!strcasecmp (action->arg, "HPNow"))
-        character.hp.now = atoi (pcre_substr);
+    else if (action->code == ARG_HP_MAX)
+        character.hp.max = CAPTURE_INT (action->value);
 
-    else if (!strcasecmp (action->arg, "HPUpdate"))
-    {
-        static gint last_value = 0;
+    else if (action->code == ARG_HP_NOW)
+        character.hp.now = CAPTURE_INT (action->value);
 
-        character.hp.now = atoi (pcre_substr);
-
-        if (character.hp.now != last_value)
-        {
-            stats.lowhp = MIN (stats.lowhp, character.hp.now);
-            osd_vitals_update ();
-            last_value = character.hp.now;
-        }
-    }
+    else if (action->code == ARG_HP_UPDATE)
+        character_hp_update (CAPTURE_INT (action->value));
 
-    else if (!strcasecmp (action->arg, "Intellect"))
-        character.stat.intellect = atoi (pcre_substr);
+    else if (action->code == ARG_INTELLECT)
+        character.stat.intellect = CAPTURE_INT (action->value);
 
-    else if (!strcasecmp (action->arg, "LastName"))
+    else if (action->code == ARG_LAST_NAME)
     {
         g_free (character.last_name);
-        character.last_name = g_strdup (pcre_substr);
+        character.last_name = g_strdup (CAPTURE_STR (action->value));
     }
 
-    else if (!strcasecmp (action->arg, "Level"))
-        character.stat.level = atoi (pcre_substr);
+    else if (action->code == ARG_LEVEL)
+        character.stat.level = CAPTURE_INT (action->value);
 
-    else if (!strcasecmp (action->arg, "Lives"))
-        character.stat.lives = atoi (pcre_substr);
+    else if (action->code == ARG_LIVES)
+        character.stat.lives = CAPTURE_INT (action->value);
 
-    else if (!strcasecmp (action->arg, "MagicRes"))
-        character.stat.magic_res = atoi (pcre_substr);
+    else if (action->code == ARG_MAGIC_RES)
+        character.stat.magic_res = CAPTURE_INT (action->value);
 
-    else if (!strcasecmp (action->arg, "MAMax"))
-        character.ma.max = atoi (pcre_substr);
+    else if (action->code == ARG_MA_MAX)
+        character.ma.max = CAPTURE_INT (action->value);
 
-    else if (!strcasecmp (action->arg, "MANow"))
-        character.ma.now = atoi (pcre_substr);
+    else if (action->code == ARG_MA_NOW)
+        character.ma.now = CAPTURE_INT (action->value);
 
-    else if (!strcasecmp (action->arg, "MAUpdate"))
-    {
-        static gint last_value = 0;
+    else if (action->code == ARG_MA_UPDATE)
+        character_ma_update (CAPTURE_INT (action->value));
 
-        character.ma.now = atoi (pcre_substr);
+    else if (action->code == ARG_MARTIAL_ARTS)
+        character.stat.martial_arts = CAPTURE_INT (action->value);
 
-        if (character.ma.now != last_value)
-        {
-            if (character.ma.now > last_value
-                && character.ma.now != character.ma.max
-                && character.state != STATE_ENGAGED
-                && !command_pending (CMD_CAST))
-            {
-                character.tick.current = character.ma.now - last_value;
-                stats.mana_tick.total += character.tick.current;
-                stats.mana_tick.count++;
-            }
-
-            osd_vitals_update ();
-            last_value = character.ma.now;
-        }
-    }
-
-    else if (!strcasecmp (action->arg, "MartialArts"))
-        character.stat.martial_arts = atoi (pcre_substr);
-
-    else if (!strcasecmp (action->arg, "Perception"))
-        character.stat.perception = atoi (pcre_substr);
+    else if (action->code == ARG_PERCEPTION)
+        character.stat.perception = CAPTURE_INT (action->value);
 
-    else if (!strcasecmp (action->arg, "Picklocks"))
-        character.stat.picklocks = atoi (pcre_substr);
+    else if (action->code == ARG_PICKLOCKS)
+        character.stat.picklocks = CAPTURE_INT (action->value);
 
-    else if (!strcasecmp (action->arg, "Race"))
-        character.stat.race = character_race_as_int (pcre_substr);
+    else if (action->code == ARG_RACE)
+        character.stat.race = character_race_as_int (CAPTURE_STR (action->value));
 
-    else if (!strcasecmp (action->arg, "Rank") && action->value)
+    else if (action->code == ARG_RANK && action->value)
     {
-        GET_PCRE_SUBSTR (action->value);
+        gchar *str = CAPTURE_STR (action->value);
 
-        if (!strcasecmp (pcre_substr, "back"))
+        if (!strcasecmp (str, "back"))
             character.rank.current = RANK_BACK;
 
-        else if (!strcasecmp (pcre_substr, "middle"))
+        else if (!strcasecmp (str, "middle"))
             character.rank.current = RANK_MIDDLE;
 
-        else if (!strcasecmp (pcre_substr, "front"))
+        else if (!strcasecmp (str, "front"))
             character.rank.current = RANK_FRONT;
     }
 
-    else if (!strcasecmp (action->arg, "Spellcasting"))
-        character.stat.spellcasting = atoi (pcre_substr);
+    else if (action->code == ARG_SPELLCASTING)
+        character.stat.spellcasting = CAPTURE_INT (action->value);
 
-    else if (!strcasecmp (action->arg, "Stealth"))
-        character.stat.stealth = atoi (pcre_substr);
+    else if (action->code == ARG_STEALTH)
+        character.stat.stealth = CAPTURE_INT (action->value);
 
-    else if (!strcasecmp (action->arg, "Strength"))
-        character.stat.strength = atoi (pcre_substr);
+    else if (action->code == ARG_STRENGTH)
+        character.stat.strength = CAPTURE_INT (action->value);
 
-    else if (!strcasecmp (action->arg, "Thievery"))
-        character.stat.thievery = atoi (pcre_substr);
+    else if (action->code == ARG_THIEVERY)
+        character.stat.thievery = CAPTURE_INT (action->value);
 
-    else if (!strcasecmp (action->arg, "Tracking"))
-        character.stat.tracking = atoi (pcre_substr);
+    else if (action->code == ARG_TRACKING)
+        character.stat.tracking = CAPTURE_INT (action->value);
 
-    else if (!strcasecmp (action->arg, "Traps"))
-        character.stat.traps = atoi (pcre_substr);
+    else if (action->code == ARG_TRAPS)
+        character.stat.traps = CAPTURE_INT (action->value);
 
-    else if (!strcasecmp (action->arg, "Willpower"))
-        character.stat.willpower = atoi (pcre_substr);
+    else if (action->code == ARG_WILLPOWER)
+        character.stat.willpower = CAPTURE_INT (action->value);
 
     return TRUE;
 }
@@ -470,42 +839,42 @@ static gboolean parse_action_character (parse_action_t *action, gchar *subject,
  ======================================================================== */
 
 static gboolean parse_action_chatlog (parse_action_t *action, gchar *subject,
-    parse_regexp_t *parse_regexp, gint *ovector, gint strings)
+    parse_regexp_t *parse_regexp, parse_captures_t *captures)
 {
-    GET_PCRE_SUBSTR (action->value);
+    gchar *str = CAPTURE_STR (action->value);
 
     /* TODO: do something better with communications ... */
     /* perhaps integrate with external IM clients or log to an internal */
     /* conversation box ... or both ? */
 
-    if (strstr (pcre_substr, ": @") ||
-        strstr (pcre_substr, ": {") ||
-        strstr (pcre_substr, "says \"@"))
+    if (strstr (str, ": @") ||
+        strstr (str, ": {") ||
+        strstr (str, "says \"@"))
         return TRUE; /* FIXME: do something better to filter @commands */
 
-    if (!strcasecmp (action->arg, "Auction"))
+    if (action->code == ARG_AUCTION)
     {
-        temporary_chatlog_append (pcre_substr);
+        temporary_chatlog_append (str);
     }
 
-    else if (!strcasecmp (action->arg, "Gangpath"))
+    else if (action->code == ARG_GANGPATH)
     {
-        temporary_chatlog_append (pcre_substr);
+        temporary_chatlog_append (str);
     }
 
-    else if (!strcasecmp (action->arg, "Gossip"))
+    else if (action->code == ARG_GOSSIP)
     {
-        temporary_chatlog_append (pcre_substr);
+        temporary_chatlog_append (str);
     }
 
-    else if (!strcasecmp (action->arg, "Spoken"))
+    else if (action->code == ARG_SPOKEN)
     {
-        temporary_chatlog_append (pcre_substr);
+        temporary_chatlog_append (str);
     }
 
-    else if (!strcasecmp (action->arg, "Telepath"))
+    else if (action->code == ARG_TELEPATH)
     {
-        temporary_chatlog_append (pcre_substr);
+        temporary_chatlog_append (str);
     }
 
     return TRUE;
@@ -519,57 +888,25 @@ static gboolean parse_action_chatlog (parse_action_t *action, gchar *subject,
  ======================================================================== */
 
 static gboolean parse_action_command (parse_action_t *action, gchar *subject,
-    parse_regexp_t *parse_regexp, gint *ovector, gint strings)
+    parse_regexp_t *parse_regexp, parse_captures_t *captures)
 {
-    if (!strcasecmp (action->type, "CommandDel") && action->arg)
-    {
-        if (!strcasecmp (action->arg, "Arming"))             command_del (CMD_ARM);
-        else if (!strcasecmp (action->arg, "Attacking"))     command_del (CMD_ATTACK);
-        else if (!strcasecmp (action->arg, "Bashing"))       command_del (CMD_BASH);
-        else if (!strcasecmp (action->arg, "Buying"))        command_del (CMD_BUY);
-        else if (!strcasecmp (action->arg, "Casting"))       command_del (CMD_CAST);
-        else if (!strcasecmp (action->arg, "ChangingRank"))  command_del (CMD_RANKCH);
-        else if (!strcasecmp (action->arg, "CheckingParty")) command_del (CMD_PARTY);
-        else if (!strcasecmp (action->arg, "Depositing"))    command_del (CMD_DEPOSIT);
-        else if (!strcasecmp (action->arg, "Dropping"))      command_del (CMD_DROP);
-        else if (!strcasecmp (action->arg, "Exiting"))       command_del (CMD_EXIT);
-        else if (!strcasecmp (action->arg, "CheckExp"))      command_del (CMD_EXP);
-        else if (!strcasecmp (action->arg, "CheckHealth"))   command_del (CMD_HEALTH);
-        else if (!strcasecmp (action->arg, "CheckStats"))    command_del (CMD_STATS);
-        else if (!strcasecmp (action->arg, "Hiding"))        command_del (CMD_HIDE);
-        else if (!strcasecmp (action->arg, "Gangpathing"))   command_del (CMD_GANGPATH);
-        else if (!strcasecmp (action->arg, "Inviting"))      command_del (CMD_INVITE);
-        else if (!strcasecmp (action->arg, "Joining"))       command_del (CMD_JOIN);
-        else if (!strcasecmp (action->arg, "Meditating"))    command_del (CMD_MEDITATE);
-        else if (!strcasecmp (action->arg, "Moving"))        command_del (CMD_MOVE);
-        else if (!strcasecmp (action->arg, "Opening"))       command_del (CMD_OPEN);
-        else if (!strcasecmp (action->arg, "PickingLock"))   command_del (CMD_PICKLOCK);
-        else if (!strcasecmp (action->arg, "PickingUp"))     command_del (CMD_PICKUP);
-        else if (!strcasecmp (action->arg, "Removing"))      command_del (CMD_REMOVE);
-        else if (!strcasecmp (action->arg, "Resting"))       command_del (CMD_REST);
-        else if (!strcasecmp (action->arg, "Scanning"))      command_del (CMD_SCAN);
-        else if (!strcasecmp (action->arg, "Searching"))     command_del (CMD_SEARCH);
-        else if (!strcasecmp (action->arg, "Selling"))       command_del (CMD_SELL);
-        else if (!strcasecmp (action->arg, "Sneaking"))      command_del (CMD_SNEAK);
-        else if (!strcasecmp (action->arg, "Speaking"))      command_del (CMD_SPEAK);
-        else if (!strcasecmp (action->arg, "Targeting"))     command_del (CMD_TARGET);
-        else if (!strcasecmp (action->arg, "Telepathing"))   command_del (CMD_TELEPATH);
-        else if (!strcasecmp (action->arg, "Using"))         command_del (CMD_USE);
-        else if (!strcasecmp (action->arg, "Withdrawing"))   command_del (CMD_WITHDRAW);
-    }
-
-    else if (!strcasecmp (action->type, "CommandRecall"))
+    if (action->op == ACT_COMMAND_DEL)
+    {
+        command_del (action->code); /* resolved to CMD_* at load */
+    }
+
+    else if (action->op == ACT_COMMAND_RECALL)
     {
         command_recall ();
     }
 
-    else if (!strcasecmp (action->type, "CommandSend") && action->arg)
+    else if (action->op == ACT_COMMAND_SEND)
     {
-        if (!strcasecmp (action->arg, "Target"))
+        if (action->code == ARG_TARGET)
             command_send (CMD_TARGET);
     }
 
-    else if (!strcasecmp (action->type, "CommandSpeak") && action->arg)
+    else if (action->op == ACT_COMMAND_SPEAK)
     {
         if (action->arg[0] == '!')
             command_send_va (CMD_SPEAK, "\"%s", (action->arg+1) );
@@ -588,15 +925,13 @@ static gboolean parse_action_command (parse_action_t *action, gchar *subject,
  ======================================================================== */
 
 static gboolean parse_action_item (parse_action_t *action, gchar *subject,
-    parse_regexp_t *parse_regexp, gint *ovector, gint strings)
+    parse_regexp_t *parse_regexp, parse_captures_t *captures)
 {
     item_t *item;
 
-    if (!strcasecmp (action->arg, "Armed") && action->value)
+    if (action->code == ARG_ARMED && action->value)
     {
-        GET_PCRE_SUBSTR (action->value);
-
-        if ((item = item_list_lookup (character.inventory, pcre_substr)) != NULL)
+        if ((item = item_list_lookup (character.inventory, CAPTURE_STR (action->value))) != NULL)
         {
             character_equipment_disarmed ();
             item->armed = TRUE;
@@ -607,7 +942,7 @@ static gboolean parse_action_item (parse_action_t *action, gchar *subject,
         }
     }
 
-    else if (!strcasecmp (action->arg, "AutoGet"))
+    else if (action->code == ARG_AUTO_GET)
     {
         character.option.get_items = CLAMP (action->value, 0, 1);
         character.option.get_items = CLAMP (action->value, 0, 1);
@@ -615,50 +950,37 @@ static gboolean parse_action_item (parse_action_t *action, gchar *subject,
             character.option.get_items ? "ON" : "OFF");
     }
 
-    else if (!strcasecmp (action->arg, "CashDrop"))
+    else if (action->code == ARG_CASH_DROP)
     {
-        gchar *str = NULL;
-        GET_PCRE_SUBSTR (action->value);
+        parse_span_t cash = CAPTURE_SPAN (action->value);
+        const gchar *suffix = NULL;
+        gchar *str;
 
-        if (strstr(pcre_substr, "copper") != NULL)
-        {
-            str = g_strdup_printf("%s farthing", pcre_substr);
-            visible_items = item_list_add (visible_items, str);
-            g_free(str);
-        }
-        else if (strstr(pcre_substr, "silver") != NULL)
-        {
-            str = g_strdup_printf("%s noble", pcre_substr);
-            visible_items = item_list_add (visible_items, str);
-            g_free(str);
-        }
-        else if (strstr(pcre_substr, "gold") != NULL)
-        {
-            str = g_strdup_printf("%s gold", pcre_substr);
-            visible_items = item_list_add (visible_items, str);
-            g_free(str);
-        }
-        else if (strstr(pcre_substr, "platinum") != NULL)
-        {
-            str = g_strdup_printf("%s noble", pcre_substr);
-            visible_items = item_list_add (visible_items, str);
-            g_free(str);
-        }
-        else if (strstr(pcre_substr, "runic") != NULL)
+        /* search the capture in place, only the item name is copied */
+        if (g_strstr_len (cash.str, cash.len, "copper"))
+            suffix = "farthing";
+        else if (g_strstr_len (cash.str, cash.len, "silver"))
+            suffix = "noble";
+        else if (g_strstr_len (cash.str, cash.len, "gold"))
+            suffix = "gold";
+        else if (g_strstr_len (cash.str, cash.len, "platinum"))
+            suffix = "noble";
+        else if (g_strstr_len (cash.str, cash.len, "runic"))
+            suffix = "noble";
+
+        if (suffix)
         {
-            str = g_strdup_printf("%s noble", pcre_substr);
+            str = g_strdup_printf ("%.*s %s", (gint) cash.len, cash.str, suffix);
             visible_items = item_list_add (visible_items, str);
-            g_free(str);
+            g_free (str);
         }
     }
 
-    else if (!strcasecmp (action->arg, "Disarmed"))
+    else if (action->code == ARG_DISARMED)
     {
         if (action->value)
         {
-            GET_PCRE_SUBSTR (action->value);
-
-            item = item_list_lookup (character.inventory, pcre_substr);
+            item = item_list_lookup (character.inventory, CAPTURE_STR (action->value));
 
             if (item)
             {
@@ -673,15 +995,16 @@ static gboolean parse_action_item (parse_action_t *action, gchar *subject,
             character_equipment_disarmed ();
     }
 
-    else if (!strncasecmp (action->arg, "Inventory", 9) && action->value)
+    else if ((action->code == ARG_INVENTORY_ADD
+        || action->code == ARG_INVENTORY_DEL) && action->value)
     {
-        GET_PCRE_SUBSTR (action->value);
+        gchar *str = CAPTURE_STR (action->value);
 
-        if (!strcasecmp (action->arg, "InventoryAdd"))
+        if (action->code == ARG_INVENTORY_ADD)
         {
-            /* printt ("InventoryAdd -> '%s'", pcre_substr); */
+            /* printt ("InventoryAdd -> '%s'", str); */
 
-            if (pcre_substr[0] == '0')
+            if (str[0] == '0')
             {
                 /* allowed encumbrance exceeded */
                 character.option.get_items = FALSE;
@@ -690,40 +1013,39 @@ static gboolean parse_action_item (parse_action_t *action, gchar *subject,
                 return TRUE;
             }
 
-            character.inventory = item_list_add (character.inventory, pcre_substr);
+            character.inventory = item_list_add (character.inventory, str);
             item_light_sources = item_inventory_get_quantity_by_flag (
                 ITEM_FLAG_USABLE | ITEM_FLAG_LIGHT);
         }
 
-        else if (!strcasecmp (action->arg, "InventoryDel"))
+        else if (action->code == ARG_INVENTORY_DEL)
         {
-            /* printt ("InventoryDel -> '%s'", pcre_substr); */
+            /* printt ("InventoryDel -> '%s'", str); */
 
             /* use multiple del, since there may be multiple items */
             character.inventory = item_list_multiple_del (
-                character.inventory, pcre_substr);
+                character.inventory, str);
 
             item_light_sources = item_inventory_get_quantity_by_flag (
                 ITEM_FLAG_USABLE | ITEM_FLAG_LIGHT);
         }
     }
 
-    else if (!strcmp (action->arg, "Reset"))
+    else if (action->code == ARG_RESET)
     {
         character.flag.inventory = FALSE;
         item_inventory_list_free ();
         item_visible_list_free ();
     }
 
-    else if (!strncmp (action->arg, "Visible", 7) && action->value)
+    else if ((action->code == ARG_VISIBLE_ADD
+        || action->code == ARG_VISIBLE_DEL) && action->value)
     {
-        GET_PCRE_SUBSTR (action->value);
-
-        if (!strcasecmp (action->arg, "VisibleAdd"))
-            visible_items = item_list_add (visible_items, pcre_substr);
+        if (action->code == ARG_VISIBLE_ADD)
+            visible_items = item_list_add (visible_items, CAPTURE_STR (action->value));
 
-        else if (!strcasecmp (action->arg, "VisibleDel"))
-            visible_items = item_list_del (visible_items, pcre_substr);
+        else if (action->code == ARG_VISIBLE_DEL)
+            visible_items = item_list_del (visible_items, CAPTURE_STR (action->value));
     }
 
     return TRUE;
@@ -737,17 +1059,17 @@ static gboolean parse_action_item (parse_action_t *action, gchar *subject,
  ======================================================================== */
 
 static gboolean parse_action_misc (parse_action_t *action, gchar *subject,
-    parse_regexp_t *parse_regexp, gint *ovector, gint strings)
+    parse_regexp_t *parse_regexp, parse_captures_t *captures)
 {
-    if (!strcasecmp (action->type, "CleanupEvent"))
+    if (action->op == ACT_CLEANUP_EVENT)
     {
         character.flag.cleanup = TRUE;
         connect_wait = character.wait.cleanup;
     }
 
-    else if (!strcasecmp (action->type, "Combat") && action->arg)
+    else if (action->op == ACT_COMBAT)
     {
-        if (!strcasecmp (action->arg, "Reset"))
+        if (action->code == ARG_RESET)
         {
             if (character.state == STATE_ENGAGED)
                 combat.force_break = TRUE;
@@ -756,61 +1078,49 @@ static gboolean parse_action_misc (parse_action_t *action, gchar *subject,
         }
     }
 
-    else if (!strcasecmp (action->type, "DamageDelt") && action->arg)
+    else if (action->op == ACT_DAMAGE_DELT)
     {
-        GET_PCRE_SUBSTR (action->value);
-
-        if (!strcasecmp (action->arg, "Single"))
+        if (action->code == ARG_SINGLE)
         {
-            combat.damage.enemy += atoi (pcre_substr);
+            combat.damage.enemy += CAPTURE_INT (action->value);
             osd_vitals_update ();
         }
-        else if (!strcasecmp (action->arg, "Room"))
+        else if (action->code == ARG_ROOM)
         {
-            combat.damage.room += atoi (pcre_substr);
+            combat.damage.room += CAPTURE_INT (action->value);
             osd_vitals_update ();
         }
     }
 
-    else if (!strcasecmp (action->type, "Disconnect"))
+    else if (action->op == ACT_DISCONNECT)
     {
         sockClose ();
     }
 
-    else if (!strcasecmp (action->type, "OSDDock") && action->arg)
+    else if (action->op == ACT_OSD_DOCK)
     {
-        if (!strcasecmp (action->arg, "Restack"))
+        if (action->code == ARG_RESTACK)
             osd_dock_restack ();
     }
 
-    else if (!strcasecmp (action->type, "ParseCommand")
-        && action->arg && action->value)
+    else if (action->op == ACT_PARSE_COMMAND
+        && action->value)
     {
         player_t *player;
-        gint msg_type;
-
-        if (!strcasecmp (action->arg, "Gangpath"))
-            msg_type = PARTY_MSG_GANGPATH;
-        else if (!strcasecmp (action->arg, "Spoken"))
-            msg_type = PARTY_MSG_SPOKEN;
-        else if (!strcasecmp (action->arg, "Telepath"))
-            msg_type = PARTY_MSG_TELEPATH;
-        else
-            return TRUE; /* unsupported message type */
+        gint msg_type = action->code; /* resolved to PARTY_MSG_* at load */
+        gchar *str;
 
-        GET_PCRE_SUBSTR (1);
-        if ((player = player_db_lookup (pcre_substr)) == NULL)
+        if ((player = player_db_lookup (CAPTURE_STR (1))) == NULL)
             return TRUE;
 
-        /* GET_PCRE_SUBSTR (2); */
-        GET_PCRE_SUBSTR (action->value);
-        if (pcre_substr[0] == '@')
-            party_parse_command (player, msg_type, pcre_substr);
-        else if (pcre_substr[0] == '{')
-            party_parse_response (player, msg_type, pcre_substr);
+        str = CAPTURE_STR (action->value);
+        if (str[0] == '@')
+            party_parse_command (player, msg_type, str);
+        else if (str[0] == '{')
+            party_parse_response (player, msg_type, str);
     }
 
-    else if (!strcasecmp (action->type, "PrintStats"))
+    else if (action->op == ACT_PRINT_STATS)
     {
         GString *buf;
         stats_exp_update ();
@@ -819,118 +1129,117 @@ static gboolean parse_action_misc (parse_action_t *action, gchar *subject,
         g_string_free (buf, TRUE);
     }
 
-    else if (!strcasecmp (action->type, "PrintTerm") && action->arg)
+    else if (action->op == ACT_PRINT_TERM)
     {
         if (action->value)
         {
-            GET_PCRE_SUBSTR (action->value);
-            printt ("%s (pcre_substr '%s')", action->arg, pcre_substr);
+            printt ("%s (capture '%s')", action->arg, CAPTURE_STR (action->value));
         }
         else
             printt ("%s", action->arg);
     }
 
-    else if (!strcasecmp (action->type, "ResetState") && action->arg)
+    else if (action->op == ACT_RESET_STATE)
     {
-        if (!strcasecmp (action->arg, "Engaged")
+        if (action->code == ARG_ENGAGED
             && character.state == STATE_ENGAGED)
             character.state = STATE_NONE;
 
-        else if (!strcasecmp (action->arg, "Resting")
+        else if (action->code == ARG_RESTING
             && character.state == STATE_RESTING)
             character.state = STATE_NONE;
 
-        else if (!strcasecmp (action->arg, "Meditating")
+        else if (action->code == ARG_MEDITATING
             && character.state == STATE_MEDITATING)
             character.state = STATE_NONE;
     }
 
-    else if (!strcasecmp (action->type, "RoundSync"))
+    else if (action->op == ACT_ROUND_SYNC)
     {
         combat_sync ();
     }
 
-    else if (!strcasecmp (action->type, "SendLine") && action->arg)
+    else if (action->op == ACT_SEND_LINE)
     {
         send_line (action->arg);
     }
 
-    else if (!strcasecmp (action->type, "SetFlag") && action->arg)
+    else if (action->op == ACT_SET_FLAG)
     {
-        if (!strcasecmp (action->arg, "ExpRead"))
+        if (action->code == ARG_EXP_READ)
             character.flag.exp_read = CLAMP (action->value, 0, 1);
 
-        else if (!strcasecmp (action->arg, "HealthRead"))
+        else if (action->code == ARG_HEALTH_READ)
             character.flag.health_read = CLAMP (action->value, 0, 1);
 
-        else if (!strcasecmp (action->arg, "InventoryRead"))
+        else if (action->code == ARG_INVENTORY_READ)
             character.flag.inventory = CLAMP (action->value, 0, 1);
 
-        else if (!strcasecmp (action->arg, "Looking"))
+        else if (action->code == ARG_LOOKING)
             character.flag.looking = CLAMP (action->value, 0, 1);
 
-        else if (!strcasecmp (action->arg, "NoSneak"))
+        else if (action->code == ARG_NO_SNEAK)
             character.flag.no_sneak = CLAMP (action->value, 0, 1);
 
-        else if (!strcasecmp (action->arg, "Ready"))
+        else if (action->code == ARG_READY)
             character.flag.ready = CLAMP (action->value, 0, 1);
 
-        else if (!strcasecmp (action->arg, "ScanRead"))
+        else if (action->code == ARG_SCAN_READ)
             character.flag.scan_read = CLAMP (action->value, 0, 1);
 
-        else if (!strcasecmp (action->arg, "Searching"))
+        else if (action->code == ARG_SEARCHING)
             character.flag.searching = CLAMP (action->value, 0, 1);
 
-        else if (!strcasecmp (action->arg, "Sneaking"))
+        else if (action->code == ARG_SNEAKING)
             character.flag.sneaking = CLAMP (action->value, 0, 1);
 
-        else if (!strcasecmp (action->arg, "StatsRead"))
+        else if (action->code == ARG_STATS_READ)
             character.flag.stats_read = CLAMP (action->value, 0, 1);
     }
 
-    else if (!strcasecmp (action->type, "SetState") && action->arg)
+    else if (action->op == ACT_SET_STATE)
     {
-        if (!strcasecmp (action->arg, "None"))
+        if (action->code == ARG_NONE)
             character.state = STATE_NONE;
 
-        else if (!strcasecmp (action->arg, "Engaged"))
+        else if (action->code == ARG_ENGAGED)
             character.state = STATE_ENGAGED;
 
-        else if (!strcasecmp (action->arg, "Meditating"))
+        else if (action->code == ARG_MEDITATING)
             character.state = STATE_MEDITATING;
 
-        else if (!strcasecmp (action->arg, "Resting"))
+        else if (action->code == ARG_RESTING)
             character.state = STATE_RESTING;
     }
 
-    else if (!strcasecmp (action->type, "SetStatus") && action->arg)
+    else if (action->op == ACT_SET_STATUS)
     {
-        if (!strcasecmp (action->arg, "Blind"))
+        if (action->code == ARG_BLIND)
             character.status.blind = CLAMP (action->value, 0, 1);
 
-        else if (!strcasecmp (action->arg, "Confused"))
+        else if (action->code == ARG_CONFUSED)
             character.status.confused = CLAMP (action->value, 0, 1);
 
-        else if (!strcasecmp (action->arg, "Diseased"))
+        else if (action->code == ARG_DISEASED)
             character.status.diseased = CLAMP (action->value, 0, 1);
 
-        else if (!strcasecmp (action->arg, "Held"))
+        else if (action->code == ARG_HELD)
             character.status.held = CLAMP (action->value, 0, 1);
 
-        else if (!strcasecmp (action->arg, "Mortal"))
+        else if (action->code == ARG_MORTAL)
             character.status.mortal = CLAMP (action->value, 0, 1);
 
-        else if (!strcasecmp (action->arg, "Poisoned"))
+        else if (action->code == ARG_POISONED)
             character.status.poisoned = CLAMP (action->value, 0, 1);
     }
 
-    else if (!strcasecmp (action->type, "VitalsOSD") && action->arg)
+    else if (action->op == ACT_VITALS_OSD)
     {
-        if (!strcasecmp (action->arg, "Update") && osd_vitals.visible)
+        if (action->code == ARG_UPDATE && osd_vitals.visible)
             osd_vitals_update ();
     }
 
-    else if (!strcasecmp (action->type, "RandomTaunt"))
+    else if (action->op == ACT_RANDOM_TAUNT)
     {
         if (character.taunt.count > 0)
         {
@@ -952,16 +1261,16 @@ static gboolean parse_action_misc (parse_action_t *action, gchar *subject,
  ======================================================================== */
 
 static gboolean parse_action_navigation (parse_action_t *action, gchar *subject,
-    parse_regexp_t *parse_regexp, gint *ovector, gint strings)
+    parse_regexp_t *parse_regexp, parse_captures_t *captures)
 {
     exit_info_t *exit_info;
 
-    if (!strcasecmp (action->arg, "Autoroam"))
+    if (action->code == ARG_AUTOROAM)
     {
         autoroam_opts.enabled = CLAMP (action->value, 0, 1);
     }
 
-    else if (!strcasecmp (action->arg, "Collision"))
+    else if (action->code == ARG_COLLISION)
     {
         navigation.collisions++;
 
@@ -975,15 +1284,14 @@ static gboolean parse_action_navigation (parse_action_t *action, gchar *subject,
         }
     }
 
-    else if (!strcasecmp (action->arg, "DoorClosed"))
+    else if (action->code == ARG_DOOR_CLOSED)
     {
         if (action->value)
         {
-            GET_PCRE_SUBSTR (action->value);
             FlagOFF (automap.obvious.doors_open,
-                automap_get_exit_as_int (pcre_substr));
+                CAPTURE_DIRECTION (action->value));
             FlagON  (automap.obvious.doors_closed,
-                automap_get_exit_as_int (pcre_substr));
+                CAPTURE_DIRECTION (action->value));
         }
 
         else if (destination && (destination->flags & EXIT_FLAG_DOOR))
@@ -993,22 +1301,20 @@ static gboolean parse_action_navigation (parse_action_t *action, gchar *subject,
         }
     }
 
-    else if (!strcasecmp (action->arg, "DoorLocked") && action->value)
+    else if (action->code == ARG_DOOR_LOCKED && action->value)
     {
-        GET_PCRE_SUBSTR (action->value);
         FlagOFF (automap.obvious.doors_closed,
-            automap_get_exit_as_int (pcre_substr));
+            CAPTURE_DIRECTION (action->value));
     }
 
-    else if (!strcasecmp (action->arg, "DoorOpened"))
+    else if (action->code == ARG_DOOR_OPENED)
     {
         if (action->value)
         {
-            GET_PCRE_SUBSTR (action->value);
             FlagON  (automap.obvious.doors_open,
-                 automap_get_exit_as_int (pcre_substr));
+                 CAPTURE_DIRECTION (action->value));
             FlagOFF (automap.obvious.doors_closed,
-                 automap_get_exit_as_int (pcre_substr));
+                 CAPTURE_DIRECTION (action->value));
         }
 
         else if (destination && (destination->flags & EXIT_FLAG_DOOR))
@@ -1018,29 +1324,26 @@ static gboolean parse_action_navigation (parse_action_t *action, gchar *subject,
         }
     }
 
-    else if (!strcasecmp (action->arg, "DoorUnlocked"))
+    else if (action->code == ARG_DOOR_UNLOCKED)
     {
         if (action->value)
         {
-            GET_PCRE_SUBSTR (action->value);
             FlagON (automap.obvious.doors_unlocked,
-                 automap_get_exit_as_int (pcre_substr));
+                 CAPTURE_DIRECTION (action->value));
         }
 
         else if (destination && (destination->flags & EXIT_FLAG_DOOR))
             FlagON (automap.obvious.doors_unlocked, destination->direction);
     }
 
-    else if (!strcasecmp (action->arg, "LookupExits") && automap.location)
+    else if (action->code == ARG_LOOKUP_EXITS && automap.location)
     {
-        GSList *node;
+        gint i = 0;
 
         memset (&automap.obvious, 0, sizeof (automap.obvious));
 
-        for (node = automap.location->exit_list; node; node = node->next)
+        while ((exit_info = automap_exit_next (automap.location, &i)) != NULL)
         {
-            exit_info = node->data;
-
             if (exit_info->flags & EXIT_FLAG_DOOR) /* assume closed */
                 FlagON (automap.obvious.doors_closed, exit_info->direction);
 
@@ -1049,17 +1352,17 @@ static gboolean parse_action_navigation (parse_action_t *action, gchar *subject,
         }
     }
 
-    else if (!strcasecmp (action->arg, "Reset"))
+    else if (action->code == ARG_RESET)
     {
         navigation_cleanup ();
     }
 
-    else if (!strcasecmp (action->arg, "RoomDark"))
+    else if (action->code == ARG_ROOM_DARK)
     {
         navigation.room_dark = CLAMP (action->value, 0, 1);
     }
 
-    else if (!strcasecmp (action->arg, "SetCommand") && action->value)
+    else if (action->code == ARG_SET_COMMAND && action->value)
     {
         gint direction;
 
@@ -1071,8 +1374,7 @@ static gboolean parse_action_navigation (parse_action_t *action, gchar *subject,
             direction = action->value - PARSE_VALUE_DIRECTION;
         else
         {
-            GET_PCRE_SUBSTR (action->value);
-            direction = automap_get_exit_as_int (pcre_substr);
+            direction = CAPTURE_DIRECTION (action->value);
         }
 
         if ((exit_info = automap_get_exit_info (automap.location, direction)) != NULL)
@@ -1084,7 +1386,7 @@ static gboolean parse_action_navigation (parse_action_t *action, gchar *subject,
         }
     }
 
-    else if (!strcasecmp (action->arg, "SetSecret") && action->value)
+    else if (action->code == ARG_SET_SECRET && action->value)
     {
         gint direction;
 
@@ -1092,8 +1394,7 @@ static gboolean parse_action_navigation (parse_action_t *action, gchar *subject,
             direction = action->value - PARSE_VALUE_DIRECTION;
         else
         {
-            GET_PCRE_SUBSTR (action->value);
-            direction = automap_get_exit_as_int (pcre_substr);
+            direction = CAPTURE_DIRECTION (action->value);
         }
 
         if (direction > EXIT_NONE && direction < EXIT_SPECIAL)
@@ -1111,116 +1412,112 @@ static gboolean parse_action_navigation (parse_action_t *action, gchar *subject,
  ======================================================================== */
 
 static gboolean parse_action_player (parse_action_t *action, gchar *subject,
-    parse_regexp_t *parse_regexp, gint *ovector, gint strings)
+    parse_regexp_t *parse_regexp, parse_captures_t *captures)
 {
     player_t *player = NULL;
 
     if (action->value)
     {
-        GET_PCRE_SUBSTR (action->value);
-        player = player_db_lookup (pcre_substr);
+        player = player_db_lookup (CAPTURE_STR (action->value));
     }
     else
         player = selected_player;
 
-    if (!strcasecmp (action->arg, "AddMember") && player)
+    if (action->code == ARG_ADD_MEMBER && player)
     {
         party_member_add (player);
     }
 
-    else if (!strcasecmp (action->arg, "AddUnique") && action->value)
+    else if (action->code == ARG_ADD_UNIQUE && action->value)
     {
-        GET_PCRE_SUBSTR (action->value);
-        player_db_add (pcre_substr);
+        player_db_add (CAPTURE_STR (action->value));
     }
 
-    else if (!strcasecmp (action->arg, "Deselect"))
+    else if (action->code == ARG_DESELECT)
     {
         selected_player = NULL;
     }
 
-    else if (!strcasecmp (action->arg, "FollowerAdd") && player)
+    else if (action->code == ARG_FOLLOWER_ADD && player)
     {
         party_follower_add (player);
     }
 
-    else if (!strcasecmp (action->arg, "FollowerDel") && player)
+    else if (action->code == ARG_FOLLOWER_DEL && player)
     {
         party_follower_del (player);
     }
 
-    else if (!strcasecmp (action->arg, "Health") && action->value)
+    else if (action->code == ARG_HEALTH && action->value)
     {
         if (selected_player)
         {
-            GET_PCRE_SUBSTR (action->value);
-            selected_player->hp.p = atoi (pcre_substr);
+            selected_player->hp.p = CAPTURE_INT (action->value);
             selected_player->hp.p = CLAMP (selected_player->hp.p, 0, 100);
         }
         else
             printt ("Player:Health requires a selected player!");
     }
 
-    else if (!strcasecmp (action->arg, "Invited") && player)
+    else if (action->code == ARG_INVITED && player)
     {
         FlagON (player->party_flags, PARTY_FLAG_INVITED);
         printt ("DEBUG: %s invited", player->name);
     }
 
-    else if (!strcasecmp (action->arg, "Joined") && player)
+    else if (action->code == ARG_JOINED && player)
     {
         FlagON  (player->party_flags, PARTY_FLAG_JOINED);
         FlagOFF (player->party_flags, PARTY_FLAG_INVITED);
         printt ("DEBUG: %s joined", player->name);
     }
 
-    else if (!strcasecmp (action->arg, "Leader"))
+    else if (action->code == ARG_LEADER)
     {
         /* set to player (or NULL if none set) */
         character.leader = player;
     }
 
-    else if (!strcasecmp (action->arg, "NotJoined") && player)
+    else if (action->code == ARG_NOT_JOINED && player)
     {
         FlagOFF (player->party_flags, PARTY_FLAG_JOINED);
         printt ("DEBUG: %s not joined", player->name);
     }
 
-    else if (!strcasecmp (action->arg, "NotPresent") && player)
+    else if (action->code == ARG_NOT_PRESENT && player)
     {
         FlagOFF (player->party_flags, PARTY_FLAG_PRESENT);
         printt ("DEBUG: %s set to not present", player->name);
     }
 
-    else if (!strcasecmp (action->arg, "NotReady") && player)
+    else if (action->code == ARG_NOT_READY && player)
     {
         player_set_wait (player, TRUE /* activate */);
         printt ("DEBUG: %s set to not ready", player->name);
     }
 
-    else if (!strcasecmp (action->arg, "Mana") && action->value)
+    else if (action->code == ARG_MANA && action->value)
     {
         if (selected_player)
         {
-            GET_PCRE_SUBSTR (action->value);
-            selected_player->ma.p = atoi (pcre_substr);
+            selected_player->ma.p = CAPTURE_INT (action->value);
             selected_player->ma.p = CLAMP (selected_player->ma.p, 0, 100);
         }
         else
             printt ("Player:Mana requires a selected player!");
     }
 
-    else if (!strcasecmp (action->arg, "Offline") && player)
+    else if (action->code == ARG_OFFLINE && player)
     {
         FlagOFF (player->flags, PLAYER_FLAG_ONLINE);
     }
 
-    else if (!strcasecmp (action->arg, "Online") && player)
+    else if (action->code == ARG_ONLINE && player)
     {
         FlagON (player->flags, PLAYER_FLAG_ONLINE);
     }
 
-    else if (!strcasecmp (action->arg, "Present") && player)
+    else if (action->code == ARG_PRESENT && player)
     {
         g_get_current_time (&player->last_seen);
         FlagON (player->party_flags, PARTY_FLAG_PRESENT);
@@ -1228,13 +1525,13 @@ static gboolean parse_action_player (parse_action_t *action, gchar *subject,
         printt ("DEBUG: %s set to present", player->name);
     }
 
-    else if (!strcasecmp (action->arg, "Ready") && player)
+    else if (action->code == ARG_READY && player)
     {
         player_set_wait (player, FALSE /* activate */);
         printt ("DEBUG: %s set to ready", player->name);
     }
 
-    else if (!strcasecmp (action->arg, "Rollcall"))
+    else if (action->code == ARG_ROLLCALL)
     {
         GSList *node;
 
@@ -1251,7 +1548,7 @@ static gboolean parse_action_player (parse_action_t *action, gchar *subject,
         printt ("DEBUG: rollcall initiated");
     }
 
-    else if (!strcasecmp (action->arg, "Select"))
+    else if (action->code == ARG_SELECT)
     {
         /* set selected player (or NULL if none provided) */
         selected_player = player;
@@ -1268,15 +1565,15 @@ static gboolean parse_action_player (parse_action_t *action, gchar *subject,
  ======================================================================== */
 
 static gboolean parse_action_require (parse_action_t *action, gchar *subject,
-    parse_regexp_t *parse_regexp, gint *ovector, gint strings)
+    parse_regexp_t *parse_regexp, parse_captures_t *captures)
 {
-    if (!strcasecmp (action->type, "Require"))
+    if (action->op == ACT_REQUIRE)
     {
-        if (!strcasecmp (action->arg, "Attacking") &&
+        if (action->code == ARG_ATTACKING &&
             command_pending (CMD_ATTACK) == action->value)
             return TRUE;
 
-        else if (!strcasecmp (action->arg, "AutomapLost"))
+        else if (action->code == ARG_AUTOMAP_LOST)
         {
             if (CLAMP (automap.lost, 0, 1) == action->value)
                 return TRUE;
@@ -1284,41 +1581,35 @@ static gboolean parse_action_require (parse_action_t *action, gchar *subject,
                 return FALSE;
         }
 
-        else if (!strcasecmp (action->arg, "Firstname") && action->value)
+        else if (action->code == ARG_FIRST_NAME && action->value)
         {
-            GET_PCRE_SUBSTR (action->value);
-
             if (character.first_name &&
-                !strcasecmp (pcre_substr, character.first_name))
+                !strcasecmp (CAPTURE_STR (action->value), character.first_name))
                 return TRUE;
         }
 
-        else if (!strcasecmp (action->arg, "Follower") && action->value)
+        else if (action->code == ARG_FOLLOWER && action->value)
         {
             player_t *player;
 
-            GET_PCRE_SUBSTR (action->value);
-
-            if ((player = player_db_lookup (pcre_substr)) == NULL)
+            if ((player = player_db_lookup (CAPTURE_STR (action->value))) == NULL)
                 return FALSE;
 
             return party_follower_verify (player);
         }
 
-        else if (!strcasecmp (action->arg, "Gangpathing") &&
+        else if (action->code == ARG_GANGPATHING &&
             command_pending (CMD_GANGPATH) == action->value)
             return TRUE;
 
-        else if (!strcasecmp (action->arg, "Leader") && action->value)
+        else if (action->code == ARG_LEADER && action->value)
         {
-            GET_PCRE_SUBSTR (action->value);
-
             if (character.leader &&
-                !strcasecmp (character.leader->name, pcre_substr))
+                !strcasecmp (character.leader->name, CAPTURE_STR (action->value)))
                 return TRUE;
         }
 
-        else if (!strcasecmp (action->arg, "Movement"))
+        else if (action->code == ARG_MOVEMENT)
         {
             if (!automap.movement &&
                 !command_pending (CMD_MOVE))
@@ -1328,12 +1619,11 @@ static gboolean parse_action_require (parse_action_t *action, gchar *subject,
             {
                 exit_table_t *et;
                 gint direction;
-                GET_PCRE_SUBSTR (action->value);
 
                 if ((et = automap_movement_get_next ()) == NULL)
                     return FALSE;
 
-                direction = automap_get_exit_as_int (pcre_substr);
+                direction = CAPTURE_DIRECTION (action->value);
 
                 if (direction == et->direction)
                     return TRUE;
@@ -1342,54 +1632,54 @@ static gboolean parse_action_require (parse_action_t *action, gchar *subject,
                 return TRUE;
         }
 
-        else if (!strcasecmp (action->arg, "Scanning") &&
+        else if (action->code == ARG_SCANNING &&
             command_pending (CMD_SCAN) == action->value)
             return TRUE;
 
-        else if (!strcasecmp (action->arg, "Speaking") &&
+        else if (action->code == ARG_SPEAKING &&
             command_pending (CMD_SPEAK) == action->value)
             return TRUE;
     }
 
-    else if (!strcasecmp (action->type, "RequireFlag"))
+    else if (action->op == ACT_REQUIRE_FLAG)
     {
-        if (!strcasecmp (action->arg, "Ready") &&
+        if (action->code == ARG_READY &&
             character.flag.ready == action->value)
             return TRUE;
     }
 
-    else if (!strcasecmp (action->type, "RequireOption"))
+    else if (action->op == ACT_REQUIRE_OPTION)
     {
-        if (!strcasecmp (action->arg, "AutoAll")
+        if (action->code == ARG_AUTO_ALL
             && character.option.auto_all == action->value)
             return TRUE;
 
-        else if (!strcasecmp (action->arg, "FollowAttack")
+        else if (action->code == ARG_FOLLOW_ATTACK
             && character.option.follow_attack == action->value)
             return TRUE;
 
-        else if (!strcasecmp (action->arg, "MonsterCheck")
+        else if (action->code == ARG_MONSTER_CHECK
             && character.option.monster_check == action->value)
             return TRUE;
     }
 
-    else if (!strcasecmp (action->type, "RequireRoom"))
+    else if (action->op == ACT_REQUIRE_ROOM)
     {
         if (!strcmp (automap.room_name->str, action->arg))
             return TRUE;
     }
 
-    else if (!strcasecmp (action->type, "RequireState"))
+    else if (action->op == ACT_REQUIRE_STATE)
     {
-        if (!strcasecmp (action->arg, "Engaged") &&
+        if (action->code == ARG_ENGAGED &&
             character.state == STATE_ENGAGED)
             return TRUE;
 
-        else if (!strcasecmp (action->arg, "Resting") &&
+        else if (action->code == ARG_RESTING &&
             character.state == STATE_RESTING)
             return TRUE;
 
-        else if (!strcasecmp (action->arg, "Meditating") &&
+        else if (action->code == ARG_MEDITATING &&
             character.state == STATE_MEDITATING)
             return TRUE;
     }
@@ -1405,52 +1695,50 @@ static gboolean parse_action_require (parse_action_t *action, gchar *subject,
  ======================================================================== */
 
 static gboolean parse_action_stats (parse_action_t *action, gchar *subject,
-    parse_regexp_t *parse_regexp, gint *ovector, gint strings)
+    parse_regexp_t *parse_regexp, parse_captures_t *captures)
 {
-    if (!strcasecmp (action->arg, "AddKill"))
+    if (action->code == ARG_ADD_KILL)
     {
         stats.exp.kills++;
     }
 
-    else if (!strcasecmp (action->arg, "Missed"))
+    else if (action->code == ARG_MISSED)
     {
         stats.misses++;
         return TRUE;
     }
 
     if (!action->value)
-        return TRUE; /* pcre_substr required beyond this point */
-
-    GET_PCRE_SUBSTR (action->value);
+        return TRUE; /* capture required beyond this point */
 
-    if (!strcasecmp (action->arg, "BackstabHit"))
-        stats_combat_add_damage (&stats.backstab, atoi (pcre_substr));
+    if (action->code == ARG_BACKSTAB_HIT)
+        stats_combat_add_damage (&stats.backstab, CAPTURE_INT (action->value));
 
-    else if (!strcasecmp (action->arg, "CriticalHit"))
-        stats_combat_add_damage (&stats.critical, atoi (pcre_substr));
+    else if (action->code == ARG_CRITICAL_HIT)
+        stats_combat_add_damage (&stats.critical, CAPTURE_INT (action->value));
 
-    else if (!strcasecmp (action->arg, "ExpGained"))
+    else if (action->code == ARG_EXP_GAINED)
     {
-        gint gained = atoi (pcre_substr);
+        gint gained = CAPTURE_INT (action->value);
         stats.exp.total  += gained;
         stats.exp.gained += gained;
         stats.exp.needed = MAX (0, stats.exp.needed - gained);
     }
 
-    else if (!strcasecmp (action->arg, "ExpNeeded"))
-        stats.exp.needed = atoi (pcre_substr);
+    else if (action->code == ARG_EXP_NEEDED)
+        stats.exp.needed = CAPTURE_INT (action->value);
 
-    else if (!strcasecmp (action->arg, "ExpTotal"))
-        stats.exp.total = atoi (pcre_substr);
+    else if (action->code == ARG_EXP_TOTAL)
+        stats.exp.total = CAPTURE_INT (action->value);
 
-    else if (!strcasecmp (action->arg, "ExtraHit"))
-        stats_combat_add_damage (&stats.extra, atoi (pcre_substr));
+    else if (action->code == ARG_EXTRA_HIT)
+        stats_combat_add_damage (&stats.extra, CAPTURE_INT (action->value));
 
-    else if (!strcasecmp (action->arg, "MagicalHit"))
-        stats_combat_add_damage (&stats.magical, atoi (pcre_substr));
+    else if (action->code == ARG_MAGICAL_HIT)
+        stats_combat_add_damage (&stats.magical, CAPTURE_INT (action->value));
 
-    else if (!strcasecmp (action->arg, "NormalHit"))
-        stats_combat_add_damage (&stats.normal, atoi (pcre_substr));
+    else if (action->code == ARG_NORMAL_HIT)
+        stats_combat_add_damage (&stats.normal, CAPTURE_INT (action->value));
 
     return TRUE;
 }
@@ -1463,16 +1751,15 @@ static gboolean parse_action_stats (parse_action_t *action, gchar *subject,
  ======================================================================== */
 
 static gboolean parse_action_target (parse_action_t *action, gchar *subject,
-    parse_regexp_t *parse_regexp, gint *ovector, gint strings)
+    parse_regexp_t *parse_regexp, parse_captures_t *captures)
 {
     monster_t *monster;
     gchar *prefix = NULL;
 
-    if (!strncasecmp (action->arg, "Add", 3) && action->value)
+    if ((action->code == ARG_ADD_ALWAYS
+        || action->code == ARG_ADD_UNIQUE) && action->value)
     {
-        GET_PCRE_SUBSTR (action->value);
-
-        monster = monster_lookup (pcre_substr, &prefix);
+        monster = monster_lookup (CAPTURE_STR (action->value), &prefix);
 
         if (!monster)
             return TRUE; /* invalid target */
@@ -1511,21 +1798,19 @@ static gboolean parse_action_target (parse_action_t *action, gchar *subject,
             || character.flag.running)
             return TRUE;
 
-        if (!strcasecmp (action->arg, "AddAlways"))
+        if (action->code == ARG_ADD_ALWAYS)
             monster_target_add (monster, prefix);
 
-        else if (!strcasecmp (action->arg, "AddUnique") &&
+        else if (action->code == ARG_ADD_UNIQUE &&
             !monster_target_lookup (monster, prefix))
             monster_target_add (monster, prefix);
     }
 
-    else if (!strcasecmp (action->arg, "Engage") && action->value)
+    else if (action->code == ARG_ENGAGE && action->value)
     {
         gchar *prefix = NULL;
 
-        GET_PCRE_SUBSTR (action->value);
-
-        if ((monster = monster_lookup (pcre_substr, &prefix)) == NULL)
+        if ((monster = monster_lookup (CAPTURE_STR (action->value), &prefix)) == NULL)
             return TRUE;
 
         if ((monster = monster_target_lookup (monster, prefix)) == NULL)
@@ -1534,13 +1819,11 @@ static gboolean parse_action_target (parse_action_t *action, gchar *subject,
         monster_target_override (monster, TRUE /* re-engage */);
     }
 
-    else if (!strcasecmp (action->arg, "Override") && action->value)
+    else if (action->code == ARG_OVERRIDE && action->value)
     {
         gchar *prefix = NULL;
 
-        GET_PCRE_SUBSTR (action->value);
-
-        if ((monster = monster_lookup (pcre_substr, &prefix)) == NULL)
+        if ((monster = monster_lookup (CAPTURE_STR (action->value), &prefix)) == NULL)
             return TRUE;
 
         if ((monster = monster_target_lookup (monster, prefix)) == NULL)
@@ -1549,23 +1832,21 @@ static gboolean parse_action_target (parse_action_t *action, gchar *subject,
         monster_target_override (monster, FALSE /* re-engage */);
     }
 
-    else if (!strcasecmp (action->arg, "Remove"))
+    else if (action->code == ARG_REMOVE)
     {
         if (action->value)
         {
-            GET_PCRE_SUBSTR (action->value);
-
             if ((monster = monster_target_get ()) == NULL)
                 return TRUE;
 
-            if (!strcasecmp (pcre_substr, monster->name))
+            if (!strcasecmp (CAPTURE_STR (action->value), monster->name))
                 monster_target_del ();
         }
         else
             monster_target_del ();
     }
 
-    else if (!strcasecmp (action->arg, "Reset"))
+    else if (action->code == ARG_RESET)
     {
         monster_target_list_free ();
     }
@@ -23,7 +23,8 @@
 
 extern player_t *selected_player;
 
+gboolean parse_action_resolve (parse_action_t *action);
 gboolean parse_action_dispatch (parse_action_t *action, gchar *subject,
-	parse_regexp_t *parse_regexp, gint *ovector, gint strings);
+	parse_regexp_t *parse_regexp, parse_captures_t *captures);
 
 #endif /* __DISPATCH_H__ */
@@ -122,7 +122,7 @@ void guidebook_cleanup (void)
 void guidebook_db_load (void)
 {
 	gchar buf[STD_STRBUF];
-	gchar *offset;
+	gchar *offset, *id;
 	guidebook_record_t *record;
 	FILE *fp;
 
@@ -148,7 +148,9 @@ void guidebook_db_load (void)
 
 		offset = buf;
 		record->name = get_token_as_str (&offset);
-		record->id = get_token_as_str (&offset);
+		id = get_token_as_str (&offset);
+		record->id = automap_id_intern (id);
+		g_free (id);
 
 		guidebook_db = g_slist_insert_sorted (guidebook_db, record,
 			guidebook_db_sort_name);
@@ -173,7 +175,6 @@ static void guidebook_db_free (void)
 	{
 		record = node->data;
 		g_free (record->name);
-		g_free (record->id);
 		g_free (record);
 	}
 
@@ -210,7 +211,8 @@ void guidebook_db_save (void)
 	{
 		record = node->data;
 		if (record->name && record->id)
-			fprintf (fp, "\"%s\", \"%s\"\n", record->name, record->id);
+			fprintf (fp, "\"%s\", \"%s\"\n", record->name,
+				automap_id_to_str (record->id));
 	}
 
 	fclose (fp);
@@ -238,16 +240,16 @@ void guidebook_db_reset (void)
  = Adds location to the guidebook
  ======================================================================== */
 
-void guidebook_db_add (gchar *str, gchar *id)
+void guidebook_db_add (gchar *str, guint32 id)
 {
 	guidebook_record_t *record;
 
 	g_assert (str != NULL);
-	g_assert (id != NULL);
+	g_assert (id != 0);
 
 	record = g_malloc0 (sizeof (guidebook_record_t));
 	record->name = g_strdup (str);
-	record->id   = g_strdup (id);
+	record->id   = id;
 
 	guidebook_db_size++;
 	guidebook_db = g_slist_insert_sorted (guidebook_db, record,
@@ -266,7 +268,6 @@ void guidebook_db_del (guidebook_record_t *record)
 	g_assert (record != NULL);
 
 	g_free (record->name);
-	g_free (record->id);
 
 	guidebook_db_size = MIN (0, guidebook_db_size - 1);
 	guidebook_db = g_slist_remove (guidebook_db, record);
@@ -447,7 +448,7 @@ gboolean guidebook_key_handler (gint ch)
 			guidebook_record_t *record = g_slist_nth_data
 				(guidebook_db, LISTVIEW_SELECTION (listview));
 
-			if (record == NULL)
+			if (record == NULL || record->id == 0)
 				return TRUE;
 
 			navigation_anchor_add (record->id, TRUE /* clear list */);
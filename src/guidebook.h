@@ -28,7 +28,7 @@
 typedef struct
 {
 	gchar *name; /* location room name */
-	gchar *id;   /* location ID */
+	guint32 id;  /* location ID */
 } guidebook_record_t;
 
 extern cwin_t guidebook;
@@ -39,7 +39,7 @@ void guidebook_cleanup (void);
 void guidebook_db_load (void);
 void guidebook_db_save (void);
 void guidebook_db_reset (void);
-void guidebook_db_add (gchar *str, gchar *id);
+void guidebook_db_add (gchar *str, guint32 id);
 void guidebook_db_del (guidebook_record_t *record);
 void guidebook_map (void);
 void guidebook_unmap (void);
@@ -379,8 +379,7 @@ static void mapview_draw_room_flags (void)
 static void mapview_draw_location (automap_record_t *location, gint x, gint y)
 {
 	exit_info_t *exit_info;
-	gint attr, ch, i;
-	GSList *node;
+	gint attr, ch, i, slot;
 
 	g_assert (location != NULL);
 
@@ -425,10 +424,10 @@ static void mapview_draw_location (automap_record_t *location, gint x, gint y)
 	}
 
 	/* draw exit paths */
-	for (node = location->exit_list; node; node = node->next)
+	for (slot = 0; slot < EXIT_SLOTS; slot++)
 	{
-		g_assert (node->data != NULL);
-		exit_info = node->data;
+		if ((exit_info = location->exit[slot]) == NULL)
+			continue;
 
 		/* only show adjacent exits */
 		if (exit_info->direction < EXIT_NORTH ||
@@ -436,7 +435,7 @@ static void mapview_draw_location (automap_record_t *location, gint x, gint y)
 			continue;
 
 		/* select exits attributes */
-		if (!strcmp (exit_info->id, "0"))
+		if (!exit_info->id)
 			attr = ATTR_SUBTLE | A_BOLD;
 		else if (exit_info->flags & EXIT_FLAG_BLOCKED)
 			attr = ATTR_DIM | A_BOLD;
@@ -468,8 +467,7 @@ static void mapview_propagate (automap_record_t *location, gint x, gint y)
 {
 	exit_info_t *exit_info;
 	automap_record_t *record;
-	GSList *node;
-	gint i, xx, yy;
+	gint i, slot, xx, yy;
 
 	g_assert (location != NULL);
 
@@ -482,14 +480,11 @@ static void mapview_propagate (automap_record_t *location, gint x, gint y)
 	MAPVIEW_HISTORY (x, y) = 1;
 
 	/* propagate through available exits */
-	for (node = location->exit_list; node; node = node->next)
+	for (slot = 0; (exit_info = automap_exit_next (location, &slot)); )
 	{
-		g_assert (node->data != NULL);
-		exit_info = node->data;
-
 		i = po2 (exit_info->direction);
 
-		if (!strcmp (exit_info->id, "0") || (exit_info->flags & EXIT_FLAG_ONEWAY))
+		if (!exit_info->id || (exit_info->flags & EXIT_FLAG_ONEWAY))
 			continue;
 
 		xx = x + gt[i].x;
@@ -32,6 +32,7 @@
 #include "mudpro.h"
 #include "navigation.h"
 #include "osd.h"
+#include "parse.h"
 #include "sock.h"
 #include "terminal.h"
 #include "utils.h"
@@ -290,6 +291,16 @@ static menu_item_t help_menu_items[]=
 		NULL,                     NULL,
 		mudpro_create_report_log, NULL },
 
+	{ NULL, 0, MENU_ITEM_SEPARATOR, NULL, NULL, NULL, NULL },
+
+	{ "_Profile Parse Patterns", 'p', MENU_ITEM_TOGGLE,
+		menubar_toggle_access,    &character.parse_profile,
+		NULL,                     NULL },
+
+	{ "Dump Parse Pro_file", 'f', MENU_ITEM_NORMAL,
+		NULL,                     NULL,
+		parse_profile_dump,       NULL },
+
 	{ NULL, 0, 0, NULL, NULL, NULL, NULL }
 };
 
@@ -639,10 +650,10 @@ static gboolean menubar_mudpro_access (gpointer data)
 	if (MENU_ACCESS_RESTRICTED)
 		return FALSE;
 
-	if (sock.alive && item->activate == mudpro_connect)
+	if ((sock.alive || sockIsPending ()) && item->activate == mudpro_connect)
 		return FALSE;
 
-	if (!sock.alive && item->activate == mudpro_disconnect)
+	if (!sock.alive && !sockIsPending () && item->activate == mudpro_disconnect)
 		return FALSE;
 
 	return TRUE;
@@ -21,6 +21,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
+#include <poll.h>
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <unistd.h>
@@ -57,8 +58,6 @@
 #include "timers.h"
 #include "utils.h"
 
-#define IO_POLL_RATE 20000
-
 args_t args;
 mudpro_db_t mudpro_db;
 
@@ -231,6 +230,8 @@ void mudpro_create_report_log (void)
 	combat_report (fp);
 	command_report (fp);
 	navigation_report (fp);
+	parse_report (fp);
+	sockBufReport (fp);
 	timers_report (fp);
 
 	fclose (fp);
@@ -469,12 +470,12 @@ void mudpro_connect (void)
 {
 	gchar *port;
 
-	if (sockIsAlive ())
-		return; /* already connected */
+	if (sockIsAlive () || sockIsPending ())
+		return; /* already connected or connecting */
 
 	port = g_strdup_printf ("%d", character.port);
 
-	/* attempt to establish connection */
+	/* begin establishing connection, the I/O loop sees it through */
 
 	terminal_clear ();
 	printt ("Connecting to host: %s:%s", character.hostname, port);
@@ -482,7 +483,33 @@ void mudpro_connect (void)
 	character.flag.disconnected = FALSE;
 	stats.connects++;
 
-	if (!sockOpen (character.hostname, port))
+	/* connect timer measures the attempt, timers_update() gives up
+	 * on an address after TIMEOUT_SEC_CONNECT */
+	timer_start (timers.connect);
+
+	if (sockOpen (character.hostname, port))
+		mudpro_connect_finish ();
+
+	g_free (port);
+}
+
+
+/* =========================================================================
+ = MUDPRO_CONNECT_FINISH
+ =
+ = Complete a connection attempt that is no longer pending
+ ======================================================================== */
+
+void mudpro_connect_finish (void)
+{
+	gint y, x;
+
+	/* clear connection progress */
+	getyx (terminal.w, y, x);
+	wmove (terminal.w, y, 0);
+	wclrtoeol (terminal.w);
+
+	if (sockIsAlive ())
 	{
 		timer_stop (timers.connect);
 		timer_reset (timers.connect);
@@ -504,8 +531,6 @@ void mudpro_connect (void)
 		timer_reset (timers.connect);
 		connect_wait = character.wait.connect;
 	}
-
-	g_free (port);
 }
 
 
@@ -517,6 +542,17 @@ void mudpro_connect (void)
 
 void mudpro_disconnect (void)
 {
+	if (sockIsPending ())
+	{
+		/* abandon connection attempt */
+		character.flag.disconnected = TRUE;
+		sockOpenCancel ();
+		timer_stop (timers.connect);
+		timer_reset (timers.connect);
+		connect_wait = 0;
+		return;
+	}
+
 	if (!sockIsAlive ())
 		return; /* already disconnected */
 
@@ -714,11 +750,7 @@ static gboolean mudpro_key_handler (gint ch)
 		break;
 
 	case KEY_CTRL_D: /* disconnect from remote host */
-		if (sockIsAlive ())
-		{
-			character.flag.disconnected = TRUE;
-			sockClose ();
-		}
+		mudpro_disconnect ();
 		break;
 
 	case KEY_CTRL_L: /* redraw screen */
@@ -815,62 +847,84 @@ static void mudpro_key_dispatch (gint ch)
 
 static void mudpro_io_loop (void)
 {
-	GTimeVal tv;
-	fd_set rfds, wfds;
-	gint ch, key;
+	struct pollfd fds[3];
+	gulong next;
+	gint ch, key, timeout;
+	gboolean connecting;
 
 	ch = key = 0;
 
 	do {
-		/* update timers */
+		/* update timers, then sleep until one is due or there is I/O */
 
 		timers_update ();
 
-		/* handle keyboard I/O */
+		/* flush whatever was queued since the last pass in one write,
+		 * anything the socket does not take waits for POLLOUT */
+		if (sockIsAlive ())
+			sockBufWrite ();
 
-		ch = wgetch (terminal.w);
+		next = timers_next_timeout ();
+		timeout = (next / 1000 >= G_MAXINT) ? -1 : (gint) ((next + 999) / 1000);
 
-		if (ch != ERR)
-		{
-			key += ch;
-			if (ch == KEY_ALT)
-				continue;
-			else if (ch == 0x4F && key == (KEY_ALT + 0x4F))
-				continue;
+		fds[0].fd = STDIN_FILENO;
+		fds[0].events = POLLIN;
+		fds[1].fd = sockIsAlive () ? sock.fd : -1;
+		fds[1].events = POLLIN;
+		if (sockBufWHasData ()) fds[1].events |= POLLOUT;
+		fds[2].fd = (sock.state == SOCK_RESOLVING) ? sock.notify : -1;
+		fds[2].events = POLLIN;
 
-			mudpro_key_dispatch (key);
-			key = 0;
-			continue;
+		if ((connecting = (sock.state == SOCK_CONNECTING)))
+		{
+			fds[1].fd = sock.fd;
+			fds[1].events = POLLOUT;
 		}
 
-		/* handle socket I/O */
+		if (poll (fds, 3, timeout) < 0) /* EINTR, eg. SIGWINCH */
+			fds[0].revents = fds[1].revents = fds[2].revents = 0;
 
-		FD_ZERO (&rfds);
-		FD_ZERO (&wfds);
-		FD_SET (sock.fd, &rfds);
-		if (sockBufWHasData ()) FD_SET (sock.fd, &wfds);
+		/* handle connection attempt */
 
-		tv.tv_sec = 0;
-		tv.tv_usec = IO_POLL_RATE;
+		if ((fds[2].revents & POLLIN) && sockOpenResolved ())
+			mudpro_connect_finish ();
 
-		if (select (sock.fd+1, &rfds, &wfds, NULL, (void *) &tv) < 0)
-			continue;
+		if (connecting)
+		{
+			if (fds[1].revents && sockOpenConnected ())
+				mudpro_connect_finish ();
+			fds[1].revents = 0;
+		}
 
-		if (!sockIsAlive ())
-			continue; /* nothing to do, just polling w/select */
+		/* handle socket I/O */
 
-		if (FD_ISSET (sock.fd, &rfds))
+		if (fds[1].revents & (POLLIN | POLLHUP | POLLERR))
 		{
 			sockBufRead ();
 			sockReadLoop ();
 			update_display ();
-            timer_reset (timers.idle);
+			timer_reset (timers.idle);
 		}
 
-		if (FD_ISSET (sock.fd, &wfds))
+		if (sockIsAlive () && (fds[1].revents & POLLOUT))
 		{
 			sockBufWrite ();
 		}
+
+		/* handle keyboard I/O, always polled since curses buffers input
+		 * and wgetch() refreshes the terminal window */
+
+		while (!client_shutdown && (ch = wgetch (terminal.w)) != ERR)
+		{
+			key += ch;
+			if (ch == KEY_ALT)
+				continue;
+			else if (ch == 0x4F && key == (KEY_ALT + 0x4F))
+				continue;
+
+			mudpro_key_dispatch (key);
+			key = 0;
+		}
 	} while (!client_shutdown);
 }
 
@@ -58,6 +58,7 @@ void mudpro_reset_state (gboolean disconnected);
 void mudpro_load_data (void);
 void mudpro_save_data (void);
 void mudpro_connect (void);
+void mudpro_connect_finish (void);
 void mudpro_disconnect (void);
 void temporary_chatlog_append (gchar *str);
 void mudpro_redraw_display (void);
@@ -90,7 +90,7 @@ void navigation_report (FILE *fp)
 		record = automap_db_lookup (destination->id);
 
 		fprintf (fp, "  Current Destination: %s (%s)\n",
-			destination->id,
+			automap_id_to_str (destination->id),
 			record ? record->name : "N/A");
 	}
 	else
@@ -111,10 +111,10 @@ void navigation_report (FILE *fp)
 
 		for (node = navigation.anchors; node; node = node->next)
 		{
-			record = automap_db_lookup ((gchar *) node->data);
+			record = automap_db_lookup (GPOINTER_TO_UINT (node->data));
 
 			fprintf (fp, "    [%2d] %s (%s)\n",
-				count++, record->id, record->name);
+				count++, automap_id_to_str (record->id), record->name);
 		}
 		fprintf (fp, "\n");
 	}
@@ -144,8 +144,8 @@ exit_info_t *navigation_autoroam (gint mode)
 	exit_info_t *exit_info, *retval = NULL;
 	automap_record_t *record;
 	GTimeVal tv;
-	GSList *node;
 	gulong flags = 0;
+	gint i = 0;
 
 	if (automap.lost || !automap.location)
 		return navigation_autoroam_lost ();
@@ -155,11 +155,9 @@ exit_info_t *navigation_autoroam (gint mode)
 	else
 		g_get_current_time (&tv);
 
-	for (node = automap.location->exit_list; node; node = node->next)
+	while ((exit_info = automap_exit_next (automap.location, &i)) != NULL)
 	{
-		exit_info = node->data;
-
-		if (!strcmp (exit_info->id, "0") ||
+		if (!exit_info->id ||
 			((exit_info->flags & EXIT_FLAG_DOOR) && !autoroam_opts.use_doors) ||
 			((exit_info->flags & EXIT_FLAG_SECRET) && !autoroam_opts.use_secrets) ||
 			 (exit_info->flags & EXIT_FLAG_BLOCKED) ||
@@ -220,7 +218,7 @@ exit_info_t *navigation_autoroam_lost (void)
 			continue;
 
 		origin = et->opposite;
-		exit_info_lost.id        = NULL;
+		exit_info_lost.id        = 0;
 		exit_info_lost.str       = NULL;
 		exit_info_lost.direction = et->direction;
 		exit_info_lost.flags     = 0;
@@ -241,9 +239,9 @@ exit_info_t *navigation_autoroam_lost (void)
 
 exit_info_t *navigation_route_next (gint mode)
 {
-	GSList *node;
 	automap_record_t *dest;
 	exit_info_t *exit_info;
+	gint i = 0;
 
 	if (!navigation.route)
 		return NULL;
@@ -254,10 +252,9 @@ exit_info_t *navigation_route_next (gint mode)
 	g_assert (navigation.route->data != NULL);
 	dest = navigation.route->data;
 
-	for (node = automap.location->exit_list; node; node = node->next)
+	while ((exit_info = automap_exit_next (automap.location, &i)) != NULL)
 	{
-		exit_info = node->data;
-		if (!strcmp (exit_info->id, dest->id))
+		if (exit_info->id == dest->id)
 		{
 			navigation.flags = dest->flags;
 			return exit_info;
@@ -289,7 +286,7 @@ void navigation_create_route (void)
 	if (!navigation.anchors)
 		return; /* cannot create route without an anchor */
 
-	if ((anchor = automap_db_lookup ((gchar *) navigation.anchors->data)) == NULL)
+	if ((anchor = automap_db_lookup (GPOINTER_TO_UINT (navigation.anchors->data))) == NULL)
 		return; /* anchor is invalid */
 
 	if (navigation.route)
@@ -337,12 +334,13 @@ static GNode *navigation_create_route_propagate (automap_record_t *anchor, GSLis
 		GNode *node = r->data;
 		automap_record_t *room = node->data;
 
-		if (!strcmp (room->id, anchor->id)) {
+		if (room->id == anchor->id) {
 			return node; // found shortest path to destination
 		}
 
-		for (GSList *e = room->exit_list; e; e = e->next) {
-			exit_info_t *ei = e->data;
+		exit_info_t *ei;
+
+		for (gint i = 0; (ei = automap_exit_next (room, &i)); ) {
 			automap_record_t *adjacent;
 
 			adjacent = navigation_create_route_propagate_verify (ei);
@@ -375,9 +373,6 @@ static automap_record_t *navigation_create_route_propagate_verify (
 {
 	automap_record_t *record = NULL;
 
-	if (!strcmp (exit_info->id, "0"))
-		return NULL;
-
 	if ((record = automap_db_lookup (exit_info->id)) == NULL)
 		return NULL;
 
@@ -463,11 +458,11 @@ void navigation_anchor_list_free (void)
  = Add anchor to queue
  ======================================================================== */
 
-void navigation_anchor_add (gchar *id, gboolean clear)
+void navigation_anchor_add (guint32 id, gboolean clear)
 {
 	automap_record_t *record;
 
-	g_assert (id != NULL);
+	g_assert (id != 0);
 
 	if (clear) /* clear any other anchors set */
 		navigation_anchor_list_free ();
@@ -487,7 +482,8 @@ void navigation_anchor_add (gchar *id, gboolean clear)
 		automap.enabled = FALSE;
 	}
 
-	navigation.anchors = g_slist_prepend (navigation.anchors, record->id);
+	navigation.anchors = g_slist_prepend (navigation.anchors,
+		GUINT_TO_POINTER (record->id));
 }
 
 
@@ -517,6 +513,7 @@ void navigation_anchor_del (void)
 void navigation_detour (void)
 {
 	gchar *id, *offset;
+	guint32 room;
 
 	if (!destination || !destination->str || destination->str[0] == '\0')
 	{
@@ -532,7 +529,9 @@ void navigation_detour (void)
 	while ((id = get_token_as_str (&offset)) != NULL)
 	{
 		printt ("DEBUG adding %s to anchor queue", id);
-		navigation_anchor_add (id, FALSE /* clear list */);
+
+		if ((room = automap_id_from_str (id)) != 0)
+			navigation_anchor_add (room, FALSE /* clear list */);
 		g_free (id);
 	}
 
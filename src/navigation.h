@@ -55,7 +55,7 @@ void navigation_create_route (void);
 void navigation_route_free (void);
 void navigation_route_step (void);
 void navigation_anchor_list_free (void);
-void navigation_anchor_add (gchar *id, gboolean clear);
+void navigation_anchor_add (guint32 id, gboolean clear);
 void navigation_anchor_del (void);
 void navigation_detour (void);
 void navigation_reset_route (void);
@@ -22,12 +22,14 @@
 
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <time.h>
 
 #include "automap.h"
 #include "character.h"
 #include "combat.h"
 #include "command.h"
 #include "defs.h"
+#include "dfa.h"
 #include "dispatch.h"
 #include "item.h"
 #include "mapview.h"
@@ -35,6 +37,9 @@
 #include "mudpro.h"
 #include "navigation.h"
 #include "parse.h"
+#include "parse_builtin.h"
+#include "parse_cache.h"
+#include "prefilter.h"
 #include "osd.h"
 #include "spells.h"
 #include "stats.h"
@@ -71,57 +76,93 @@ static parse_tag_t tag_list[] = {
 	{ "{8}",		"(\\S+)" },
 	{ "{9}",		"(\\S+)" },
 
-	{ "{hit}",
-		"(attack\\w*|beat\\w*|bludgeon\\w*|chop\\w*|cleave\\w*|clobber\\w*|"
-		"crush\\w*|cut\\w*|hack\\w*|impale\\w*|jab\\w*|jumpkick\\w*|kick\\w*|"
-		"pierce\\w*|pound\\w*|punch\\w*|rip\\w*|shoot\\w*|skewer\\w*|slam\\w*|"
-		"slash\\w*|slice\\w*|smack\\w*|smash\\w*|stab\\w*|sting\\w*|strike\\w*|"
-		"throw\\w*|whap\\w*|whip\\w*|rip\\w*|bite\\w*|lash\\w*|chomp\\w*|"
-		"headbutt\\w*|maul\\w*|pinch\\w*|claw\\w*|darts.+bites|chill\\w*)" },
-
-	{ "{hits}",
-		"(attack\\w*|beat\\w*|bludgeon\\w*|chop\\w*|cleave\\w*|clobber\\w*|"
-		"crush\\w*|cut\\w*|hack\\w*|impale\\w*|jab\\w*|jumpkick\\w*|kick\\w*|"
-		"pierce\\w*|pound\\w*|punch\\w*|rip\\w*|shoot\\w*|skewer\\w*|slam\\w*|"
-		"slash\\w*|slice\\w*|smack\\w*|smash\\w*|stab\\w*|sting\\w*|strike\\w*|"
-		"throw\\w*|whap\\w*|whip\\w*|rip\\w*|bite\\w*|lash\\w*|chomp\\w*|"
-		"headbutt\\w*|maul\\w*|pinch\\w*|claw\\w*|darts.+bites|chill\\w*)" },
-
-	{ "{miss}",
-		"(swing.+at|miss\\w*|lunge.+at|punch\\w*|kick\\w*|jumpkick\\w*|"
-		"thrust.+at|shoot.+at|swipe.+at|swipe\\w*|attack\\w*|hurl.+at|"
-		"throw.+at|wipe.+at|snap.+at|flail.+at|lash.+at|moves towards|"
-		"reaches.+for|claw.+at)" },
-
-	{ "{misses}",
-		"(swing.+at|miss\\w*|lunge.+at|punch\\w*|kick\\w*|jumpkick\\w*|"
-		"thrust.+at|shoot.+at|swipe.+at|swipe\\w*|attack\\w*|hurl.+at|"
-		"throw.+at|wipe.+at|snap.+at|flail.+at|lash.+at|moves towards|"
-		"reaches.+for|claw.+at)" },
-
-	{ "{enters}",
-		"(drops|slithers|stomps|appears|burrows|enters|walks|scurries|moves|"
-		"thunders|lopes|scuttles|strides|flaps|oozes|creeps|sneaks|shambles|"
-		"swims|crawls)" },
-
-	{ "{direction}",
-		"(n|north|s|south|e|east|w|west|"
-		"ne|northeast|nw|northwest|se|southeast|sw|southwest|"
-		"u|up|d|down|above|below|upwards|downwards)" },
+	{ NULL, NULL }
+};
+
+/* built-in word lists, extended by the tags file in the parse directory */
+
+static gchar *tag_words_hit[] = {
+	"attack\\w*", "beat\\w*", "bludgeon\\w*", "chop\\w*", "cleave\\w*",
+	"clobber\\w*", "crush\\w*", "cut\\w*", "hack\\w*", "impale\\w*", "jab\\w*",
+	"jumpkick\\w*", "kick\\w*", "pierce\\w*", "pound\\w*", "punch\\w*",
+	"rip\\w*", "shoot\\w*", "skewer\\w*", "slam\\w*", "slash\\w*", "slice\\w*",
+	"smack\\w*", "smash\\w*", "stab\\w*", "sting\\w*", "strike\\w*",
+	"throw\\w*", "whap\\w*", "whip\\w*", "bite\\w*", "lash\\w*", "chomp\\w*",
+	"headbutt\\w*", "maul\\w*", "pinch\\w*", "claw\\w*", "darts.+bites",
+	"chill\\w*", NULL
+};
+
+static gchar *tag_words_miss[] = {
+	"swing.+at", "miss\\w*", "lunge.+at", "punch\\w*", "kick\\w*",
+	"jumpkick\\w*", "thrust.+at", "shoot.+at", "swipe.+at", "swipe\\w*",
+	"attack\\w*", "hurl.+at", "throw.+at", "wipe.+at", "snap.+at", "flail.+at",
+	"lash.+at", "moves towards", "reaches.+for", "claw.+at", NULL
+};
+
+static gchar *tag_words_enters[] = {
+	"drops", "slithers", "stomps", "appears", "burrows", "enters", "walks",
+	"scurries", "moves", "thunders", "lopes", "scuttles", "strides", "flaps",
+	"oozes", "creeps", "sneaks", "shambles", "swims", "crawls", NULL
+};
+
+static gchar *tag_words_direction[] = {
+	"n", "north", "s", "south", "e", "east", "w", "west",
+	"ne", "northeast", "nw", "northwest", "se", "southeast", "sw", "southwest",
+	"u", "up", "d", "down", "above", "below", "upwards", "downwards", NULL
+};
+
+static parse_tag_words_t tag_word_list[] = {
+
+	{ "{hit}",       tag_words_hit },
+	{ "{hits}",      tag_words_hit },
+	{ "{miss}",      tag_words_miss },
+	{ "{misses}",    tag_words_miss },
+	{ "{enters}",    tag_words_enters },
+	{ "{direction}", tag_words_direction },
 
 	{ NULL, NULL }
 };
 
+static void parse_profile_report (FILE *fp);
+static gint parse_profile_compare (gconstpointer a, gconstpointer b);
+static gint64 parse_profile_clock (void);
 static GString *regexp_tag_substitution (GString *pattern);
+static void parse_tags_load (void);
+static void parse_tags_free (void);
+static parse_tag_t *parse_tags_lookup (const gchar *tag);
+static void parse_tags_add_word (parse_tag_t *pt, const gchar *word);
+static void parse_tags_build (parse_tag_t *pt);
+static parse_trie_t *parse_trie_child (parse_trie_t *node, gchar ch);
+static void parse_trie_emit (parse_trie_t *node, GString *regexp, gboolean top);
+static void parse_trie_free (parse_trie_t *node);
 static gint parse_action_get_value (parse_regexp_t *regexp, gchar **offset);
 static void parse_list_add_action (gpointer data, gpointer user_data);
 static void parse_list_move_regexp (gpointer data, gpointer user_data);
 static void parse_list_free_actions (parse_regexp_t *regexp);
+static void parse_list_adapt (void);
+static GSList *parse_list_remove_db (db_t *parse_db);
+static void parse_list_reload_db (db_t *parse_db);
 static void parse_db_list_build (void);
 static void parse_db_list_free (void);
 static gboolean parse_db_append (db_t *parse_db);
-static gboolean parse_regexp (parse_regexp_t *parse_regexp, gchar *subject);
+static void parse_db_bind_builtin (db_t *parse_db, GSList *regexps,
+	const gchar *digest);
+static void parse_index_build (void);
+static void parse_index_mark (gpointer data, gpointer user_data);
+static parse_match_t *parse_match_get (void);
+static void parse_match_free (gpointer data);
+static void parse_captures_reset (parse_captures_t *captures, const gchar *subject,
+	gsize length, pcre2_match_data *data, gint rc);
+static gboolean parse_regexp (parse_regexp_t *parse_regexp, parse_match_t *match,
+	gchar *subject, gsize length);
 static void parse_regexp_list (gchar *subject);
+static gboolean parse_line_buffer_strip (const gchar *tag, gsize length);
+static gboolean parse_prompt (const gchar *str, gsize length);
+static gboolean parse_prompt_number (const gchar **pos, const gchar *end,
+	gint *value);
+
+/* matching state, one per thread */
+static GPrivate parse_match = G_PRIVATE_INIT (parse_match_free);
 
 
 /* =========================================================================
@@ -157,6 +198,204 @@ void parse_cleanup (void)
 	g_string_free (parse.line_buf, TRUE);
 	g_string_free (parse.wrap_buf, TRUE);
 	g_string_free (parse.room_name, TRUE);
+
+	parse_tags_free ();
+	g_free (parse.tags_db.filename);
+	g_free (parse.tags_key);
+
+	g_private_replace (&parse_match, NULL);
+}
+
+
+/* =========================================================================
+ = PARSE_REPORT
+ =
+ = Report current status of parse module to specified file
+ ======================================================================== */
+
+void parse_report (FILE *fp)
+{
+	GSList *node;
+	parse_regexp_t *regexp;
+	gchar *mode[] = { "Linear", "Literal", "Automaton" };
+	gint indexed = 0, jit = 0;
+
+	for (node = parse.regexp_list; node; node = node->next)
+	{
+		regexp = node->data;
+		if (regexp->indexed)
+			indexed++;
+		if (regexp->jit)
+			jit++;
+	}
+
+	fprintf (fp, "\nPARSE MODULE\n"
+				 "============\n\n");
+
+	fprintf (fp, "  Regexp Patterns ......... %d\n",
+		g_slist_length (parse.regexp_list));
+	fprintf (fp, "  Matching Mode ........... %s\n", mode[parse.mode]);
+	fprintf (fp, "  Indexed Patterns ........ %d\n", indexed);
+	fprintf (fp, "  JIT Compiled Patterns ... %d\n", jit);
+	fprintf (fp, "  JIT Stack Size .......... %dK\n", character.parse_jit_stack);
+	fprintf (fp, "  JIT Stack Overflows ..... %ld\n", parse.stats.jit_errors);
+	fprintf (fp, "  Databases From Cache .... %ld\n", parse.stats.cache_hits);
+	fprintf (fp, "  Databases Compiled ...... %ld\n", parse.stats.cache_misses);
+	fprintf (fp, "  Invalid Actions ......... %ld\n", parse.stats.bad_actions);
+	fprintf (fp, "  Lines Parsed ............ %ld\n", parse.stats.lines);
+	fprintf (fp, "  Candidates Attempted .... %ld\n", parse.stats.candidates);
+	fprintf (fp, "  Candidates Skipped ...... %ld\n", parse.stats.skipped);
+	fprintf (fp, "  Candidates Matched ...... %ld\n", parse.stats.hits);
+	fprintf (fp, "  Builtin Matchers ........ %ld\n", parse.stats.builtin);
+	fprintf (fp, "  Actions Dispatched ...... %ld\n", parse.stats.actions);
+	fprintf (fp, "  Lines Stopped Early ..... %ld\n", parse.stats.stopped);
+	fprintf (fp, "  Adaptive Reorderings .... %ld\n", parse.stats.reorders);
+	fprintf (fp, "  Prompts Decoded ......... %ld\n", parse.stats.prompts);
+	fprintf (fp, "  Prompts Unrecognized .... %ld\n", parse.stats.prompts_other);
+
+	if (parse.stats.lines)
+		fprintf (fp, "  Candidates Per Line ..... %.2f\n",
+			(gdouble) parse.stats.candidates / parse.stats.lines);
+
+	if (parse.dfa)
+	{
+		fprintf (fp, "  Automaton NFA States .... %d\n", parse.dfa->nfa_count);
+		fprintf (fp, "  Automaton Byte Classes .. %d\n", parse.dfa->class_count);
+		fprintf (fp, "  Automaton Cached States . %d\n", parse.dfa->state_count);
+		fprintf (fp, "  Automaton Cache Flushes . %ld\n", parse.dfa->flushes);
+	}
+
+	fprintf (fp, "\n");
+
+	parse_profile_report (fp);
+}
+
+
+/* =========================================================================
+ = PARSE_PROFILE_REPORT
+ =
+ = Report per-pattern statistics, most expensive patterns first
+ ======================================================================== */
+
+static void parse_profile_report (FILE *fp)
+{
+	GPtrArray *sorted;
+	GSList *node;
+	parse_regexp_t *regexp;
+	gulong attempts = 0, dead = 0;
+	guint i;
+
+	sorted = g_ptr_array_new ();
+
+	for (node = parse.regexp_list; node; node = node->next)
+	{
+		regexp = node->data;
+		g_ptr_array_add (sorted, regexp);
+		attempts += regexp->profile.attempts;
+	}
+
+	fprintf (fp, "PARSE PROFILE\n"
+				 "=============\n\n");
+
+	if (!attempts)
+	{
+		fprintf (fp, "  No data collected%s\n\n", character.parse_profile ?
+			"" : " (enable ParseStats or Help -> Profile Parse Patterns)");
+		g_ptr_array_free (sorted, TRUE);
+		return;
+	}
+
+	g_ptr_array_sort (sorted, parse_profile_compare);
+
+	fprintf (fp, "  %10s %8s %8s %10s %8s %7s  %s\n", "Total(us)", "Max(us)",
+		"Avg(ns)", "Attempts", "Hits", "Actions", "Pattern");
+
+	for (i = 0; i < sorted->len; i++)
+	{
+		regexp = g_ptr_array_index (sorted, i);
+
+		if (regexp->profile.attempts && !regexp->profile.hits)
+			dead++;
+
+		fprintf (fp, "  %10.1f %8.1f %8ld %10ld %8ld %7ld  %s\n",
+			regexp->profile.time / 1000.0,
+			regexp->profile.time_max / 1000.0,
+			regexp->profile.attempts ?
+				(glong) (regexp->profile.time / regexp->profile.attempts) : 0,
+			regexp->profile.attempts, regexp->profile.hits,
+			regexp->profile.actions, regexp->pattern);
+	}
+
+	fprintf (fp, "\n  Attempted, never matched: %ld of %d patterns\n\n",
+		dead, sorted->len);
+
+	g_ptr_array_free (sorted, TRUE);
+}
+
+
+/* =========================================================================
+ = PARSE_PROFILE_COMPARE
+ =
+ = Sort patterns by total matching time, then attempts (descending)
+ ======================================================================== */
+
+static gint parse_profile_compare (gconstpointer a, gconstpointer b)
+{
+	const parse_regexp_t *ra = *(parse_regexp_t * const *) a;
+	const parse_regexp_t *rb = *(parse_regexp_t * const *) b;
+
+	if (ra->profile.time != rb->profile.time)
+		return (ra->profile.time < rb->profile.time) ? 1 : -1;
+
+	if (ra->profile.attempts != rb->profile.attempts)
+		return (ra->profile.attempts < rb->profile.attempts) ? 1 : -1;
+
+	return 0;
+}
+
+
+/* =========================================================================
+ = PARSE_PROFILE_DUMP
+ =
+ = Write per-pattern statistics to their own log on demand
+ ======================================================================== */
+
+void parse_profile_dump (void)
+{
+	FILE *fp;
+	gchar *buf;
+
+	buf = g_strdup_printf ("%s.parse.log",
+		character.first_name ? character.first_name : "report");
+
+	if ((fp = fopen (buf, "w")) == NULL)
+	{
+		printt ("Failed to create %s!", buf);
+		g_free (buf);
+		return;
+	}
+
+	parse_profile_report (fp);
+
+	fclose (fp);
+	printt ("Wrote %s", buf);
+	g_free (buf);
+}
+
+
+/* =========================================================================
+ = PARSE_PROFILE_CLOCK
+ =
+ = Returns monotonic time in nanoseconds, for timing individual matches
+ ======================================================================== */
+
+static gint64 parse_profile_clock (void)
+{
+	struct timespec ts;
+
+	clock_gettime (CLOCK_MONOTONIC, &ts);
+
+	return (gint64) ts.tv_sec * 1000000000 + ts.tv_nsec;
 }
 
 
@@ -169,6 +408,7 @@ void parse_cleanup (void)
 static GString *regexp_tag_substitution (GString *pattern)
 {
 	parse_tag_t *pt;
+	GSList *node;
 	gchar *tmp;
 	gint pos = 0;
 
@@ -182,6 +422,18 @@ static GString *regexp_tag_substitution (GString *pattern)
 		}
 	}
 
+	for (node = parse.word_tags; node; node = node->next)
+	{
+		pt = node->data;
+
+		while ((tmp = strstr (pattern->str, pt->tag)) != NULL)
+		{
+			pos = CLAMP ((tmp - pattern->str), 0, (pattern->len - 1));
+			pattern = g_string_erase (pattern, pos, strlen (pt->tag));
+			pattern = g_string_insert (pattern, pos, pt->regexp);
+		}
+	}
+
 	if (pattern->str[0] != '^')
 		pattern = g_string_insert (pattern, 0, "^");
 	if (pattern->str[pattern->len-1] != '$')
@@ -191,6 +443,319 @@ static GString *regexp_tag_substitution (GString *pattern)
 }
 
 
+/* =========================================================================
+ = PARSE_TAGS_LOAD
+ =
+ = Build word list tags from the built-in lists and the tags file
+ ======================================================================== */
+
+static void parse_tags_load (void)
+{
+	parse_tag_words_t *tw;
+	parse_tag_t *pt;
+	GSList *node, *tags = NULL;
+	GString *signature;
+	FILE *fp;
+	gchar buf[STD_STRBUF];
+	gchar **words, **word;
+
+	parse_tags_free ();
+
+	for (tw = tag_word_list; tw->tag; tw++)
+	{
+		pt = parse_tags_lookup (tw->tag);
+		for (word = tw->words; *word; word++)
+			parse_tags_add_word (pt, *word);
+	}
+
+	g_free (parse.tags_db.filename);
+	parse.tags_db.filename = g_strdup_printf ("%s%cparse%c%s",
+		character.data_path, G_DIR_SEPARATOR, G_DIR_SEPARATOR, PARSE_TAGS_FILE);
+	memset (&parse.tags_db.access, 0, sizeof (GTimeVal));
+
+	if ((fp = fopen (parse.tags_db.filename, "r")) != NULL)
+	{
+		g_get_current_time (&parse.tags_db.access);
+
+		while (fgets (buf, sizeof (buf), fp) != NULL)
+		{
+			strchomp (buf);
+
+			if (buf[0] == '#' || buf[0] == '\0')
+				continue;
+
+			if (isspace (buf[0]))
+			{
+				/* add word to the tags heading this section */
+				g_strstrip (buf);
+				for (node = tags; node; node = node->next)
+					parse_tags_add_word (node->data, buf);
+				continue;
+			}
+
+			/* section heading, one or more tags sharing a word list */
+			g_slist_free (tags);
+			tags = NULL;
+
+			words = g_strsplit (buf, " ", 0);
+
+			for (word = words; *word; word++)
+			{
+				if ((*word)[0] == '\0')
+					continue;
+
+				if ((*word)[0] != '{' || (*word)[strlen (*word) - 1] != '}')
+				{
+					printt ("Invalid tag '%s' in %s", *word, parse.tags_db.filename);
+					continue;
+				}
+				tags = g_slist_append (tags, parse_tags_lookup (*word));
+			}
+
+			g_strfreev (words);
+		}
+
+		g_slist_free (tags);
+		fclose (fp);
+	}
+
+	for (node = parse.word_tags; node; node = node->next)
+		parse_tags_build (node->data);
+
+	/* compiled patterns depend on every substitution, key the cache on them */
+	signature = g_string_new ("");
+
+	for (pt = tag_list; pt->tag; pt++)
+		g_string_append_printf (signature, "%s=%s\n", pt->tag, pt->regexp);
+
+	for (node = parse.word_tags; node; node = node->next)
+	{
+		pt = node->data;
+		g_string_append_printf (signature, "%s=%s\n", pt->tag, pt->regexp);
+	}
+
+	g_free (parse.tags_key);
+	parse.tags_key = g_compute_checksum_for_string (G_CHECKSUM_SHA256,
+		signature->str, signature->len);
+	g_string_free (signature, TRUE);
+}
+
+
+/* =========================================================================
+ = PARSE_TAGS_FREE
+ =
+ = Free memory allocated to word list tags
+ ======================================================================== */
+
+static void parse_tags_free (void)
+{
+	GSList *node;
+	parse_tag_t *pt;
+
+	for (node = parse.word_tags; node; node = node->next)
+	{
+		pt = node->data;
+		g_free (pt->tag);
+		g_free (pt->regexp);
+		parse_trie_free (pt->trie);
+		g_free (pt);
+	}
+	g_slist_free (parse.word_tags);
+	parse.word_tags = NULL;
+}
+
+
+/* =========================================================================
+ = PARSE_TAGS_LOOKUP
+ =
+ = Returns word list tag, creating it if it does not exist
+ ======================================================================== */
+
+static parse_tag_t *parse_tags_lookup (const gchar *tag)
+{
+	GSList *node;
+	parse_tag_t *pt;
+
+	for (node = parse.word_tags; node; node = node->next)
+	{
+		pt = node->data;
+		if (!strcmp (pt->tag, tag))
+			return pt;
+	}
+
+	pt = g_malloc0 (sizeof (parse_tag_t));
+	pt->tag  = g_strdup (tag);
+	pt->trie = g_malloc0 (sizeof (parse_trie_t));
+
+	parse.word_tags = g_slist_append (parse.word_tags, pt);
+
+	return pt;
+}
+
+
+/* =========================================================================
+ = PARSE_TAGS_ADD_WORD
+ =
+ = Add word (a regexp fragment) to a tag's trie. The literal prefix of the
+ = word is stored along the trie, the rest is kept as a suffix of the node
+ = it ends at. Duplicate words are ignored
+ ======================================================================== */
+
+static void parse_tags_add_word (parse_tag_t *pt, const gchar *word)
+{
+	parse_trie_t *node = pt->trie;
+	const gchar *suffix;
+	gint i, prefix;
+
+	if (word[0] == '\0')
+		return;
+
+	if (strchr (word, '|'))
+		prefix = 0; /* alternation is kept whole, grouped below */
+	else
+	{
+		prefix = strcspn (word, "\\.^$|?*+()[]{}");
+
+		/* a quantifier applies to the last literal character */
+		if (prefix > 0 && word[prefix] != '\0' && strchr ("?*+{", word[prefix]))
+			prefix--;
+	}
+
+	for (i = 0; i < prefix; i++)
+		node = parse_trie_child (node, word[i]);
+
+	suffix = word + prefix;
+
+	if (g_slist_find_custom (node->suffixes, suffix, (GCompareFunc) strcmp))
+		return;
+
+	if (suffix[0] == '\0') /* shortest alternative first, as in the old lists */
+		node->suffixes = g_slist_prepend (node->suffixes, g_strdup (""));
+	else if (strchr (suffix, '|'))
+		node->suffixes = g_slist_append (node->suffixes,
+			g_strdup_printf ("(?:%s)", suffix));
+	else
+		node->suffixes = g_slist_append (node->suffixes, g_strdup (suffix));
+}
+
+
+/* =========================================================================
+ = PARSE_TAGS_BUILD
+ =
+ = Build tag regexp from its trie, common prefixes are only matched once
+ = so a failing word is abandoned after its first differing character
+ ======================================================================== */
+
+static void parse_tags_build (parse_tag_t *pt)
+{
+	GString *regexp = g_string_new ("(");
+
+	parse_trie_emit (pt->trie, regexp, TRUE);
+	regexp = g_string_append_c (regexp, ')');
+
+	g_free (pt->regexp);
+	pt->regexp = g_string_free (regexp, FALSE);
+}
+
+
+/* =========================================================================
+ = PARSE_TRIE_CHILD
+ =
+ = Returns child of node for ch, creating it if it does not exist
+ ======================================================================== */
+
+static parse_trie_t *parse_trie_child (parse_trie_t *node, gchar ch)
+{
+	GSList *link, *prev = NULL;
+	parse_trie_t *child;
+
+	for (link = node->children; link; prev = link, link = link->next)
+	{
+		child = link->data;
+
+		if (child->ch == ch)
+			return child;
+		if (child->ch > ch)
+			break;
+	}
+
+	child = g_malloc0 (sizeof (parse_trie_t));
+	child->ch = ch;
+
+	/* keep children sorted by label */
+	if (prev)
+		prev->next = g_slist_prepend (prev->next, child);
+	else
+		node->children = g_slist_prepend (node->children, child);
+
+	return child;
+}
+
+
+/* =========================================================================
+ = PARSE_TRIE_EMIT
+ =
+ = Append regexp matching every word below node. Alternatives are wrapped
+ = in a non-capturing group so substring numbering is unaffected
+ ======================================================================== */
+
+static void parse_trie_emit (parse_trie_t *node, GString *regexp, gboolean top)
+{
+	GSList *link;
+	parse_trie_t *child;
+	gboolean group, first = TRUE;
+
+	group = !top &&
+		(g_slist_length (node->suffixes) + g_slist_length (node->children)) > 1;
+
+	if (group)
+		regexp = g_string_append (regexp, "(?:");
+
+	for (link = node->suffixes; link; link = link->next, first = FALSE)
+	{
+		if (!first)
+			regexp = g_string_append_c (regexp, '|');
+		regexp = g_string_append (regexp, link->data);
+	}
+
+	for (link = node->children; link; link = link->next, first = FALSE)
+	{
+		child = link->data;
+
+		if (!first)
+			regexp = g_string_append_c (regexp, '|');
+		regexp = g_string_append_c (regexp, child->ch);
+		parse_trie_emit (child, regexp, FALSE);
+	}
+
+	if (group)
+		regexp = g_string_append_c (regexp, ')');
+}
+
+
+/* =========================================================================
+ = PARSE_TRIE_FREE
+ =
+ = Free memory allocated to trie
+ ======================================================================== */
+
+static void parse_trie_free (parse_trie_t *node)
+{
+	GSList *link;
+
+	if (!node)
+		return;
+
+	for (link = node->children; link; link = link->next)
+		parse_trie_free (link->data);
+
+	g_slist_foreach (node->suffixes, (GFunc) g_free, NULL);
+	g_slist_free (node->suffixes);
+	g_slist_free (node->children);
+	g_free (node);
+}
+
+
 /* ==========================================================================
  = PARSE_ACTION_GET_VALUE
  =
@@ -278,9 +843,35 @@ static void parse_list_add_action (gpointer data, gpointer user_data)
 
 	offset = str;
 	action->type  = get_token_as_str (&offset);
+
+	/* not an action, flags the regexp(s) it is grouped with */
+	if (action->type && (!strcasecmp (action->type, "Exclusive") ||
+		!strcasecmp (action->type, "Inclusive")))
+	{
+		regexp->exclusive = !strcasecmp (action->type, "Exclusive");
+		g_free (action->type);
+		g_free (action);
+		return;
+	}
+
 	action->arg   = get_token_as_str (&offset);
 	action->value = parse_action_get_value (regexp, &offset);
 
+	if (!parse_action_resolve (action))
+	{
+		if (action->type) /* not just a blank line */
+		{
+			printt ("Invalid parse action '%s %s' for '%s'", action->type,
+				action->arg ? action->arg : "", regexp->pattern);
+			parse.stats.bad_actions++;
+		}
+
+		g_free (action->type);
+		g_free (action->arg);
+		g_free (action);
+		return;
+	}
+
 	regexp->actions = g_slist_append (regexp->actions, action);
 }
 
@@ -326,6 +917,61 @@ static void parse_list_free_actions (parse_regexp_t *regexp)
 }
 
 
+/* ==========================================================================
+ = PARSE_LIST_ADAPT
+ =
+ = Move the most frequently matched exclusive regexps forward. Only runs
+ = of adjacent exclusive regexps from the same file are reordered, so
+ = anything a non-exclusive regexp has to be tried before or after stays
+ = where it was
+ ========================================================================= */
+
+static void parse_list_adapt (void)
+{
+	GSList *run, *node, *pos;
+	parse_regexp_t *regexp, *first;
+	gpointer carry, swap;
+
+	for (run = parse.regexp_list; run; run = node)
+	{
+		first = run->data;
+		node = run->next;
+
+		if (!first->exclusive)
+			continue;
+
+		/* stable insertion sort, heaviest first */
+		for (; node; node = node->next)
+		{
+			regexp = node->data;
+
+			if (!regexp->exclusive || regexp->source != first->source)
+				break; /* end of run */
+
+			for (pos = run; pos != node; pos = pos->next)
+			{
+				if (((parse_regexp_t *) pos->data)->weight < regexp->weight)
+					break;
+			}
+
+			/* shift pos .. node down one, regexp goes in at pos */
+			for (carry = regexp; pos != node->next; pos = pos->next)
+			{
+				swap = pos->data;
+				pos->data = carry;
+				carry = swap;
+			}
+		}
+	}
+
+	/* decay, so the order follows what is matching lately */
+	for (node = parse.regexp_list; node; node = node->next)
+		((parse_regexp_t *) node->data)->weight /= 2;
+
+	parse.stats.reorders++;
+}
+
+
 /* ==========================================================================
  = PARSE_LIST_COMPILE
  =
@@ -339,6 +985,8 @@ void parse_list_compile (void)
 	if (parse.regexp_list)
 		parse_list_free ();
 
+	parse_tags_load ();
+
 	for (node = parse.db_list; node; node = node->next)
 	{
 		if (parse_db_append (node->data))
@@ -351,6 +999,8 @@ void parse_list_compile (void)
 
     if (parse.regexp_list)
 		parse.regexp_list = g_slist_reverse (parse.regexp_list);
+
+	parse_index_build ();
 }
 
 
@@ -363,19 +1013,116 @@ void parse_list_compile (void)
 void parse_list_free (void)
 {
 	GSList *node;
-	parse_regexp_t *regexp;
 
 	for (node = parse.regexp_list; node; node = node->next)
+		parse_regexp_free (node->data);
+	g_slist_free (parse.regexp_list);
+	parse.regexp_list = NULL;
+
+	prefilter_free (parse.prefilter);
+	parse.prefilter = NULL;
+
+	dfa_free (parse.dfa);
+	parse.dfa = NULL;
+}
+
+
+/* =========================================================================
+ = PARSE_REGEXP_FREE
+ =
+ = Free memory allocated to a parse list entry
+ ======================================================================== */
+
+void parse_regexp_free (parse_regexp_t *regexp)
+{
+	g_assert (regexp != NULL);
+
+	g_free (regexp->pattern);
+	if (regexp->compiled)
+		pcre2_code_free (regexp->compiled);
+	g_free (regexp->expanded);
+	g_free (regexp->literal);
+	parse_list_free_actions (regexp);
+	g_free (regexp);
+}
+
+
+/* =========================================================================
+ = PARSE_LIST_REMOVE_DB
+ =
+ = Remove regexps loaded from a database file. Returns the node they
+ = followed (NULL if at the head of the list), where a reload belongs
+ ======================================================================== */
+
+static GSList *parse_list_remove_db (db_t *parse_db)
+{
+	GSList *node, *next, *prev = NULL, *link;
+	parse_regexp_t *regexp;
+
+	/* each file's regexps are contiguous and in parse.db_list order */
+	node = parse.regexp_list;
+
+	for (link = parse.db_list; link && link->data != parse_db; link = link->next)
 	{
-		regexp = node->data;
-		g_free (regexp->pattern);
-		g_free (regexp->compiled);
-		g_free (regexp->studied);
-		parse_list_free_actions (regexp);
-		g_free (regexp);
+		while (node && ((parse_regexp_t *) node->data)->source == link->data)
+		{
+			prev = node;
+			node = node->next;
+		}
 	}
-	g_slist_free (parse.regexp_list);
+
+	while (node && (regexp = node->data)->source == parse_db)
+	{
+		next = node->next;
+		parse_regexp_free (regexp);
+		g_slist_free_1 (node);
+		node = next;
+	}
+
+	if (prev)
+		prev->next = node;
+	else
+		parse.regexp_list = node;
+
+	return prev;
+}
+
+
+/* =========================================================================
+ = PARSE_LIST_RELOAD_DB
+ =
+ = Recompile a single modified database file, splicing its regexps back
+ = into the parse list where the old ones were
+ ======================================================================== */
+
+static void parse_list_reload_db (db_t *parse_db)
+{
+	GSList *prev, *list, *last;
+
+	prev = parse_list_remove_db (parse_db);
+
+	/* append to an empty list, which ends up in reverse order */
+	list = parse.regexp_list;
 	parse.regexp_list = NULL;
+
+	if (parse_db_append (parse_db) && parse.regexp_list)
+	{
+		parse.regexp_list = g_slist_reverse (parse.regexp_list);
+		last = g_slist_last (parse.regexp_list);
+
+		if (prev)
+		{
+			last->next = prev->next;
+			prev->next = parse.regexp_list;
+		}
+		else
+		{
+			last->next = list;
+			list = parse.regexp_list;
+		}
+	}
+
+	parse.regexp_list = list;
 }
 
 
@@ -456,26 +1203,53 @@ static gboolean parse_db_append (db_t *parse_db)
 {
 	parse_regexp_t *regexp = NULL;
 	GString *pattern;
-	pcre *compiled;
-	pcre_extra *studied;
-	const gchar *error;
+	GSList *node, *head, *cached = NULL;
+	pcre2_code *compiled;
+	PCRE2_SIZE offset;
 	FILE *fp;
-	gchar buf[STD_STRBUF];
-	gchar *pos, *token;
-	gint offset;
+	gchar buf[STD_STRBUF], error[STD_STRBUF];
+	gchar *pos, *token, *key, *digest;
+	gulong bad_actions = parse.stats.bad_actions;
+	gint errcode;
+	gboolean errors = FALSE, exclusive = FALSE;
 
 	g_assert (parse_db != NULL);
 	g_assert (parse_db->filename != NULL);
 
+	key = parse_cache_key (parse_db->filename, parse.tags_key, &digest);
+
+	if (key && parse_cache_load (parse_db->filename, key, &cached))
+	{
+		/* same order as if they had been queued and moved below */
+		for (node = cached; node; node = node->next)
+		{
+			regexp = node->data;
+			regexp->source = parse_db;
+			parse.regexp_list = g_slist_prepend (parse.regexp_list, regexp);
+		}
+
+		g_get_current_time (&parse_db->access);
+		parse.stats.cache_hits++;
+		parse_db_bind_builtin (parse_db, cached, digest);
+		g_slist_free (cached);
+		g_free (digest);
+		g_free (key);
+		return TRUE;
+	}
+
 	if ((fp = fopen (parse_db->filename, "r")) == NULL)
 	{
 		printt ("Unable to open %s!", parse_db->filename);
 		parse.db_list = g_slist_remove (parse.db_list, parse_db);
 		db_deallocate (parse_db, NULL);
+		g_free (digest);
+		g_free (key);
 		return FALSE;
 	}
 
 	g_get_current_time (&parse_db->access);
+	parse.stats.cache_misses++;
+	head = parse.regexp_list;
 
 	while (fgets (buf, sizeof (buf), fp) != NULL)
 	{
@@ -490,50 +1264,203 @@ static gboolean parse_db_append (db_t *parse_db)
 			continue;
 		}
 
-		if (isspace (buf[0]))
-		{
-			/* assign action to queue'd regexps */
-			g_slist_foreach (regexp_list, parse_list_add_action, buf);
-			continue;
-		}
+		if (buf[0] == '%')
+		{
+			/* directive setting the default for regexps which follow */
+			g_slist_foreach (regexp_list, parse_list_move_regexp, NULL);
+			g_slist_free (regexp_list);
+			regexp_list = NULL;
+
+			if (!strcasecmp (buf + 1, "Exclusive"))
+				exclusive = TRUE;
+			else if (!strcasecmp (buf + 1, "Inclusive"))
+				exclusive = FALSE;
+			else
+			{
+				printt ("Unknown parse directive '%s' in %s", buf,
+					parse_db->filename);
+				errors = TRUE;
+			}
+			continue;
+		}
+
+		if (isspace (buf[0]))
+		{
+			/* assign action to queue'd regexps */
+			g_slist_foreach (regexp_list, parse_list_add_action, buf);
+			continue;
+		}
+
+		pos = buf;
+		token = get_token_as_str (&pos);
+
+		pattern = g_string_new (token);
+		pattern = regexp_tag_substitution (pattern);
+
+		if ((compiled = pcre2_compile ((PCRE2_SPTR) pattern->str,
+			PCRE2_ZERO_TERMINATED, 0, &errcode, &offset, NULL)) == NULL)
+		{
+			pcre2_get_error_message (errcode, (PCRE2_UCHAR *) error, sizeof (error));
+			printt ("Error compiling regexp '%s': %s (at offset %ld)",
+				pattern->str, error, (glong) offset);
+			errors = TRUE; /* keep reporting it, don't cache */
+			continue;
+		}
+
+		regexp = g_malloc0 (sizeof (parse_regexp_t));
+		regexp->pattern  = token;
+		regexp->compiled = compiled;
+		regexp->jit      = !pcre2_jit_compile (compiled, PCRE2_JIT_COMPLETE);
+		regexp->literal  = prefilter_literal_extract (pattern->str);
+		regexp->expanded = g_string_free (pattern, FALSE);
+		regexp->source   = parse_db;
+		regexp->exclusive = exclusive;
+
+		/* add regexp to queue until we read the actions */
+		regexp_list = g_slist_prepend (regexp_list, regexp);
+	}
+
+	/* take care of any leftovers */
+	if (regexp_list != NULL)
+	{
+		/* move queue'd regexps to master list */
+		g_slist_foreach (regexp_list, parse_list_move_regexp, NULL);
+		g_slist_free (regexp_list);
+		regexp_list = NULL;
+	}
+
+	fclose (fp);
+
+	if (parse.stats.bad_actions != bad_actions)
+		errors = TRUE; /* keep reporting them, don't cache */
+
+	/* regexps from this file were prepended ahead of head */
+	for (node = parse.regexp_list; node != head; node = node->next)
+		cached = g_slist_prepend (cached, node->data);
+
+	if (key && !errors)
+		parse_cache_save (parse_db->filename, key, cached);
+
+	parse_db_bind_builtin (parse_db, cached, digest);
+	g_slist_free (cached);
+
+	g_free (digest);
+	g_free (key);
+	return TRUE;
+}
+
+
+/* =========================================================================
+ = PARSE_DB_BIND_BUILTIN
+ =
+ = Use generated matchers for the simple patterns of a stock parse
+ = database, provided it hasn't been changed since they were generated.
+ = Regexps are in file order, digest is the SHA-256 of the file contents
+ = they were loaded from (NULL if unknown)
+ ======================================================================== */
+
+static void parse_db_bind_builtin (db_t *parse_db, GSList *regexps,
+	const gchar *digest)
+{
+	const parse_builtin_db_t *builtin;
+	const parse_builtin_regexp_t *entry;
+	parse_regexp_t *regexp;
+	GSList *node;
+	gchar *base;
+
+	if (digest == NULL)
+		return;
+
+	base = g_path_get_basename (parse_db->filename);
+
+	for (builtin = parse_builtin_dbs; builtin->name; builtin++)
+	{
+		if (!strcmp (builtin->name, base))
+			break;
+	}
+	g_free (base);
+
+	if (!builtin->name)
+		return; /* not a stock database */
+
+	if (strcmp (digest, builtin->digest))
+		return; /* modified, leave it all to PCRE */
+
+	for (node = regexps, entry = builtin->regexps; node && entry->pattern;
+		node = node->next, entry++)
+	{
+		regexp = node->data;
+
+		if (strcmp (regexp->pattern, entry->pattern))
+			break; /* out of step, a pattern must have failed to compile */
+
+		regexp->builtin = entry->match;
+		regexp->builtin_captures = entry->captures;
+
+		if (entry->match)
+			parse.stats.builtin++;
+	}
+}
+
+
+/* =========================================================================
+ = PARSE_INDEX_BUILD
+ =
+ = Build index used to select candidate regexps for each line, according
+ = to the configured matching mode
+ ======================================================================== */
+
+static void parse_index_build (void)
+{
+	GSList *node;
+	parse_regexp_t *regexp;
+
+	prefilter_free (parse.prefilter);
+	parse.prefilter = NULL;
 
-		pos = buf;
-		token = get_token_as_str (&pos);
+	dfa_free (parse.dfa);
+	parse.dfa = NULL;
 
-		pattern = g_string_new (token);
-		pattern = regexp_tag_substitution (pattern);
+	parse.mode = character.parse_mode;
+
+	if (parse.mode == PARSE_MODE_LITERAL)
+		parse.prefilter = prefilter_new ();
+	else if (parse.mode == PARSE_MODE_AUTOMATON)
+		parse.dfa = dfa_new ();
+
+	for (node = parse.regexp_list; node; node = node->next)
+	{
+		regexp = node->data;
+		regexp->indexed = FALSE;
+		regexp->line_id = 0;
 
-		if ((compiled = pcre_compile (pattern->str, 0,
-			&error, &offset, NULL)) == NULL)
+		if (parse.prefilter && regexp->literal)
 		{
-			printt ("Error compiling regexp '%s': %s (at offset %d)",
-				pattern->str, error, offset);
-			continue;
+			prefilter_add (parse.prefilter, regexp->literal, regexp);
+			regexp->indexed = TRUE;
 		}
-		g_string_free (pattern, TRUE);
+		else if (parse.dfa)
+			regexp->indexed = dfa_add (parse.dfa, regexp->expanded, regexp);
+	}
 
-		studied = pcre_study (compiled, 0, &error);
+	if (parse.prefilter)
+		prefilter_compile (parse.prefilter);
+	else if (parse.dfa)
+		dfa_compile (parse.dfa);
+}
 
-		regexp = g_malloc0 (sizeof (parse_regexp_t));
-		regexp->pattern  = token;
-		regexp->compiled = compiled;
-		regexp->studied  = studied;
 
-		/* add regexp to queue until we read the actions */
-		regexp_list = g_slist_prepend (regexp_list, regexp);
-	}
+/* =========================================================================
+ = PARSE_INDEX_MARK
+ =
+ = Mark regexp as a candidate for the current line
+ ======================================================================== */
 
-	/* take care of any leftovers */
-	if (regexp_list != NULL)
-	{
-		/* move queue'd regexps to master list */
-		g_slist_foreach (regexp_list, parse_list_move_regexp, NULL);
-		g_slist_free (regexp_list);
-		regexp_list = NULL;
-	}
+static void parse_index_mark (gpointer data, gpointer user_data)
+{
+	parse_regexp_t *regexp = data;
 
-	fclose (fp);
-	return TRUE;
+	regexp->line_id = parse.line_id;
 }
 
 
@@ -546,27 +1473,138 @@ static gboolean parse_db_append (db_t *parse_db)
 void parse_db_update (void)
 {
 	struct stat st;
-	GSList *node;
+	GSList *node, *next;
 	db_t *parse_db;
+	gboolean changed = FALSE;
 
-	for (node = parse.db_list; node; node = node->next)
+	/* tags file created, modified or removed */
+	if (stat (parse.tags_db.filename, &st) ?
+		parse.tags_db.access.tv_sec != 0 :
+		st.st_mtime > parse.tags_db.access.tv_sec)
+	{
+		printt ("Parse tags updated");
+		parse_list_compile (); /* affects every file */
+		return;
+	}
+
+	for (node = parse.db_list; node; node = next)
 	{
+		next = node->next;
 		parse_db = node->data;
 
 		if (stat (parse_db->filename, &st))
 		{
+			parse_list_remove_db (parse_db);
 			parse.db_list = g_slist_remove (parse.db_list, parse_db);
 			db_deallocate (parse_db, NULL);
-			parse_list_compile ();
-			return;
+			changed = TRUE;
 		}
 		else if (st.st_mtime > parse_db->access.tv_sec)
 		{
 			printt ("Parse database updated");
-			parse_list_compile ();
-			return;
+			parse_list_reload_db (parse_db);
+			changed = TRUE;
 		}
 	}
+
+	if (changed)
+	{
+		parse_index_build ();
+		return;
+	}
+
+	if (parse.mode != character.parse_mode)
+		parse_index_build (); /* ParseMode option changed */
+}
+
+
+/* =========================================================================
+ = PARSE_MATCH_GET
+ =
+ = Returns matching state for the calling thread, (re)creating the JIT
+ = stack if its configured size has changed
+ ======================================================================== */
+
+static parse_match_t *parse_match_get (void)
+{
+	parse_match_t *match;
+
+	if ((match = g_private_get (&parse_match)) == NULL)
+	{
+		match = g_malloc0 (sizeof (parse_match_t));
+		match->data = pcre2_match_data_create (PARSE_SUBSTR_NUM, NULL);
+		match->context = pcre2_match_context_create (NULL);
+		g_private_set (&parse_match, match);
+	}
+
+	if (match->jit_stack_size != character.parse_jit_stack)
+	{
+		if (match->jit_stack)
+			pcre2_jit_stack_free (match->jit_stack);
+
+		match->jit_stack_size = character.parse_jit_stack;
+		match->jit_stack = pcre2_jit_stack_create (PARSE_JIT_STACK_MIN * 1024,
+			MAX (match->jit_stack_size, PARSE_JIT_STACK_MIN) * 1024, NULL);
+
+		/* a NULL stack falls back to the default 32K machine stack */
+		pcre2_jit_stack_assign (match->context, NULL, match->jit_stack);
+	}
+
+	return match;
+}
+
+
+/* =========================================================================
+ = PARSE_MATCH_FREE
+ =
+ = Free matching state when its thread exits
+ ======================================================================== */
+
+static void parse_match_free (gpointer data)
+{
+	parse_match_t *match = data;
+
+	if (match->jit_stack)
+		pcre2_jit_stack_free (match->jit_stack);
+
+	pcre2_match_context_free (match->context);
+	pcre2_match_data_free (match->data);
+	g_free (match->captures.text);
+	g_free (match);
+}
+
+
+/* =========================================================================
+ = PARSE_CAPTURES_RESET
+ =
+ = Point captures at a new match, discarding conversions of the last one
+ ======================================================================== */
+
+static void parse_captures_reset (parse_captures_t *captures, const gchar *subject,
+	gsize length, pcre2_match_data *data, gint rc)
+{
+	gsize size;
+
+	captures->subject = subject;
+	captures->ovector = pcre2_get_ovector_pointer (data);
+
+	/* zero means the ovector was too small, all of its pairs are set */
+	captures->count = rc ? rc : PARSE_SUBSTR_NUM;
+
+	captures->have_str       = 0;
+	captures->have_number    = 0;
+	captures->have_direction = 0;
+
+	/* room to copy every capture, so earlier copies never move */
+	captures->text_len = 0;
+	size = (length + 1) * PARSE_SUBSTR_NUM;
+
+	if (captures->text_size < size)
+	{
+		g_free (captures->text);
+		captures->text = g_malloc (size);
+		captures->text_size = size;
+	}
 }
 
 
@@ -576,29 +1614,69 @@ void parse_db_update (void)
  = Do regexp matching
  ======================================================================== */
 
-static gboolean parse_regexp (parse_regexp_t *parse_regexp, gchar *subject)
+static gboolean parse_regexp (parse_regexp_t *parse_regexp, parse_match_t *match,
+	gchar *subject, gsize length)
 {
 	parse_action_t *action;
+	PCRE2_SIZE *ovector;
 	GSList *node;
-	gint ovector[PARSE_SUBSTR_NUM*3];
+	gint64 start = 0, elapsed;
+	gboolean profile = character.parse_profile;
 	gint rc;
 
 	g_assert (parse_regexp != NULL);
+	g_assert (match != NULL);
 	g_assert (subject != NULL);
 
+	if (profile)
+		start = parse_profile_clock ();
+
 	/* attempt match */
-	rc = pcre_exec (parse_regexp->compiled, parse_regexp->studied,
-		subject, strlen (subject), 0, 0, ovector, PARSE_SUBSTR_NUM*3);
+	if (parse_regexp->builtin)
+	{
+		ovector = pcre2_get_ovector_pointer (match->data);
+		rc = parse_regexp->builtin (subject, length, ovector) ?
+			parse_regexp->builtin_captures + 1 : PCRE2_ERROR_NOMATCH;
+	}
+	else
+		rc = pcre2_match (parse_regexp->compiled, (PCRE2_SPTR) subject, length,
+			0, 0, match->data, match->context);
+
+	if (profile)
+	{
+		elapsed = parse_profile_clock () - start;
+		parse_regexp->profile.attempts++;
+		parse_regexp->profile.time += elapsed;
+		parse_regexp->profile.time_max = MAX (parse_regexp->profile.time_max,
+			elapsed);
+	}
 
 	/* match unsucessful */
 	if (rc < 0)
+	{
+		if (rc == PCRE2_ERROR_JIT_STACKLIMIT)
+			parse.stats.jit_errors++;
 		return FALSE;
+	}
+
+	parse.stats.hits++;
+	parse_regexp->weight++;
+
+	if (profile)
+		parse_regexp->profile.hits++;
+
+	parse_captures_reset (&match->captures, subject, length, match->data, rc);
 
 	/* execute defined actions */
 	for (node = parse_regexp->actions; node; node = node->next)
 	{
 		action = node->data;
-		if (!parse_action_dispatch (action, subject, parse_regexp, ovector, rc))
+		parse.stats.actions++;
+
+		if (profile)
+			parse_regexp->profile.actions++;
+
+		if (!parse_action_dispatch (action, subject, parse_regexp, &match->captures))
 			break;
 	}
 
@@ -617,9 +1695,43 @@ static gboolean parse_regexp (parse_regexp_t *parse_regexp, gchar *subject)
 static void parse_regexp_list (gchar *subject)
 {
 	GSList *node;
+	parse_regexp_t *regexp;
+	parse_match_t *match = parse_match_get ();
+	gsize length = strlen (subject);
+
+	if (++parse.line_id == 0)
+		parse.line_id++; /* zero is never a valid line */
+
+	parse.stats.lines++;
+
+	/* mark regexps which can possibly match subject */
+	if (parse.prefilter)
+		prefilter_scan (parse.prefilter, subject, length,
+			parse_index_mark, NULL);
+	else if (parse.dfa)
+		dfa_exec (parse.dfa, subject, length, parse_index_mark, NULL);
 
 	for (node = parse.regexp_list; node; node = node->next)
-		parse_regexp (node->data, subject);
+	{
+		regexp = node->data;
+
+		if (regexp->indexed && regexp->line_id != parse.line_id)
+		{
+			parse.stats.skipped++;
+			continue; /* cannot possibly match */
+		}
+
+		parse.stats.candidates++;
+
+		if (parse_regexp (regexp, match, subject, length) && regexp->exclusive)
+		{
+			parse.stats.stopped++;
+			break; /* nothing else needs to see this line */
+		}
+	}
+
+	if (character.parse_adaptive && !(parse.stats.lines % PARSE_ADAPT_LINES))
+		parse_list_adapt ();
 }
 
 
@@ -631,7 +1743,7 @@ static void parse_regexp_list (gchar *subject)
 
 void parse_line_buffer (guchar ch)
 {
-	gchar *p;
+	gsize len;
 
 	g_assert (parse.line_buf != NULL);
 
@@ -639,47 +1751,196 @@ void parse_line_buffer (guchar ch)
 	{
 		parse.line_buf = g_string_truncate (parse.line_buf,
 			MAX (0, parse.line_buf->len - 1));
+		character_triggers_truncate (parse.line_buf->len);
 		return;
 	}
 	if (ch == '\n')
 	{
 		parse_line (parse.line_buf->str);
 		parse.line_buf = g_string_assign (parse.line_buf, "");
+		parse.line_tags = 0;
+		character_triggers_reset ();
 		return;
 	}
 
 	parse.line_buf = g_string_append_c (parse.line_buf, ch);
+	len = parse.line_buf->len;
+	character_triggers_advance (ch, len);
 
-	/* remove resting/meditating tags from prompt */
-	if ((p = strstr (parse.line_buf->str, STR_RESTING)) != NULL)
-		parse.line_buf = g_string_erase (parse.line_buf,
-			p - parse.line_buf->str, strlen (STR_RESTING));
+	/* remove resting/meditating tags from prompt. each is removed as soon
+	 * as it is complete, so it can only ever end with the byte just added */
+	if (ch == ' ')
+	{
+		if (parse_line_buffer_strip (STR_RESTING, sizeof (STR_RESTING) - 1))
+			parse.line_tags |= PARSE_LINE_RESTING;
 
-	if ((p = strstr (parse.line_buf->str, STR_MEDITATING)) != NULL)
-		parse.line_buf = g_string_erase (parse.line_buf,
-			p - parse.line_buf->str, strlen (STR_MEDITATING));
+		else if (parse_line_buffer_strip (STR_MEDITATING,
+			sizeof (STR_MEDITATING) - 1))
+			parse.line_tags |= PARSE_LINE_MEDITATING;
+	}
 
-	/* parse HP/MA ticks ASAP */
-	if (!strncmp (parse.line_buf->str, "[HP=", 4))
+	/* parse HP/MA ticks ASAP, as soon as the prompt is closed by "]:" */
+	else if (ch == ':' && len >= 6 && parse.line_buf->str[len - 2] == ']'
+		&& !strncmp (parse.line_buf->str, "[HP=", 4))
 	{
-		if (strstr (parse.line_buf->str, "]:"))
-		{
+		/* a tagged prompt settles whether we're resting/meditating, even
+		 * if the message announcing it was missed */
+		if (parse.line_tags & PARSE_LINE_RESTING)
+			character.state = STATE_RESTING;
+
+		else if (parse.line_tags & PARSE_LINE_MEDITATING)
+			character.state = STATE_MEDITATING;
+
+		if (!parse_prompt (parse.line_buf->str, len))
 			parse_regexp_list (parse.line_buf->str);
-			parse.line_buf = g_string_assign (parse.line_buf, "");
-		}
+
+		parse.line_buf = g_string_assign (parse.line_buf, "");
+		parse.line_tags = 0;
+		character_triggers_reset ();
 	}
 
 	if (character.option.auto_all) /* handle login/password, triggers */
+		character_triggers_parse (parse.line_buf->len);
+}
+
+
+/* =========================================================================
+ = PARSE_LINE_BUFFER_RUN
+ =
+ = Append the start of a run of printable text, up to the first byte that
+ = needs parse_line_buffer(): one that could complete a resting/meditating
+ = tag or the prompt, or any byte while a trigger could still match.
+ = Returns the number of bytes taken
+ ======================================================================== */
+
+gsize parse_line_buffer_run (const gchar *run, gsize length)
+{
+	const gchar *p, *end = run + length;
+	gchar prev;
+
+	g_assert (parse.line_buf != NULL);
+
+	if (character_triggers_matching (parse.line_buf->len))
+		return 0;
+
+	prev = parse.line_buf->len ?
+		parse.line_buf->str[parse.line_buf->len - 1] : '\0';
+
+	/* tags end in ") ", the prompt in "]:" */
+	for (p = run; p < end; prev = *p++)
+	{
+		if ((*p == ' ' && prev == ')') || (*p == ':' && prev == ']'))
+			break;
+	}
+
+	parse.line_buf = g_string_append_len (parse.line_buf, run, p - run);
+
+	return p - run;
+}
+
+
+/* =========================================================================
+ = PARSE_LINE_BUFFER_STRIP
+ =
+ = Remove tag from the end of the line buffer. Returns TRUE if present
+ ======================================================================== */
+
+static gboolean parse_line_buffer_strip (const gchar *tag, gsize length)
+{
+	GString *buf = parse.line_buf;
+
+	if (buf->len < length || memcmp (buf->str + buf->len - length, tag, length))
+		return FALSE;
+
+	g_string_truncate (buf, buf->len - length);
+	character_triggers_truncate (buf->len);
+	return TRUE;
+}
+
+
+/* =========================================================================
+ = PARSE_PROMPT
+ =
+ = Decode the "[HP=n]:", "[HP=n/MA=n]:" and "[HP=n/KAI=n]:" prompts
+ = without going through the regexp list. Returns FALSE, having changed
+ = nothing, for anything else
+ ======================================================================== */
+
+static gboolean parse_prompt (const gchar *str, gsize length)
+{
+	const gchar *pos = str + 4, *end = str + length - 2; /* within [HP= ]: */
+	gint hp, ma = 0;
+	gboolean has_ma = FALSE;
+
+	if (!parse_prompt_number (&pos, end, &hp))
+		goto other;
+
+	if (pos < end && *pos == '/')
 	{
-		if (!character.flag.ready && character.username
-			&& !strcmp (parse.line_buf->str, "Otherwise type \"new\": "))
-			send_line (character.username);
-		else if (!character.flag.ready && character.password
-			&& !strcmp (parse.line_buf->str, "Enter your password: "))
-			send_line (character.password);
+		pos++;
+
+		if (end - pos > 3 && !strncmp (pos, "MA=", 3))
+			pos += 3;
+		else if (end - pos > 4 && !strncmp (pos, "KAI=", 4))
+			pos += 4;
 		else
-			character_triggers_parse (parse.line_buf->str);
+			goto other;
+
+		if (!parse_prompt_number (&pos, end, &ma))
+			goto other;
+
+		has_ma = TRUE;
+	}
+
+	if (pos != end)
+		goto other;
+
+	parse.stats.prompts++;
+
+	character_hp_update (hp);
+	if (has_ma)
+		character_ma_update (ma);
+
+	return TRUE;
+
+other:
+	parse.stats.prompts_other++;
+	return FALSE;
+}
+
+
+/* =========================================================================
+ = PARSE_PROMPT_NUMBER
+ =
+ = Read an optionally negative number from a prompt, advancing pos
+ ======================================================================== */
+
+static gboolean parse_prompt_number (const gchar **pos, const gchar *end,
+	gint *value)
+{
+	const gchar *p = *pos;
+	gboolean negative = FALSE;
+	gint n = 0;
+
+	if (p < end && *p == '-')
+	{
+		negative = TRUE;
+		p++;
 	}
+
+	if (p == end || !isdigit (*p))
+		return FALSE;
+
+	while (p < end && isdigit (*p) && n < 100000000)
+		n = n * 10 + (*p++ - '0');
+
+	if (p < end && isdigit (*p))
+		return FALSE; /* absurdly long, leave it to the regexps */
+
+	*value = negative ? -n : n;
+	*pos = p;
+
+	return TRUE;
 }
 
 
@@ -833,3 +2094,131 @@ void parse_line (gchar *line)
 
 	return;
 }
+
+
+/* =========================================================================
+ = PARSE_CAPTURE_SPAN
+ =
+ = Returns capture n of the current match in place (empty if not set)
+ ======================================================================== */
+
+parse_span_t parse_capture_span (parse_captures_t *captures, gint n)
+{
+	parse_span_t span = { "", 0 };
+	PCRE2_SIZE *ov;
+
+	g_assert (captures != NULL);
+
+	if (n < 0 || n >= captures->count)
+		return span;
+
+	ov = captures->ovector + 2*n;
+
+	if (ov[0] == PCRE2_UNSET)
+		return span;
+
+	span.str = captures->subject + ov[0];
+	span.len = ov[1] - ov[0];
+
+	return span;
+}
+
+
+/* =========================================================================
+ = PARSE_CAPTURE_STR
+ =
+ = Returns capture n of the current match as a string, valid until the
+ = next match
+ ======================================================================== */
+
+gchar *parse_capture_str (parse_captures_t *captures, gint n)
+{
+	parse_span_t span;
+	gchar *str;
+
+	g_assert (captures != NULL);
+
+	if (n < 0 || n >= PARSE_SUBSTR_NUM)
+		return "";
+
+	if (captures->have_str & (1 << n))
+		return captures->str[n];
+
+	span = parse_capture_span (captures, n);
+
+	str = captures->text + captures->text_len;
+	memcpy (str, span.str, span.len);
+	str[span.len] = '\0';
+	captures->text_len += span.len + 1;
+
+	captures->str[n] = str;
+	captures->have_str |= (1 << n);
+
+	return str;
+}
+
+
+/* =========================================================================
+ = PARSE_CAPTURE_INT
+ =
+ = Returns capture n of the current match as an integer (as atoi would)
+ ======================================================================== */
+
+gint parse_capture_int (parse_captures_t *captures, gint n)
+{
+	parse_span_t span;
+	const gchar *pos, *end;
+	gboolean negative = FALSE;
+	gint value = 0;
+
+	g_assert (captures != NULL);
+
+	if (n < 0 || n >= PARSE_SUBSTR_NUM)
+		return 0;
+
+	if (captures->have_number & (1 << n))
+		return captures->number[n];
+
+	/* converted straight from the subject, no copy needed */
+	span = parse_capture_span (captures, n);
+	pos = span.str;
+	end = span.str + span.len;
+
+	while (pos < end && isspace (*pos))
+		pos++;
+
+	if (pos < end && (*pos == '-' || *pos == '+'))
+		negative = (*pos++ == '-');
+
+	while (pos < end && isdigit (*pos))
+		value = value * 10 + (*pos++ - '0');
+
+	captures->number[n] = negative ? -value : value;
+	captures->have_number |= (1 << n);
+
+	return captures->number[n];
+}
+
+
+/* =========================================================================
+ = PARSE_CAPTURE_DIRECTION
+ =
+ = Returns capture n of the current match as an exit direction
+ ======================================================================== */
+
+gint parse_capture_direction (parse_captures_t *captures, gint n)
+{
+	g_assert (captures != NULL);
+
+	if (n < 0 || n >= PARSE_SUBSTR_NUM)
+		return EXIT_NONE;
+
+	if (captures->have_direction & (1 << n))
+		return captures->direction[n];
+
+	captures->direction[n] = automap_get_exit_as_int (
+		parse_capture_str (captures, n));
+	captures->have_direction |= (1 << n);
+
+	return captures->direction[n];
+}
@@ -19,53 +19,178 @@
 #ifndef __PARSE_H__
 #define __PARSE_H__
 
+#include <stdio.h>
 #include <glib.h>
-#include <pcre.h>
+
+#define PCRE2_CODE_UNIT_WIDTH 8
+#include <pcre2.h>
+
+#include "defs.h"
+#include "dfa.h"
+#include "prefilter.h"
 
 #define PARSE_SUBSTR_NUM	10
+#define PARSE_JIT_STACK_MIN	32   /* JIT stack sizes (kilobytes) */
+#define PARSE_JIT_STACK_MAX	16384
+#define PARSE_TAGS_FILE		"tags.conf" /* word list tags, in the parse dir */
+#define PARSE_ADAPT_LINES	2048 /* lines between adaptive reorderings */
 #define ASSIGNED_DIRECTION	100 /* offset for assigned direction */
 
+#define PARSE_LINE_RESTING	(1 << 0) /* tags stripped from the line buffer */
+#define PARSE_LINE_MEDITATING	(1 << 1)
+
+enum /* regexp list matching modes */
+{
+	PARSE_MODE_LINEAR,    /* attempt every regexp on every line */
+	PARSE_MODE_LITERAL,   /* only attempt regexps whose literal is present */
+	PARSE_MODE_AUTOMATON, /* combined DFA selects matching regexps */
+};
+
 typedef struct
 {
 	GSList *regexp_list; /* list of regexp_parse_t patterns/actions */
 	GSList *db_list;     /* list of parse database files */
+	GSList *word_tags;   /* list of word list parse_tag_t tags */
+	db_t tags_db;        /* tags file extending the word lists */
+	gchar *tags_key;     /* digest of all tag substitutions */
 	GString *line_buf;   /* line buffered data from the server */
+	guint line_tags;     /* PARSE_LINE_* tags stripped from line_buf */
 	GString *wrap_buf;   /* buffer to handle wrapped lines */
 	GString *room_name;  /* room name buffer */
 	gboolean line_wrap;  /* line wrapping flag */
+	prefilter_t *prefilter; /* literal index over regexp_list */
+	dfa_t *dfa;          /* combined automaton over regexp_list */
+	gint mode;           /* matching mode the index was built for */
+	guint line_id;       /* current line, for marking candidate regexps */
+
+	struct /* regexp list statistics */
+	{
+		gulong lines;      /* lines run through the regexp list */
+		gulong candidates; /* regexps attempted */
+		gulong skipped;    /* regexps ruled out by the index */
+		gulong hits;       /* regexps matched */
+		gulong jit_errors; /* JIT matches which failed (stack exhausted) */
+		gulong cache_hits; /* databases loaded from the compiled cache */
+		gulong cache_misses; /* databases compiled from source */
+		gulong bad_actions; /* actions rejected while loading */
+		gulong builtin;    /* regexps replaced by generated matchers */
+		gulong actions;    /* actions dispatched */
+		gulong stopped;    /* lines where an exclusive match ended matching */
+		gulong reorders;   /* adaptive reorderings of the regexp list */
+		gulong prompts;    /* prompts decoded without the regexp list */
+		gulong prompts_other; /* prompts left to the regexp list */
+	} stats;
 } parse_t;
 
+typedef struct
+{
+	const gchar *str; /* start of capture, within the matched line */
+	gsize len;        /* capture length (not NUL terminated) */
+} parse_span_t;
+
+typedef struct /* captures of the current match, converted on demand */
+{
+	const gchar *subject;  /* line that was matched */
+	PCRE2_SIZE *ovector;   /* capture offsets into subject */
+	gint count;            /* captures set by the match */
+	gchar *text;           /* NUL terminated copies of captures */
+	gsize text_len;        /* bytes of text in use */
+	gsize text_size;       /* bytes allocated to text */
+	guint have_str;        /* bitmasks of the conversions already made */
+	guint have_number;
+	guint have_direction;
+	gchar *str[PARSE_SUBSTR_NUM];    /* capture as a string */
+	gint number[PARSE_SUBSTR_NUM];   /* capture as an integer */
+	gint direction[PARSE_SUBSTR_NUM]; /* capture as an exit direction */
+} parse_captures_t;
+
+typedef struct /* per-thread regexp matching state */
+{
+	pcre2_match_data *data;       /* ovector for the current match */
+	pcre2_match_context *context; /* carries the JIT stack */
+	pcre2_jit_stack *jit_stack;
+	gint jit_stack_size;          /* size of jit_stack (kilobytes) */
+	parse_captures_t captures;    /* captures of the current match */
+} parse_match_t;
+
+typedef struct
+{
+	gchar ch;         /* edge label */
+	GSList *suffixes; /* regexp remainders of words ending here */
+	GSList *children; /* child nodes, sorted by label */
+} parse_trie_t;
+
 typedef struct
 {
 	gchar *tag;    /* user-friendly parse tag */
 	gchar *regexp; /* substitution regexp */
+	parse_trie_t *trie; /* words the regexp is built from (word list tags) */
 } parse_tag_t;
 
+typedef struct
+{
+	gchar *tag;    /* word list parse tag */
+	gchar **words; /* alternatives (regexp fragments), NULL terminated */
+} parse_tag_words_t;
+
 typedef struct
 {
 	gchar *type; /* action type */
 	gchar *arg;  /* optional action argument */
 	gint value;  /* optional argument value */
+	gint op;     /* resolved action type */
+	gint code;   /* resolved action argument */
 } parse_action_t;
 
 #define PARSE_VALUE_DIRECTION 100 /* parse_action_t value offsets */
 
+/* generated matcher for a simple pattern (see parse_builtin.c), fills in
+ * ovector with the match and its captures as pcre2_match() would */
+typedef gboolean (*parse_builtin_func_t) (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector);
+
 typedef struct
 {
 	gchar *pattern;      /* original regexp pattern */
-	pcre *compiled;      /* compiled regexp */
-	pcre_extra *studied; /* studied regexp (optimized for speed) */
+	pcre2_code *compiled; /* compiled regexp */
+	gboolean jit;        /* compiled to machine code */
 	GSList *actions;     /* actions to execute when pattern matched */
+	gchar *expanded;     /* pattern after tag substitution */
+	gchar *literal;      /* literal required to match (NULL if unknown) */
+	gboolean indexed;    /* selected by the index rather than always tried */
+	guint line_id;       /* last line regexp was marked a candidate */
+	db_t *source;        /* database file regexp was loaded from */
+	gboolean exclusive;  /* stop matching the line once this has matched */
+	parse_builtin_func_t builtin; /* used instead of compiled, if set */
+	gint builtin_captures; /* capture groups set by builtin */
+	gulong weight;       /* recent matches, for adaptive ordering */
+
+	struct /* collected while ParseStats is enabled */
+	{
+		gulong attempts;   /* times matching was attempted */
+		gulong hits;       /* successful matches */
+		gulong actions;    /* actions dispatched */
+		gint64 time;       /* total matching time (nanoseconds) */
+		gint64 time_max;   /* longest single attempt (nanoseconds) */
+	} profile;
 } parse_regexp_t;
 
 extern parse_t parse;
 
 void parse_init (void);
 void parse_cleanup (void);
+void parse_report (FILE *fp);
+void parse_profile_dump (void);
 void parse_list_compile (void);
 void parse_list_free (void);
+void parse_regexp_free (parse_regexp_t *regexp);
 void parse_db_update (void);
 void parse_line_buffer (guchar ch);
+gsize parse_line_buffer_run (const gchar *run, gsize length);
 void parse_line (gchar *line);
+parse_span_t parse_capture_span (parse_captures_t *captures, gint n);
+gchar *parse_capture_str (parse_captures_t *captures, gint n);
+gint parse_capture_int (parse_captures_t *captures, gint n);
+gint parse_capture_direction (parse_captures_t *captures, gint n);
 
 #endif /* __PARSE_H__ */
@@ -0,0 +1,8928 @@
+/*  MudPRO: An advanced client for the online game MajorMUD
+ *  Copyright (C) 2002-2018  David Slusky
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+/* GENERATED by misc/generate-parse.pl from profile/default/parse, any
+ * changes made here will be lost */
+
+#include <string.h>
+
+#include "parse_builtin.h"
+
+/* \s and \w as PCRE sees them, without locale or Unicode support */
+#define PARSE_BUILTIN_SPACE(ch) ((ch) == ' ' || ((ch) >= '\t' && (ch) <= '\r'))
+#define PARSE_BUILTIN_WORD(ch) (g_ascii_isalnum (ch) || (ch) == '_')
+
+/* \[HP=([^/]+)\]: */
+
+static gboolean parse_builtin_match_0 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 7)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 4
+		|| memcmp (p, "[HP=", 4))
+		return FALSE;
+
+	p += 4;
+
+	if (end - p < 3)
+		return FALSE;
+
+	n = end - p - 2;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '/')
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 2
+		|| memcmp (p, "]:", 2))
+		return FALSE;
+
+	p += 2;
+
+	return p == end;
+}
+
+
+/* Health: +{1}/{2} +\[{3}%\] */
+
+static gboolean parse_builtin_match_1_1 (const gchar *subject, const gchar *p,
+	const gchar *end, PCRE2_SIZE *ovector)
+{
+	const gchar *q;
+	gsize n;
+
+	if (end - p < 1
+		|| p[0] != '/')
+		return FALSE;
+
+	p += 1;
+
+	for (n = 0; p + n < end && !PARSE_BUILTIN_SPACE (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[4] = p - subject;
+	ovector[5] = p + n - subject;
+	p += n;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	if (end - p < 1
+		|| p[0] != '[')
+		return FALSE;
+
+	p += 1;
+
+	if (end - p < 3)
+		return FALSE;
+
+	n = end - p - 2;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (PARSE_BUILTIN_SPACE (*q))
+			return FALSE;
+	}
+
+	ovector[6] = p - subject;
+	ovector[7] = p + n - subject;
+	p += n;
+
+	if (end - p < 2
+		|| memcmp (p, "%]", 2))
+		return FALSE;
+
+	p += 2;
+
+	return p == end;
+}
+
+static gboolean parse_builtin_match_1 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	gsize n;
+
+	if (length < 16)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 7
+		|| memcmp (p, "Health:", 7))
+		return FALSE;
+
+	p += 7;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	for (n = 0; p + n < end && !PARSE_BUILTIN_SPACE (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[2] = p - subject;
+
+	for (;; n--)
+	{
+		ovector[3] = p + n - subject;
+
+		if (parse_builtin_match_1_1 (subject, p + n, end, ovector))
+			return TRUE;
+
+		if (n == 1)
+			return FALSE;
+	}
+}
+
+
+/* Exp: {1} Level: {2} Exp needed for next level: {3} \({4}\) \[{5}%\] */
+
+static gboolean parse_builtin_match_2_1 (const gchar *subject, const gchar *p,
+	const gchar *end, PCRE2_SIZE *ovector)
+{
+	const gchar *q;
+	gsize n;
+
+	if (end - p < 3
+		|| memcmp (p, ") [", 3))
+		return FALSE;
+
+	p += 3;
+
+	if (end - p < 3)
+		return FALSE;
+
+	n = end - p - 2;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (PARSE_BUILTIN_SPACE (*q))
+			return FALSE;
+	}
+
+	ovector[10] = p - subject;
+	ovector[11] = p + n - subject;
+	p += n;
+
+	if (end - p < 2
+		|| memcmp (p, "%]", 2))
+		return FALSE;
+
+	p += 2;
+
+	return p == end;
+}
+
+static gboolean parse_builtin_match_2 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	gsize n;
+
+	if (length < 53)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 5
+		|| memcmp (p, "Exp: ", 5))
+		return FALSE;
+
+	p += 5;
+
+	for (n = 0; p + n < end && !PARSE_BUILTIN_SPACE (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 8
+		|| memcmp (p, " Level: ", 8))
+		return FALSE;
+
+	p += 8;
+
+	for (n = 0; p + n < end && !PARSE_BUILTIN_SPACE (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[4] = p - subject;
+	ovector[5] = p + n - subject;
+	p += n;
+
+	if (end - p < 28
+		|| memcmp (p, " Exp needed for next level: ", 28))
+		return FALSE;
+
+	p += 28;
+
+	for (n = 0; p + n < end && !PARSE_BUILTIN_SPACE (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[6] = p - subject;
+	ovector[7] = p + n - subject;
+	p += n;
+
+	if (end - p < 2
+		|| memcmp (p, " (", 2))
+		return FALSE;
+
+	p += 2;
+
+	for (n = 0; p + n < end && !PARSE_BUILTIN_SPACE (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[8] = p - subject;
+
+	for (;; n--)
+	{
+		ovector[9] = p + n - subject;
+
+		if (parse_builtin_match_2_1 (subject, p + n, end, ovector))
+			return TRUE;
+
+		if (n == 1)
+			return FALSE;
+	}
+}
+
+
+/* You gain {#} experience. */
+
+static gboolean parse_builtin_match_3 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 22)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 9
+		|| memcmp (p, "You gain ", 9))
+		return FALSE;
+
+	p += 9;
+
+	if (end - p < 13)
+		return FALSE;
+
+	n = end - p - 12;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (!g_ascii_isdigit (*q))
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 12
+		|| !(!memcmp (p, " experience", 11)
+			&& p[11] != '\n'))
+		return FALSE;
+
+	p += 12;
+
+	return p == end;
+}
+
+
+/* Name: {1} {2} +Lives/CP: +{3}/{4}{*} */
+
+static gboolean parse_builtin_match_4_1 (const gchar *subject, const gchar *p,
+	const gchar *end, PCRE2_SIZE *ovector)
+{
+	const gchar *q;
+	gsize n;
+
+	n = end - p;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[10] = p - subject;
+	ovector[11] = p + n - subject;
+	p += n;
+
+	return p == end;
+}
+
+static gboolean parse_builtin_match_4_2 (const gchar *subject, const gchar *p,
+	const gchar *end, PCRE2_SIZE *ovector)
+{
+	gsize n;
+
+	if (end - p < 1
+		|| p[0] != '/')
+		return FALSE;
+
+	p += 1;
+
+	for (n = 0; p + n < end && !PARSE_BUILTIN_SPACE (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[8] = p - subject;
+
+	for (;; n--)
+	{
+		ovector[9] = p + n - subject;
+
+		if (parse_builtin_match_4_1 (subject, p + n, end, ovector))
+			return TRUE;
+
+		if (n == 1)
+			return FALSE;
+	}
+}
+
+static gboolean parse_builtin_match_4 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	gsize n;
+
+	if (length < 23)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 6
+		|| memcmp (p, "Name: ", 6))
+		return FALSE;
+
+	p += 6;
+
+	for (n = 0; p + n < end && !PARSE_BUILTIN_SPACE (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 1
+		|| p[0] != ' ')
+		return FALSE;
+
+	p += 1;
+
+	for (n = 0; p + n < end && !PARSE_BUILTIN_SPACE (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[4] = p - subject;
+	ovector[5] = p + n - subject;
+	p += n;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	if (end - p < 9
+		|| memcmp (p, "Lives/CP:", 9))
+		return FALSE;
+
+	p += 9;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	for (n = 0; p + n < end && !PARSE_BUILTIN_SPACE (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[6] = p - subject;
+
+	for (;; n--)
+	{
+		ovector[7] = p + n - subject;
+
+		if (parse_builtin_match_4_2 (subject, p + n, end, ovector))
+			return TRUE;
+
+		if (n == 1)
+			return FALSE;
+	}
+}
+
+
+/* Race: {1} +Exp: {2} +Perception: +{3} */
+
+static gboolean parse_builtin_match_5 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 28)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 6
+		|| memcmp (p, "Race: ", 6))
+		return FALSE;
+
+	p += 6;
+
+	for (n = 0; p + n < end && !PARSE_BUILTIN_SPACE (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	if (end - p < 5
+		|| memcmp (p, "Exp: ", 5))
+		return FALSE;
+
+	p += 5;
+
+	for (n = 0; p + n < end && !PARSE_BUILTIN_SPACE (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[4] = p - subject;
+	ovector[5] = p + n - subject;
+	p += n;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	if (end - p < 11
+		|| memcmp (p, "Perception:", 11))
+		return FALSE;
+
+	p += 11;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	if (end - p < 1)
+		return FALSE;
+
+	n = end - p;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (PARSE_BUILTIN_SPACE (*q))
+			return FALSE;
+	}
+
+	ovector[6] = p - subject;
+	ovector[7] = p + n - subject;
+	p += n;
+
+	return p == end;
+}
+
+
+/* Class: {1} +Level: {2} +Stealth: +{3} */
+
+static gboolean parse_builtin_match_6 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 28)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 7
+		|| memcmp (p, "Class: ", 7))
+		return FALSE;
+
+	p += 7;
+
+	for (n = 0; p + n < end && !PARSE_BUILTIN_SPACE (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	if (end - p < 7
+		|| memcmp (p, "Level: ", 7))
+		return FALSE;
+
+	p += 7;
+
+	for (n = 0; p + n < end && !PARSE_BUILTIN_SPACE (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[4] = p - subject;
+	ovector[5] = p + n - subject;
+	p += n;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	if (end - p < 8
+		|| memcmp (p, "Stealth:", 8))
+		return FALSE;
+
+	p += 8;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	if (end - p < 1)
+		return FALSE;
+
+	n = end - p;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (PARSE_BUILTIN_SPACE (*q))
+			return FALSE;
+	}
+
+	ovector[6] = p - subject;
+	ovector[7] = p + n - subject;
+	p += n;
+
+	return p == end;
+}
+
+
+/* Hits: +{1}/{2} +Armour Class: +{3}/{4} +Thievery: +{5} */
+
+static gboolean parse_builtin_match_7_1 (const gchar *subject, const gchar *p,
+	const gchar *end, PCRE2_SIZE *ovector)
+{
+	const gchar *q;
+	gsize n;
+
+	if (end - p < 1
+		|| p[0] != '/')
+		return FALSE;
+
+	p += 1;
+
+	for (n = 0; p + n < end && !PARSE_BUILTIN_SPACE (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[8] = p - subject;
+	ovector[9] = p + n - subject;
+	p += n;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	if (end - p < 9
+		|| memcmp (p, "Thievery:", 9))
+		return FALSE;
+
+	p += 9;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	if (end - p < 1)
+		return FALSE;
+
+	n = end - p;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (PARSE_BUILTIN_SPACE (*q))
+			return FALSE;
+	}
+
+	ovector[10] = p - subject;
+	ovector[11] = p + n - subject;
+	p += n;
+
+	return p == end;
+}
+
+static gboolean parse_builtin_match_7_2 (const gchar *subject, const gchar *p,
+	const gchar *end, PCRE2_SIZE *ovector)
+{
+	gsize n;
+
+	if (end - p < 1
+		|| p[0] != '/')
+		return FALSE;
+
+	p += 1;
+
+	for (n = 0; p + n < end && !PARSE_BUILTIN_SPACE (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[4] = p - subject;
+	ovector[5] = p + n - subject;
+	p += n;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	if (end - p < 13
+		|| memcmp (p, "Armour Class:", 13))
+		return FALSE;
+
+	p += 13;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	for (n = 0; p + n < end && !PARSE_BUILTIN_SPACE (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[6] = p - subject;
+
+	for (;; n--)
+	{
+		ovector[7] = p + n - subject;
+
+		if (parse_builtin_match_7_1 (subject, p + n, end, ovector))
+			return TRUE;
+
+		if (n == 1)
+			return FALSE;
+	}
+}
+
+static gboolean parse_builtin_match_7 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	gsize n;
+
+	if (length < 39)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 5
+		|| memcmp (p, "Hits:", 5))
+		return FALSE;
+
+	p += 5;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	for (n = 0; p + n < end && !PARSE_BUILTIN_SPACE (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[2] = p - subject;
+
+	for (;; n--)
+	{
+		ovector[3] = p + n - subject;
+
+		if (parse_builtin_match_7_2 (subject, p + n, end, ovector))
+			return TRUE;
+
+		if (n == 1)
+			return FALSE;
+	}
+}
+
+
+/* Mana: +{1}/{2} +Spellcasting: {3} +Traps: +{4} */
+
+static gboolean parse_builtin_match_8_1 (const gchar *subject, const gchar *p,
+	const gchar *end, PCRE2_SIZE *ovector)
+{
+	const gchar *q;
+	gsize n;
+
+	if (end - p < 1
+		|| p[0] != '/')
+		return FALSE;
+
+	p += 1;
+
+	for (n = 0; p + n < end && !PARSE_BUILTIN_SPACE (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[4] = p - subject;
+	ovector[5] = p + n - subject;
+	p += n;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	if (end - p < 14
+		|| memcmp (p, "Spellcasting: ", 14))
+		return FALSE;
+
+	p += 14;
+
+	for (n = 0; p + n < end && !PARSE_BUILTIN_SPACE (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[6] = p - subject;
+	ovector[7] = p + n - subject;
+	p += n;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	if (end - p < 6
+		|| memcmp (p, "Traps:", 6))
+		return FALSE;
+
+	p += 6;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	if (end - p < 1)
+		return FALSE;
+
+	n = end - p;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (PARSE_BUILTIN_SPACE (*q))
+			return FALSE;
+	}
+
+	ovector[8] = p - subject;
+	ovector[9] = p + n - subject;
+	p += n;
+
+	return p == end;
+}
+
+static gboolean parse_builtin_match_8 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	gsize n;
+
+	if (length < 34)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 5
+		|| memcmp (p, "Mana:", 5))
+		return FALSE;
+
+	p += 5;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	for (n = 0; p + n < end && !PARSE_BUILTIN_SPACE (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[2] = p - subject;
+
+	for (;; n--)
+	{
+		ovector[3] = p + n - subject;
+
+		if (parse_builtin_match_8_1 (subject, p + n, end, ovector))
+			return TRUE;
+
+		if (n == 1)
+			return FALSE;
+	}
+}
+
+
+/* Kai: +{1}/{2} +Traps: +{3} */
+
+static gboolean parse_builtin_match_9_1 (const gchar *subject, const gchar *p,
+	const gchar *end, PCRE2_SIZE *ovector)
+{
+	const gchar *q;
+	gsize n;
+
+	if (end - p < 1
+		|| p[0] != '/')
+		return FALSE;
+
+	p += 1;
+
+	for (n = 0; p + n < end && !PARSE_BUILTIN_SPACE (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[4] = p - subject;
+	ovector[5] = p + n - subject;
+	p += n;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	if (end - p < 6
+		|| memcmp (p, "Traps:", 6))
+		return FALSE;
+
+	p += 6;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	if (end - p < 1)
+		return FALSE;
+
+	n = end - p;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (PARSE_BUILTIN_SPACE (*q))
+			return FALSE;
+	}
+
+	ovector[6] = p - subject;
+	ovector[7] = p + n - subject;
+	p += n;
+
+	return p == end;
+}
+
+static gboolean parse_builtin_match_9 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	gsize n;
+
+	if (length < 17)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 4
+		|| memcmp (p, "Kai:", 4))
+		return FALSE;
+
+	p += 4;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	for (n = 0; p + n < end && !PARSE_BUILTIN_SPACE (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[2] = p - subject;
+
+	for (;; n--)
+	{
+		ovector[3] = p + n - subject;
+
+		if (parse_builtin_match_9_1 (subject, p + n, end, ovector))
+			return TRUE;
+
+		if (n == 1)
+			return FALSE;
+	}
+}
+
+
+/*  +Traps: +{1} */
+
+static gboolean parse_builtin_match_10 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 9)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	if (end - p < 6
+		|| memcmp (p, "Traps:", 6))
+		return FALSE;
+
+	p += 6;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	if (end - p < 1)
+		return FALSE;
+
+	n = end - p;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (PARSE_BUILTIN_SPACE (*q))
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	return p == end;
+}
+
+
+/*  +Picklocks: +{1} */
+
+static gboolean parse_builtin_match_11 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 13)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	if (end - p < 10
+		|| memcmp (p, "Picklocks:", 10))
+		return FALSE;
+
+	p += 10;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	if (end - p < 1)
+		return FALSE;
+
+	n = end - p;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (PARSE_BUILTIN_SPACE (*q))
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	return p == end;
+}
+
+
+/* Strength: +\**{1} +Agility: +\**{2} +Tracking: +{3} */
+
+static gboolean parse_builtin_match_12_1 (const gchar *subject, const gchar *p,
+	const gchar *end, PCRE2_SIZE *ovector)
+{
+	const gchar *q;
+	gsize n;
+
+	for (n = 0; p + n < end && !PARSE_BUILTIN_SPACE (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[4] = p - subject;
+	ovector[5] = p + n - subject;
+	p += n;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	if (end - p < 9
+		|| memcmp (p, "Tracking:", 9))
+		return FALSE;
+
+	p += 9;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	if (end - p < 1)
+		return FALSE;
+
+	n = end - p;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (PARSE_BUILTIN_SPACE (*q))
+			return FALSE;
+	}
+
+	ovector[6] = p - subject;
+	ovector[7] = p + n - subject;
+	p += n;
+
+	return p == end;
+}
+
+static gboolean parse_builtin_match_12_2 (const gchar *subject, const gchar *p,
+	const gchar *end, PCRE2_SIZE *ovector)
+{
+	gsize n;
+
+	for (n = 0; p + n < end && !PARSE_BUILTIN_SPACE (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	if (end - p < 8
+		|| memcmp (p, "Agility:", 8))
+		return FALSE;
+
+	p += 8;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	for (n = 0; p + n < end && p[n] == '*'; n++)
+		;
+
+	for (;; n--)
+	{
+		if (parse_builtin_match_12_1 (subject, p + n, end, ovector))
+			return TRUE;
+
+		if (n == 0)
+			return FALSE;
+	}
+}
+
+static gboolean parse_builtin_match_12 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	gsize n;
+
+	if (length < 34)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 9
+		|| memcmp (p, "Strength:", 9))
+		return FALSE;
+
+	p += 9;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	for (n = 0; p + n < end && p[n] == '*'; n++)
+		;
+
+	for (;; n--)
+	{
+		if (parse_builtin_match_12_2 (subject, p + n, end, ovector))
+			return TRUE;
+
+		if (n == 0)
+			return FALSE;
+	}
+}
+
+
+/* Intellect: +\**{1} +Health: +\**{2} +Martial Arts: +{3} */
+
+static gboolean parse_builtin_match_13_1 (const gchar *subject, const gchar *p,
+	const gchar *end, PCRE2_SIZE *ovector)
+{
+	const gchar *q;
+	gsize n;
+
+	for (n = 0; p + n < end && !PARSE_BUILTIN_SPACE (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[4] = p - subject;
+	ovector[5] = p + n - subject;
+	p += n;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	if (end - p < 13
+		|| memcmp (p, "Martial Arts:", 13))
+		return FALSE;
+
+	p += 13;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	if (end - p < 1)
+		return FALSE;
+
+	n = end - p;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (PARSE_BUILTIN_SPACE (*q))
+			return FALSE;
+	}
+
+	ovector[6] = p - subject;
+	ovector[7] = p + n - subject;
+	p += n;
+
+	return p == end;
+}
+
+static gboolean parse_builtin_match_13_2 (const gchar *subject, const gchar *p,
+	const gchar *end, PCRE2_SIZE *ovector)
+{
+	gsize n;
+
+	for (n = 0; p + n < end && !PARSE_BUILTIN_SPACE (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	if (end - p < 7
+		|| memcmp (p, "Health:", 7))
+		return FALSE;
+
+	p += 7;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	for (n = 0; p + n < end && p[n] == '*'; n++)
+		;
+
+	for (;; n--)
+	{
+		if (parse_builtin_match_13_1 (subject, p + n, end, ovector))
+			return TRUE;
+
+		if (n == 0)
+			return FALSE;
+	}
+}
+
+static gboolean parse_builtin_match_13 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	gsize n;
+
+	if (length < 38)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 10
+		|| memcmp (p, "Intellect:", 10))
+		return FALSE;
+
+	p += 10;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	for (n = 0; p + n < end && p[n] == '*'; n++)
+		;
+
+	for (;; n--)
+	{
+		if (parse_builtin_match_13_2 (subject, p + n, end, ovector))
+			return TRUE;
+
+		if (n == 0)
+			return FALSE;
+	}
+}
+
+
+/* Willpower: +\**{1} +Charm: +\**{2} +MagicRes: +{3} */
+
+static gboolean parse_builtin_match_14_1 (const gchar *subject, const gchar *p,
+	const gchar *end, PCRE2_SIZE *ovector)
+{
+	const gchar *q;
+	gsize n;
+
+	for (n = 0; p + n < end && !PARSE_BUILTIN_SPACE (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[4] = p - subject;
+	ovector[5] = p + n - subject;
+	p += n;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	if (end - p < 9
+		|| memcmp (p, "MagicRes:", 9))
+		return FALSE;
+
+	p += 9;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	if (end - p < 1)
+		return FALSE;
+
+	n = end - p;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (PARSE_BUILTIN_SPACE (*q))
+			return FALSE;
+	}
+
+	ovector[6] = p - subject;
+	ovector[7] = p + n - subject;
+	p += n;
+
+	return p == end;
+}
+
+static gboolean parse_builtin_match_14_2 (const gchar *subject, const gchar *p,
+	const gchar *end, PCRE2_SIZE *ovector)
+{
+	gsize n;
+
+	for (n = 0; p + n < end && !PARSE_BUILTIN_SPACE (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	if (end - p < 6
+		|| memcmp (p, "Charm:", 6))
+		return FALSE;
+
+	p += 6;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	for (n = 0; p + n < end && p[n] == '*'; n++)
+		;
+
+	for (;; n--)
+	{
+		if (parse_builtin_match_14_1 (subject, p + n, end, ovector))
+			return TRUE;
+
+		if (n == 0)
+			return FALSE;
+	}
+}
+
+static gboolean parse_builtin_match_14 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	gsize n;
+
+	if (length < 33)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 10
+		|| memcmp (p, "Willpower:", 10))
+		return FALSE;
+
+	p += 10;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	for (n = 0; p + n < end && p[n] == '*'; n++)
+		;
+
+	for (;; n--)
+	{
+		if (parse_builtin_match_14_2 (subject, p + n, end, ovector))
+			return TRUE;
+
+		if (n == 0)
+			return FALSE;
+	}
+}
+
+
+/* The following people are in your travel party: */
+
+static gboolean parse_builtin_match_15 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 46)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 46
+		|| memcmp (p, "The following people are in your travel party:", 46))
+		return FALSE;
+
+	p += 46;
+
+	return p == end;
+}
+
+
+/*   {1} {2} +.\w+. +\[M: ?{3}%\] \[H: ?{4}%\]...- \w+ */
+
+static gboolean parse_builtin_match_16_1 (const gchar *subject, const gchar *p,
+	const gchar *end, PCRE2_SIZE *ovector)
+{
+	const gchar *q;
+	gsize n;
+
+	if (end - p < 7
+		|| !(!memcmp (p, "%]", 2)
+			&& p[2] != '\n'
+			&& p[3] != '\n'
+			&& p[4] != '\n'
+			&& !memcmp (p + 5, "- ", 2)))
+		return FALSE;
+
+	p += 7;
+
+	if (end - p < 1)
+		return FALSE;
+
+	n = end - p;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (!PARSE_BUILTIN_WORD (*q))
+			return FALSE;
+	}
+
+	p += n;
+
+	return p == end;
+}
+
+static gboolean parse_builtin_match_16_2 (const gchar *subject, const gchar *p,
+	const gchar *end, PCRE2_SIZE *ovector)
+{
+	gsize n;
+
+	if (end - p < 6
+		|| memcmp (p, "%] [H:", 6))
+		return FALSE;
+
+	p += 6;
+
+	for (n = 0; p + n < end && p[n] == ' ' && n < 1; n++)
+		;
+
+	p += n;
+
+	for (n = 0; p + n < end && !PARSE_BUILTIN_SPACE (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[8] = p - subject;
+
+	for (;; n--)
+	{
+		ovector[9] = p + n - subject;
+
+		if (parse_builtin_match_16_1 (subject, p + n, end, ovector))
+			return TRUE;
+
+		if (n == 1)
+			return FALSE;
+	}
+}
+
+static gboolean parse_builtin_match_16_3 (const gchar *subject, const gchar *p,
+	const gchar *end, PCRE2_SIZE *ovector)
+{
+	gsize n;
+
+	if (end - p < 1
+		|| p[0] == '\n')
+		return FALSE;
+
+	p += 1;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	if (end - p < 3
+		|| memcmp (p, "[M:", 3))
+		return FALSE;
+
+	p += 3;
+
+	for (n = 0; p + n < end && p[n] == ' ' && n < 1; n++)
+		;
+
+	p += n;
+
+	for (n = 0; p + n < end && !PARSE_BUILTIN_SPACE (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[6] = p - subject;
+
+	for (;; n--)
+	{
+		ovector[7] = p + n - subject;
+
+		if (parse_builtin_match_16_2 (subject, p + n, end, ovector))
+			return TRUE;
+
+		if (n == 1)
+			return FALSE;
+	}
+}
+
+static gboolean parse_builtin_match_16_4 (const gchar *subject, const gchar *p,
+	const gchar *end, PCRE2_SIZE *ovector)
+{
+	gsize n;
+
+	if (end - p < 1
+		|| p[0] == '\n')
+		return FALSE;
+
+	p += 1;
+
+	for (n = 0; p + n < end && PARSE_BUILTIN_WORD (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	for (;; n--)
+	{
+		if (parse_builtin_match_16_3 (subject, p + n, end, ovector))
+			return TRUE;
+
+		if (n == 1)
+			return FALSE;
+	}
+}
+
+static gboolean parse_builtin_match_16 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	gsize n;
+
+	if (length < 29)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 2
+		|| memcmp (p, "  ", 2))
+		return FALSE;
+
+	p += 2;
+
+	for (n = 0; p + n < end && !PARSE_BUILTIN_SPACE (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 1
+		|| p[0] != ' ')
+		return FALSE;
+
+	p += 1;
+
+	for (n = 0; p + n < end && !PARSE_BUILTIN_SPACE (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[4] = p - subject;
+	ovector[5] = p + n - subject;
+	p += n;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	for (;; n--)
+	{
+		if (parse_builtin_match_16_4 (subject, p + n, end, ovector))
+			return TRUE;
+
+		if (n == 1)
+			return FALSE;
+	}
+}
+
+
+/*   {1} {2} +.\w+. +\[H: ?{3}%\]...- \w+ */
+
+static gboolean parse_builtin_match_17_1 (const gchar *subject, const gchar *p,
+	const gchar *end, PCRE2_SIZE *ovector)
+{
+	const gchar *q;
+	gsize n;
+
+	if (end - p < 7
+		|| !(!memcmp (p, "%]", 2)
+			&& p[2] != '\n'
+			&& p[3] != '\n'
+			&& p[4] != '\n'
+			&& !memcmp (p + 5, "- ", 2)))
+		return FALSE;
+
+	p += 7;
+
+	if (end - p < 1)
+		return FALSE;
+
+	n = end - p;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (!PARSE_BUILTIN_WORD (*q))
+			return FALSE;
+	}
+
+	p += n;
+
+	return p == end;
+}
+
+static gboolean parse_builtin_match_17_2 (const gchar *subject, const gchar *p,
+	const gchar *end, PCRE2_SIZE *ovector)
+{
+	gsize n;
+
+	if (end - p < 1
+		|| p[0] == '\n')
+		return FALSE;
+
+	p += 1;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	if (end - p < 3
+		|| memcmp (p, "[H:", 3))
+		return FALSE;
+
+	p += 3;
+
+	for (n = 0; p + n < end && p[n] == ' ' && n < 1; n++)
+		;
+
+	p += n;
+
+	for (n = 0; p + n < end && !PARSE_BUILTIN_SPACE (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[6] = p - subject;
+
+	for (;; n--)
+	{
+		ovector[7] = p + n - subject;
+
+		if (parse_builtin_match_17_1 (subject, p + n, end, ovector))
+			return TRUE;
+
+		if (n == 1)
+			return FALSE;
+	}
+}
+
+static gboolean parse_builtin_match_17_3 (const gchar *subject, const gchar *p,
+	const gchar *end, PCRE2_SIZE *ovector)
+{
+	gsize n;
+
+	if (end - p < 1
+		|| p[0] == '\n')
+		return FALSE;
+
+	p += 1;
+
+	for (n = 0; p + n < end && PARSE_BUILTIN_WORD (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	for (;; n--)
+	{
+		if (parse_builtin_match_17_2 (subject, p + n, end, ovector))
+			return TRUE;
+
+		if (n == 1)
+			return FALSE;
+	}
+}
+
+static gboolean parse_builtin_match_17 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	gsize n;
+
+	if (length < 22)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 2
+		|| memcmp (p, "  ", 2))
+		return FALSE;
+
+	p += 2;
+
+	for (n = 0; p + n < end && !PARSE_BUILTIN_SPACE (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 1
+		|| p[0] != ' ')
+		return FALSE;
+
+	p += 1;
+
+	for (n = 0; p + n < end && !PARSE_BUILTIN_SPACE (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[4] = p - subject;
+	ovector[5] = p + n - subject;
+	p += n;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	for (;; n--)
+	{
+		if (parse_builtin_match_17_3 (subject, p + n, end, ovector))
+			return TRUE;
+
+		if (n == 1)
+			return FALSE;
+	}
+}
+
+
+/* Your search revealed nothing. */
+
+static gboolean parse_builtin_match_18 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 29)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 29
+		|| !(!memcmp (p, "Your search revealed nothing", 28)
+			&& p[28] != '\n'))
+		return FALSE;
+
+	p += 29;
+
+	return p == end;
+}
+
+
+/* Obvious exits: {*} */
+
+static gboolean parse_builtin_match_19 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 15)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 15
+		|| memcmp (p, "Obvious exits: ", 15))
+		return FALSE;
+
+	p += 15;
+
+	n = end - p;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	return p == end;
+}
+
+
+/* A horde of shrieking spirits ravages your foe for {#} damage! */
+
+static gboolean parse_builtin_match_20 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 59)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 50
+		|| memcmp (p, "A horde of shrieking spirits ravages your foe for ", 50))
+		return FALSE;
+
+	p += 50;
+
+	if (end - p < 9)
+		return FALSE;
+
+	n = end - p - 8;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (!g_ascii_isdigit (*q))
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 8
+		|| memcmp (p, " damage!", 8))
+		return FALSE;
+
+	p += 8;
+
+	return p == end;
+}
+
+
+/* Dancing blades slice the foe for {#} damage! */
+
+static gboolean parse_builtin_match_21 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 42)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 33
+		|| memcmp (p, "Dancing blades slice the foe for ", 33))
+		return FALSE;
+
+	p += 33;
+
+	if (end - p < 9)
+		return FALSE;
+
+	n = end - p - 8;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (!g_ascii_isdigit (*q))
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 8
+		|| memcmp (p, " damage!", 8))
+		return FALSE;
+
+	p += 8;
+
+	return p == end;
+}
+
+
+/* The fireball explodes, causing {#} damage! */
+
+static gboolean parse_builtin_match_22 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 40)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 31
+		|| memcmp (p, "The fireball explodes, causing ", 31))
+		return FALSE;
+
+	p += 31;
+
+	if (end - p < 9)
+		return FALSE;
+
+	n = end - p - 8;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (!g_ascii_isdigit (*q))
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 8
+		|| memcmp (p, " damage!", 8))
+		return FALSE;
+
+	p += 8;
+
+	return p == end;
+}
+
+
+/* A withering blast of dragonfire sears {monster} for {#} damage! */
+
+static gboolean parse_builtin_match_23_1 (const gchar *subject, const gchar *p,
+	const gchar *end, PCRE2_SIZE *ovector)
+{
+	const gchar *q;
+	gsize n;
+
+	if (end - p < 5
+		|| memcmp (p, " for ", 5))
+		return FALSE;
+
+	p += 5;
+
+	if (end - p < 9)
+		return FALSE;
+
+	n = end - p - 8;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (!g_ascii_isdigit (*q))
+			return FALSE;
+	}
+
+	ovector[4] = p - subject;
+	ovector[5] = p + n - subject;
+	p += n;
+
+	if (end - p < 8
+		|| memcmp (p, " damage!", 8))
+		return FALSE;
+
+	p += 8;
+
+	return p == end;
+}
+
+static gboolean parse_builtin_match_23 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	gsize n;
+
+	if (length < 53)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 38
+		|| memcmp (p, "A withering blast of dragonfire sears ", 38))
+		return FALSE;
+
+	p += 38;
+
+	for (n = 0; p + n < end && p[n] != '\n'; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[2] = p - subject;
+
+	for (;; n--)
+	{
+		ovector[3] = p + n - subject;
+
+		if (parse_builtin_match_23_1 (subject, p + n, end, ovector))
+			return TRUE;
+
+		if (n == 1)
+			return FALSE;
+	}
+}
+
+
+/* You fire {*} at {monster} for {#} damage! */
+
+static gboolean parse_builtin_match_24_1 (const gchar *subject, const gchar *p,
+	const gchar *end, PCRE2_SIZE *ovector)
+{
+	const gchar *q;
+	gsize n;
+
+	if (end - p < 5
+		|| memcmp (p, " for ", 5))
+		return FALSE;
+
+	p += 5;
+
+	if (end - p < 9)
+		return FALSE;
+
+	n = end - p - 8;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (!g_ascii_isdigit (*q))
+			return FALSE;
+	}
+
+	ovector[6] = p - subject;
+	ovector[7] = p + n - subject;
+	p += n;
+
+	if (end - p < 8
+		|| memcmp (p, " damage!", 8))
+		return FALSE;
+
+	p += 8;
+
+	return p == end;
+}
+
+static gboolean parse_builtin_match_24_2 (const gchar *subject, const gchar *p,
+	const gchar *end, PCRE2_SIZE *ovector)
+{
+	gsize n;
+
+	if (end - p < 4
+		|| memcmp (p, " at ", 4))
+		return FALSE;
+
+	p += 4;
+
+	for (n = 0; p + n < end && p[n] != '\n'; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[4] = p - subject;
+
+	for (;; n--)
+	{
+		ovector[5] = p + n - subject;
+
+		if (parse_builtin_match_24_1 (subject, p + n, end, ovector))
+			return TRUE;
+
+		if (n == 1)
+			return FALSE;
+	}
+}
+
+static gboolean parse_builtin_match_24 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	gsize n;
+
+	if (length < 28)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 9
+		|| memcmp (p, "You fire ", 9))
+		return FALSE;
+
+	p += 9;
+
+	for (n = 0; p + n < end && p[n] != '\n'; n++)
+		;
+
+	ovector[2] = p - subject;
+
+	for (;; n--)
+	{
+		ovector[3] = p + n - subject;
+
+		if (parse_builtin_match_24_2 (subject, p + n, end, ovector))
+			return TRUE;
+
+		if (n == 0)
+			return FALSE;
+	}
+}
+
+
+/* Your {*} strikes {monster} for {#} damage! */
+
+static gboolean parse_builtin_match_25_1 (const gchar *subject, const gchar *p,
+	const gchar *end, PCRE2_SIZE *ovector)
+{
+	const gchar *q;
+	gsize n;
+
+	if (end - p < 5
+		|| memcmp (p, " for ", 5))
+		return FALSE;
+
+	p += 5;
+
+	if (end - p < 9)
+		return FALSE;
+
+	n = end - p - 8;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (!g_ascii_isdigit (*q))
+			return FALSE;
+	}
+
+	ovector[6] = p - subject;
+	ovector[7] = p + n - subject;
+	p += n;
+
+	if (end - p < 8
+		|| memcmp (p, " damage!", 8))
+		return FALSE;
+
+	p += 8;
+
+	return p == end;
+}
+
+static gboolean parse_builtin_match_25_2 (const gchar *subject, const gchar *p,
+	const gchar *end, PCRE2_SIZE *ovector)
+{
+	gsize n;
+
+	if (end - p < 9
+		|| memcmp (p, " strikes ", 9))
+		return FALSE;
+
+	p += 9;
+
+	for (n = 0; p + n < end && p[n] != '\n'; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[4] = p - subject;
+
+	for (;; n--)
+	{
+		ovector[5] = p + n - subject;
+
+		if (parse_builtin_match_25_1 (subject, p + n, end, ovector))
+			return TRUE;
+
+		if (n == 1)
+			return FALSE;
+	}
+}
+
+static gboolean parse_builtin_match_25 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	gsize n;
+
+	if (length < 29)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 5
+		|| memcmp (p, "Your ", 5))
+		return FALSE;
+
+	p += 5;
+
+	for (n = 0; p + n < end && p[n] != '\n'; n++)
+		;
+
+	ovector[2] = p - subject;
+
+	for (;; n--)
+	{
+		ovector[3] = p + n - subject;
+
+		if (parse_builtin_match_25_2 (subject, p + n, end, ovector))
+			return TRUE;
+
+		if (n == 0)
+			return FALSE;
+	}
+}
+
+
+/* You attempt to cast {*}, but fail. */
+
+static gboolean parse_builtin_match_26 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 31)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 20
+		|| memcmp (p, "You attempt to cast ", 20))
+		return FALSE;
+
+	p += 20;
+
+	if (end - p < 11)
+		return FALSE;
+
+	n = end - p - 11;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 11
+		|| !(!memcmp (p, ", but fail", 10)
+			&& p[10] != '\n'))
+		return FALSE;
+
+	p += 11;
+
+	return p == end;
+}
+
+
+/* {player} moves to attack {monster}. */
+
+static gboolean parse_builtin_match_27 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 20)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	for (n = 0; p + n < end && PARSE_BUILTIN_WORD (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 17
+		|| memcmp (p, " moves to attack ", 17))
+		return FALSE;
+
+	p += 17;
+
+	if (end - p < 2)
+		return FALSE;
+
+	n = end - p - 1;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[4] = p - subject;
+	ovector[5] = p + n - subject;
+	p += n;
+
+	if (end - p < 1
+		|| p[0] == '\n')
+		return FALSE;
+
+	p += 1;
+
+	return p == end;
+}
+
+
+/* The {monster} fires {*} at you for {#} damage! */
+
+static gboolean parse_builtin_match_28_1 (const gchar *subject, const gchar *p,
+	const gchar *end, PCRE2_SIZE *ovector)
+{
+	const gchar *q;
+	gsize n;
+
+	if (end - p < 12
+		|| memcmp (p, " at you for ", 12))
+		return FALSE;
+
+	p += 12;
+
+	if (end - p < 9)
+		return FALSE;
+
+	n = end - p - 8;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (!g_ascii_isdigit (*q))
+			return FALSE;
+	}
+
+	ovector[6] = p - subject;
+	ovector[7] = p + n - subject;
+	p += n;
+
+	if (end - p < 8
+		|| memcmp (p, " damage!", 8))
+		return FALSE;
+
+	p += 8;
+
+	return p == end;
+}
+
+static gboolean parse_builtin_match_28_2 (const gchar *subject, const gchar *p,
+	const gchar *end, PCRE2_SIZE *ovector)
+{
+	gsize n;
+
+	if (end - p < 7
+		|| memcmp (p, " fires ", 7))
+		return FALSE;
+
+	p += 7;
+
+	for (n = 0; p + n < end && p[n] != '\n'; n++)
+		;
+
+	ovector[4] = p - subject;
+
+	for (;; n--)
+	{
+		ovector[5] = p + n - subject;
+
+		if (parse_builtin_match_28_1 (subject, p + n, end, ovector))
+			return TRUE;
+
+		if (n == 0)
+			return FALSE;
+	}
+}
+
+static gboolean parse_builtin_match_28 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	gsize n;
+
+	if (length < 33)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 4
+		|| memcmp (p, "The ", 4))
+		return FALSE;
+
+	p += 4;
+
+	for (n = 0; p + n < end && p[n] != '\n'; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[2] = p - subject;
+
+	for (;; n--)
+	{
+		ovector[3] = p + n - subject;
+
+		if (parse_builtin_match_28_2 (subject, p + n, end, ovector))
+			return TRUE;
+
+		if (n == 1)
+			return FALSE;
+	}
+}
+
+
+/* The {monster} casts {*} on you for {#} damage! */
+
+static gboolean parse_builtin_match_29_1 (const gchar *subject, const gchar *p,
+	const gchar *end, PCRE2_SIZE *ovector)
+{
+	const gchar *q;
+	gsize n;
+
+	if (end - p < 12
+		|| memcmp (p, " on you for ", 12))
+		return FALSE;
+
+	p += 12;
+
+	if (end - p < 9)
+		return FALSE;
+
+	n = end - p - 8;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (!g_ascii_isdigit (*q))
+			return FALSE;
+	}
+
+	ovector[6] = p - subject;
+	ovector[7] = p + n - subject;
+	p += n;
+
+	if (end - p < 8
+		|| memcmp (p, " damage!", 8))
+		return FALSE;
+
+	p += 8;
+
+	return p == end;
+}
+
+static gboolean parse_builtin_match_29_2 (const gchar *subject, const gchar *p,
+	const gchar *end, PCRE2_SIZE *ovector)
+{
+	gsize n;
+
+	if (end - p < 7
+		|| memcmp (p, " casts ", 7))
+		return FALSE;
+
+	p += 7;
+
+	for (n = 0; p + n < end && p[n] != '\n'; n++)
+		;
+
+	ovector[4] = p - subject;
+
+	for (;; n--)
+	{
+		ovector[5] = p + n - subject;
+
+		if (parse_builtin_match_29_1 (subject, p + n, end, ovector))
+			return TRUE;
+
+		if (n == 0)
+			return FALSE;
+	}
+}
+
+static gboolean parse_builtin_match_29 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	gsize n;
+
+	if (length < 33)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 4
+		|| memcmp (p, "The ", 4))
+		return FALSE;
+
+	p += 4;
+
+	for (n = 0; p + n < end && p[n] != '\n'; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[2] = p - subject;
+
+	for (;; n--)
+	{
+		ovector[3] = p + n - subject;
+
+		if (parse_builtin_match_29_2 (subject, p + n, end, ovector))
+			return TRUE;
+
+		if (n == 1)
+			return FALSE;
+	}
+}
+
+
+/* The {monster} touches you with a ghostly hand for {#} damage! */
+
+static gboolean parse_builtin_match_30_1 (const gchar *subject, const gchar *p,
+	const gchar *end, PCRE2_SIZE *ovector)
+{
+	const gchar *q;
+	gsize n;
+
+	if (end - p < 37
+		|| memcmp (p, " touches you with a ghostly hand for ", 37))
+		return FALSE;
+
+	p += 37;
+
+	if (end - p < 9)
+		return FALSE;
+
+	n = end - p - 8;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (!g_ascii_isdigit (*q))
+			return FALSE;
+	}
+
+	ovector[4] = p - subject;
+	ovector[5] = p + n - subject;
+	p += n;
+
+	if (end - p < 8
+		|| memcmp (p, " damage!", 8))
+		return FALSE;
+
+	p += 8;
+
+	return p == end;
+}
+
+static gboolean parse_builtin_match_30 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	gsize n;
+
+	if (length < 51)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 4
+		|| memcmp (p, "The ", 4))
+		return FALSE;
+
+	p += 4;
+
+	for (n = 0; p + n < end && p[n] != '\n'; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[2] = p - subject;
+
+	for (;; n--)
+	{
+		ovector[3] = p + n - subject;
+
+		if (parse_builtin_match_30_1 (subject, p + n, end, ovector))
+			return TRUE;
+
+		if (n == 1)
+			return FALSE;
+	}
+}
+
+
+/* The {monster} draws the breath from your body for {#} damage! */
+
+static gboolean parse_builtin_match_31_1 (const gchar *subject, const gchar *p,
+	const gchar *end, PCRE2_SIZE *ovector)
+{
+	const gchar *q;
+	gsize n;
+
+	if (end - p < 37
+		|| memcmp (p, " draws the breath from your body for ", 37))
+		return FALSE;
+
+	p += 37;
+
+	if (end - p < 9)
+		return FALSE;
+
+	n = end - p - 8;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (!g_ascii_isdigit (*q))
+			return FALSE;
+	}
+
+	ovector[4] = p - subject;
+	ovector[5] = p + n - subject;
+	p += n;
+
+	if (end - p < 8
+		|| memcmp (p, " damage!", 8))
+		return FALSE;
+
+	p += 8;
+
+	return p == end;
+}
+
+static gboolean parse_builtin_match_31 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	gsize n;
+
+	if (length < 51)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 4
+		|| memcmp (p, "The ", 4))
+		return FALSE;
+
+	p += 4;
+
+	for (n = 0; p + n < end && p[n] != '\n'; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[2] = p - subject;
+
+	for (;; n--)
+	{
+		ovector[3] = p + n - subject;
+
+		if (parse_builtin_match_31_1 (subject, p + n, end, ovector))
+			return TRUE;
+
+		if (n == 1)
+			return FALSE;
+	}
+}
+
+
+/* The {monster} sprays the area with thorns for {#} damage! */
+
+static gboolean parse_builtin_match_32_1 (const gchar *subject, const gchar *p,
+	const gchar *end, PCRE2_SIZE *ovector)
+{
+	const gchar *q;
+	gsize n;
+
+	if (end - p < 33
+		|| memcmp (p, " sprays the area with thorns for ", 33))
+		return FALSE;
+
+	p += 33;
+
+	if (end - p < 9)
+		return FALSE;
+
+	n = end - p - 8;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (!g_ascii_isdigit (*q))
+			return FALSE;
+	}
+
+	ovector[4] = p - subject;
+	ovector[5] = p + n - subject;
+	p += n;
+
+	if (end - p < 8
+		|| memcmp (p, " damage!", 8))
+		return FALSE;
+
+	p += 8;
+
+	return p == end;
+}
+
+static gboolean parse_builtin_match_32 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	gsize n;
+
+	if (length < 47)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 4
+		|| memcmp (p, "The ", 4))
+		return FALSE;
+
+	p += 4;
+
+	for (n = 0; p + n < end && p[n] != '\n'; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[2] = p - subject;
+
+	for (;; n--)
+	{
+		ovector[3] = p + n - subject;
+
+		if (parse_builtin_match_32_1 (subject, p + n, end, ovector))
+			return TRUE;
+
+		if (n == 1)
+			return FALSE;
+	}
+}
+
+
+/* The {monster} breathes its ice breath on you for {#} damage! */
+
+static gboolean parse_builtin_match_33_1 (const gchar *subject, const gchar *p,
+	const gchar *end, PCRE2_SIZE *ovector)
+{
+	const gchar *q;
+	gsize n;
+
+	if (end - p < 36
+		|| memcmp (p, " breathes its ice breath on you for ", 36))
+		return FALSE;
+
+	p += 36;
+
+	if (end - p < 9)
+		return FALSE;
+
+	n = end - p - 8;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (!g_ascii_isdigit (*q))
+			return FALSE;
+	}
+
+	ovector[4] = p - subject;
+	ovector[5] = p + n - subject;
+	p += n;
+
+	if (end - p < 8
+		|| memcmp (p, " damage!", 8))
+		return FALSE;
+
+	p += 8;
+
+	return p == end;
+}
+
+static gboolean parse_builtin_match_33 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	gsize n;
+
+	if (length < 50)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 4
+		|| memcmp (p, "The ", 4))
+		return FALSE;
+
+	p += 4;
+
+	for (n = 0; p + n < end && p[n] != '\n'; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[2] = p - subject;
+
+	for (;; n--)
+	{
+		ovector[3] = p + n - subject;
+
+		if (parse_builtin_match_33_1 (subject, p + n, end, ovector))
+			return TRUE;
+
+		if (n == 1)
+			return FALSE;
+	}
+}
+
+
+/* {monster} draws the breath from your body for {#} damage! */
+
+static gboolean parse_builtin_match_34_1 (const gchar *subject, const gchar *p,
+	const gchar *end, PCRE2_SIZE *ovector)
+{
+	const gchar *q;
+	gsize n;
+
+	if (end - p < 37
+		|| memcmp (p, " draws the breath from your body for ", 37))
+		return FALSE;
+
+	p += 37;
+
+	if (end - p < 9)
+		return FALSE;
+
+	n = end - p - 8;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (!g_ascii_isdigit (*q))
+			return FALSE;
+	}
+
+	ovector[4] = p - subject;
+	ovector[5] = p + n - subject;
+	p += n;
+
+	if (end - p < 8
+		|| memcmp (p, " damage!", 8))
+		return FALSE;
+
+	p += 8;
+
+	return p == end;
+}
+
+static gboolean parse_builtin_match_34 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	gsize n;
+
+	if (length < 47)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	for (n = 0; p + n < end && p[n] != '\n'; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[2] = p - subject;
+
+	for (;; n--)
+	{
+		ovector[3] = p + n - subject;
+
+		if (parse_builtin_match_34_1 (subject, p + n, end, ovector))
+			return TRUE;
+
+		if (n == 1)
+			return FALSE;
+	}
+}
+
+
+/* {monster} fires {*} at you for {#} damage! */
+
+static gboolean parse_builtin_match_35_1 (const gchar *subject, const gchar *p,
+	const gchar *end, PCRE2_SIZE *ovector)
+{
+	const gchar *q;
+	gsize n;
+
+	if (end - p < 12
+		|| memcmp (p, " at you for ", 12))
+		return FALSE;
+
+	p += 12;
+
+	if (end - p < 9)
+		return FALSE;
+
+	n = end - p - 8;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (!g_ascii_isdigit (*q))
+			return FALSE;
+	}
+
+	ovector[6] = p - subject;
+	ovector[7] = p + n - subject;
+	p += n;
+
+	if (end - p < 8
+		|| memcmp (p, " damage!", 8))
+		return FALSE;
+
+	p += 8;
+
+	return p == end;
+}
+
+static gboolean parse_builtin_match_35_2 (const gchar *subject, const gchar *p,
+	const gchar *end, PCRE2_SIZE *ovector)
+{
+	gsize n;
+
+	if (end - p < 7
+		|| memcmp (p, " fires ", 7))
+		return FALSE;
+
+	p += 7;
+
+	for (n = 0; p + n < end && p[n] != '\n'; n++)
+		;
+
+	ovector[4] = p - subject;
+
+	for (;; n--)
+	{
+		ovector[5] = p + n - subject;
+
+		if (parse_builtin_match_35_1 (subject, p + n, end, ovector))
+			return TRUE;
+
+		if (n == 0)
+			return FALSE;
+	}
+}
+
+static gboolean parse_builtin_match_35 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	gsize n;
+
+	if (length < 29)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	for (n = 0; p + n < end && p[n] != '\n'; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[2] = p - subject;
+
+	for (;; n--)
+	{
+		ovector[3] = p + n - subject;
+
+		if (parse_builtin_match_35_2 (subject, p + n, end, ovector))
+			return TRUE;
+
+		if (n == 1)
+			return FALSE;
+	}
+}
+
+
+/* {monster} moves to protect {*}. */
+
+static gboolean parse_builtin_match_36_1 (const gchar *subject, const gchar *p,
+	const gchar *end, PCRE2_SIZE *ovector)
+{
+	const gchar *q;
+	gsize n;
+
+	if (end - p < 18
+		|| memcmp (p, " moves to protect ", 18))
+		return FALSE;
+
+	p += 18;
+
+	if (end - p < 1)
+		return FALSE;
+
+	n = end - p - 1;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[4] = p - subject;
+	ovector[5] = p + n - subject;
+	p += n;
+
+	if (end - p < 1
+		|| p[0] == '\n')
+		return FALSE;
+
+	p += 1;
+
+	return p == end;
+}
+
+static gboolean parse_builtin_match_36 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	gsize n;
+
+	if (length < 20)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	for (n = 0; p + n < end && p[n] != '\n'; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[2] = p - subject;
+
+	for (;; n--)
+	{
+		ovector[3] = p + n - subject;
+
+		if (parse_builtin_match_36_1 (subject, p + n, end, ovector))
+			return TRUE;
+
+		if (n == 1)
+			return FALSE;
+	}
+}
+
+
+/* You cast {*}. */
+
+static gboolean parse_builtin_match_37 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 10)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 9
+		|| memcmp (p, "You cast ", 9))
+		return FALSE;
+
+	p += 9;
+
+	if (end - p < 1)
+		return FALSE;
+
+	n = end - p - 1;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 1
+		|| p[0] == '\n')
+		return FALSE;
+
+	p += 1;
+
+	return p == end;
+}
+
+
+/* You draw {*}! */
+
+static gboolean parse_builtin_match_38 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 10)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 9
+		|| memcmp (p, "You draw ", 9))
+		return FALSE;
+
+	p += 9;
+
+	if (end - p < 1)
+		return FALSE;
+
+	n = end - p - 1;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 1
+		|| p[0] != '!')
+		return FALSE;
+
+	p += 1;
+
+	return p == end;
+}
+
+
+/* You invoke {*}. */
+
+static gboolean parse_builtin_match_39 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 12)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 11
+		|| memcmp (p, "You invoke ", 11))
+		return FALSE;
+
+	p += 11;
+
+	if (end - p < 1)
+		return FALSE;
+
+	n = end - p - 1;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 1
+		|| p[0] == '\n')
+		return FALSE;
+
+	p += 1;
+
+	return p == end;
+}
+
+
+/* You feel strange for a moment. */
+
+static gboolean parse_builtin_match_40 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 30)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 30
+		|| !(!memcmp (p, "You feel strange for a moment", 29)
+			&& p[29] != '\n'))
+		return FALSE;
+
+	p += 30;
+
+	return p == end;
+}
+
+
+/* You attempt to cast {*}, but fail. */
+
+static gboolean parse_builtin_match_41 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 31)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 20
+		|| memcmp (p, "You attempt to cast ", 20))
+		return FALSE;
+
+	p += 20;
+
+	if (end - p < 11)
+		return FALSE;
+
+	n = end - p - 11;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 11
+		|| !(!memcmp (p, ", but fail", 10)
+			&& p[10] != '\n'))
+		return FALSE;
+
+	p += 11;
+
+	return p == end;
+}
+
+
+/* You have already cast a spell this round! */
+
+static gboolean parse_builtin_match_42 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 41)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 41
+		|| memcmp (p, "You have already cast a spell this round!", 41))
+		return FALSE;
+
+	p += 41;
+
+	return p == end;
+}
+
+
+/* You do not have enough mana to cast that spell. */
+
+static gboolean parse_builtin_match_43 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 47)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 47
+		|| !(!memcmp (p, "You do not have enough mana to cast that spell", 46)
+			&& p[46] != '\n'))
+		return FALSE;
+
+	p += 47;
+
+	return p == end;
+}
+
+
+/* Why would you want to cast a spell on that? */
+
+static gboolean parse_builtin_match_44 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 41)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 41
+		|| memcmp (p, "Why would you want to cast a spell on tha", 41))
+		return FALSE;
+
+	p += 41;
+
+	n = end - p;
+	if (n > 1)
+		return FALSE;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q != 't')
+			return FALSE;
+	}
+
+	p += n;
+
+	return p == end;
+}
+
+
+/* You may not cast that spell on an item! */
+
+static gboolean parse_builtin_match_45 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 39)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 39
+		|| memcmp (p, "You may not cast that spell on an item!", 39))
+		return FALSE;
+
+	p += 39;
+
+	return p == end;
+}
+
+
+/* Your spell has no effect in this room! */
+
+static gboolean parse_builtin_match_46 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 38)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 38
+		|| memcmp (p, "Your spell has no effect in this room!", 38))
+		return FALSE;
+
+	p += 38;
+
+	return p == end;
+}
+
+
+/* You do not see {*} here! */
+
+static gboolean parse_builtin_match_47 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 21)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 15
+		|| memcmp (p, "You do not see ", 15))
+		return FALSE;
+
+	p += 15;
+
+	if (end - p < 6)
+		return FALSE;
+
+	n = end - p - 6;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 6
+		|| memcmp (p, " here!", 6))
+		return FALSE;
+
+	p += 6;
+
+	return p == end;
+}
+
+
+/* You don't see that anywhere! */
+
+static gboolean parse_builtin_match_48 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 28)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 28
+		|| memcmp (p, "You don't see that anywhere!", 28))
+		return FALSE;
+
+	p += 28;
+
+	return p == end;
+}
+
+
+/* You are not carrying {*} */
+
+static gboolean parse_builtin_match_49 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 21)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 21
+		|| memcmp (p, "You are not carrying ", 21))
+		return FALSE;
+
+	p += 21;
+
+	n = end - p;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	return p == end;
+}
+
+
+/* Your spell has no effect in this room! */
+
+static gboolean parse_builtin_match_50 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 38)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 38
+		|| memcmp (p, "Your spell has no effect in this room!", 38))
+		return FALSE;
+
+	p += 38;
+
+	return p == end;
+}
+
+
+/* {player} gangpaths: {*} */
+
+static gboolean parse_builtin_match_51 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 13)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	for (n = 0; p + n < end && PARSE_BUILTIN_WORD (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 12
+		|| memcmp (p, " gangpaths: ", 12))
+		return FALSE;
+
+	p += 12;
+
+	n = end - p;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[4] = p - subject;
+	ovector[5] = p + n - subject;
+	p += n;
+
+	return p == end;
+}
+
+
+/* You say .{*}. */
+
+static gboolean parse_builtin_match_52 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 10)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 9
+		|| !(!memcmp (p, "You say ", 8)
+			&& p[8] != '\n'))
+		return FALSE;
+
+	p += 9;
+
+	if (end - p < 1)
+		return FALSE;
+
+	n = end - p - 1;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 1
+		|| p[0] == '\n')
+		return FALSE;
+
+	p += 1;
+
+	return p == end;
+}
+
+
+/* You say .{*}. */
+
+static gboolean parse_builtin_match_53 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 10)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 9
+		|| !(!memcmp (p, "You say ", 8)
+			&& p[8] != '\n'))
+		return FALSE;
+
+	p += 9;
+
+	if (end - p < 1)
+		return FALSE;
+
+	n = end - p - 1;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 1
+		|| p[0] == '\n')
+		return FALSE;
+
+	p += 1;
+
+	return p == end;
+}
+
+
+/* You yell .{*}. */
+
+static gboolean parse_builtin_match_54 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 11)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 10
+		|| !(!memcmp (p, "You yell ", 9)
+			&& p[9] != '\n'))
+		return FALSE;
+
+	p += 10;
+
+	if (end - p < 1)
+		return FALSE;
+
+	n = end - p - 1;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 1
+		|| p[0] == '\n')
+		return FALSE;
+
+	p += 1;
+
+	return p == end;
+}
+
+
+/* --- Message Directed to {player} --- */
+
+static gboolean parse_builtin_match_55 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 29)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 24
+		|| memcmp (p, "--- Message Directed to ", 24))
+		return FALSE;
+
+	p += 24;
+
+	if (end - p < 5)
+		return FALSE;
+
+	n = end - p - 4;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (!PARSE_BUILTIN_WORD (*q))
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 4
+		|| memcmp (p, " ---", 4))
+		return FALSE;
+
+	p += 4;
+
+	return p == end;
+}
+
+
+/* --- Telepath Sent to {player} --- */
+
+static gboolean parse_builtin_match_56 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 26)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 21
+		|| memcmp (p, "--- Telepath Sent to ", 21))
+		return FALSE;
+
+	p += 21;
+
+	if (end - p < 5)
+		return FALSE;
+
+	n = end - p - 4;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (!PARSE_BUILTIN_WORD (*q))
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 4
+		|| memcmp (p, " ---", 4))
+		return FALSE;
+
+	p += 4;
+
+	return p == end;
+}
+
+
+/* You have to telepath something! */
+
+static gboolean parse_builtin_match_57 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 31)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 31
+		|| memcmp (p, "You have to telepath something!", 31))
+		return FALSE;
+
+	p += 31;
+
+	return p == end;
+}
+
+
+/* Cannot find user! */
+
+static gboolean parse_builtin_match_58 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 17)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 17
+		|| memcmp (p, "Cannot find user!", 17))
+		return FALSE;
+
+	p += 17;
+
+	return p == end;
+}
+
+
+/* Why are you telepathing to yourself? */
+
+static gboolean parse_builtin_match_59 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 34)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 34
+		|| memcmp (p, "Why are you telepathing to yoursel", 34))
+		return FALSE;
+
+	p += 34;
+
+	n = end - p;
+	if (n > 1)
+		return FALSE;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q != 'f')
+			return FALSE;
+	}
+
+	p += n;
+
+	return p == end;
+}
+
+
+/* You must be invited first! */
+
+static gboolean parse_builtin_match_60 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 26)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 26
+		|| memcmp (p, "You must be invited first!", 26))
+		return FALSE;
+
+	p += 26;
+
+	return p == end;
+}
+
+
+/* You have moved to the {*} ranks of your group. */
+
+static gboolean parse_builtin_match_61 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 43)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 22
+		|| memcmp (p, "You have moved to the ", 22))
+		return FALSE;
+
+	p += 22;
+
+	if (end - p < 21)
+		return FALSE;
+
+	n = end - p - 21;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 21
+		|| !(!memcmp (p, " ranks of your group", 20)
+			&& p[20] != '\n'))
+		return FALSE;
+
+	p += 21;
+
+	return p == end;
+}
+
+
+/* You deposit {*} */
+
+static gboolean parse_builtin_match_62 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 12)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 12
+		|| memcmp (p, "You deposit ", 12))
+		return FALSE;
+
+	p += 12;
+
+	n = end - p;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	return p == end;
+}
+
+
+/* You withdrew {*} */
+
+static gboolean parse_builtin_match_63 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 13)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 13
+		|| memcmp (p, "You withdrew ", 13))
+		return FALSE;
+
+	p += 13;
+
+	n = end - p;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	return p == end;
+}
+
+
+/* You cannot DEPOSIT if you are not in a bank! */
+
+static gboolean parse_builtin_match_64 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 44)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 44
+		|| memcmp (p, "You cannot DEPOSIT if you are not in a bank!", 44))
+		return FALSE;
+
+	p += 44;
+
+	return p == end;
+}
+
+
+/* Please specify a more reasonable amount. */
+
+static gboolean parse_builtin_match_65 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 40)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 40
+		|| !(!memcmp (p, "Please specify a more reasonable amount", 39)
+			&& p[39] != '\n'))
+		return FALSE;
+
+	p += 40;
+
+	return p == end;
+}
+
+
+/* You just bought {*} for {*} */
+
+static gboolean parse_builtin_match_66_1 (const gchar *subject, const gchar *p,
+	const gchar *end, PCRE2_SIZE *ovector)
+{
+	const gchar *q;
+	gsize n;
+
+	if (end - p < 5
+		|| memcmp (p, " for ", 5))
+		return FALSE;
+
+	p += 5;
+
+	n = end - p;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[4] = p - subject;
+	ovector[5] = p + n - subject;
+	p += n;
+
+	return p == end;
+}
+
+static gboolean parse_builtin_match_66 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	gsize n;
+
+	if (length < 21)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 16
+		|| memcmp (p, "You just bought ", 16))
+		return FALSE;
+
+	p += 16;
+
+	for (n = 0; p + n < end && p[n] != '\n'; n++)
+		;
+
+	ovector[2] = p - subject;
+
+	for (;; n--)
+	{
+		ovector[3] = p + n - subject;
+
+		if (parse_builtin_match_66_1 (subject, p + n, end, ovector))
+			return TRUE;
+
+		if (n == 0)
+			return FALSE;
+	}
+}
+
+
+/* {*} is not a known item. */
+
+static gboolean parse_builtin_match_67 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 21)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 21)
+		return FALSE;
+
+	n = end - p - 21;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 21
+		|| !(!memcmp (p, " is not a known item", 20)
+			&& p[20] != '\n'))
+		return FALSE;
+
+	p += 21;
+
+	return p == end;
+}
+
+
+/* You sold {*} for {*} */
+
+static gboolean parse_builtin_match_68_1 (const gchar *subject, const gchar *p,
+	const gchar *end, PCRE2_SIZE *ovector)
+{
+	const gchar *q;
+	gsize n;
+
+	if (end - p < 5
+		|| memcmp (p, " for ", 5))
+		return FALSE;
+
+	p += 5;
+
+	n = end - p;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[4] = p - subject;
+	ovector[5] = p + n - subject;
+	p += n;
+
+	return p == end;
+}
+
+static gboolean parse_builtin_match_68 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	gsize n;
+
+	if (length < 14)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 9
+		|| memcmp (p, "You sold ", 9))
+		return FALSE;
+
+	p += 9;
+
+	for (n = 0; p + n < end && p[n] != '\n'; n++)
+		;
+
+	ovector[2] = p - subject;
+
+	for (;; n--)
+	{
+		ovector[3] = p + n - subject;
+
+		if (parse_builtin_match_68_1 (subject, p + n, end, ovector))
+			return TRUE;
+
+		if (n == 0)
+			return FALSE;
+	}
+}
+
+
+/* You don't have {*} to sell! */
+
+static gboolean parse_builtin_match_69 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 24)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 15
+		|| memcmp (p, "You don't have ", 15))
+		return FALSE;
+
+	p += 15;
+
+	if (end - p < 9)
+		return FALSE;
+
+	n = end - p - 9;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 9
+		|| memcmp (p, " to sell!", 9))
+		return FALSE;
+
+	p += 9;
+
+	return p == end;
+}
+
+
+/* You just paid {*} in toll charges. */
+
+static gboolean parse_builtin_match_70 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 31)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 14
+		|| memcmp (p, "You just paid ", 14))
+		return FALSE;
+
+	p += 14;
+
+	if (end - p < 17)
+		return FALSE;
+
+	n = end - p - 17;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 17
+		|| !(!memcmp (p, " in toll charges", 16)
+			&& p[16] != '\n'))
+		return FALSE;
+
+	p += 17;
+
+	return p == end;
+}
+
+
+/* You took {*}. */
+
+static gboolean parse_builtin_match_71 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 10)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 9
+		|| memcmp (p, "You took ", 9))
+		return FALSE;
+
+	p += 9;
+
+	if (end - p < 1)
+		return FALSE;
+
+	n = end - p - 1;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 1
+		|| p[0] == '\n')
+		return FALSE;
+
+	p += 1;
+
+	return p == end;
+}
+
+
+/* You picked up {*} */
+
+static gboolean parse_builtin_match_72 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 14)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 14
+		|| memcmp (p, "You picked up ", 14))
+		return FALSE;
+
+	p += 14;
+
+	n = end - p;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	return p == end;
+}
+
+
+/* You don't see {*} here. */
+
+static gboolean parse_builtin_match_73 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 20)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 14
+		|| memcmp (p, "You don't see ", 14))
+		return FALSE;
+
+	p += 14;
+
+	if (end - p < 6)
+		return FALSE;
+
+	n = end - p - 6;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 6
+		|| !(!memcmp (p, " here", 5)
+			&& p[5] != '\n'))
+		return FALSE;
+
+	p += 6;
+
+	return p == end;
+}
+
+
+/* You don't see {*} */
+
+static gboolean parse_builtin_match_74 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 14)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 14
+		|| memcmp (p, "You don't see ", 14))
+		return FALSE;
+
+	p += 14;
+
+	n = end - p;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	return p == end;
+}
+
+
+/* You don't have {*} to drop! */
+
+static gboolean parse_builtin_match_75 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 24)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 15
+		|| memcmp (p, "You don't have ", 15))
+		return FALSE;
+
+	p += 15;
+
+	if (end - p < 9)
+		return FALSE;
+
+	n = end - p - 9;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 9
+		|| memcmp (p, " to drop!", 9))
+		return FALSE;
+
+	p += 9;
+
+	return p == end;
+}
+
+
+/* You dropped {*}. */
+
+static gboolean parse_builtin_match_76 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 13)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 12
+		|| memcmp (p, "You dropped ", 12))
+		return FALSE;
+
+	p += 12;
+
+	if (end - p < 1)
+		return FALSE;
+
+	n = end - p - 1;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 1
+		|| p[0] == '\n')
+		return FALSE;
+
+	p += 1;
+
+	return p == end;
+}
+
+
+/* You hid {*}. */
+
+static gboolean parse_builtin_match_77 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 9)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 8
+		|| memcmp (p, "You hid ", 8))
+		return FALSE;
+
+	p += 8;
+
+	if (end - p < 1)
+		return FALSE;
+
+	n = end - p - 1;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 1
+		|| p[0] == '\n')
+		return FALSE;
+
+	p += 1;
+
+	return p == end;
+}
+
+
+/* You don't have {*} to hide! */
+
+static gboolean parse_builtin_match_78 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 24)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 15
+		|| memcmp (p, "You don't have ", 15))
+		return FALSE;
+
+	p += 15;
+
+	if (end - p < 9)
+		return FALSE;
+
+	n = end - p - 9;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 9
+		|| memcmp (p, " to hide!", 9))
+		return FALSE;
+
+	p += 9;
+
+	return p == end;
+}
+
+
+/* You cannot carry that much! */
+
+static gboolean parse_builtin_match_79 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 27)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 27
+		|| memcmp (p, "You cannot carry that much!", 27))
+		return FALSE;
+
+	p += 27;
+
+	return p == end;
+}
+
+
+/* You do not have {*} left unequipped. */
+
+static gboolean parse_builtin_match_80 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 33)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 16
+		|| memcmp (p, "You do not have ", 16))
+		return FALSE;
+
+	p += 16;
+
+	if (end - p < 17)
+		return FALSE;
+
+	n = end - p - 17;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 17
+		|| !(!memcmp (p, " left unequipped", 16)
+			&& p[16] != '\n'))
+		return FALSE;
+
+	p += 17;
+
+	return p == end;
+}
+
+
+/* You are now holding {*}. */
+
+static gboolean parse_builtin_match_81 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 21)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 20
+		|| memcmp (p, "You are now holding ", 20))
+		return FALSE;
+
+	p += 20;
+
+	if (end - p < 1)
+		return FALSE;
+
+	n = end - p - 1;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 1
+		|| p[0] == '\n')
+		return FALSE;
+
+	p += 1;
+
+	return p == end;
+}
+
+
+/* You are now wearing {*}. */
+
+static gboolean parse_builtin_match_82 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 21)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 20
+		|| memcmp (p, "You are now wearing ", 20))
+		return FALSE;
+
+	p += 20;
+
+	if (end - p < 1)
+		return FALSE;
+
+	n = end - p - 1;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 1
+		|| p[0] == '\n')
+		return FALSE;
+
+	p += 1;
+
+	return p == end;
+}
+
+
+/* You lit the {*}. */
+
+static gboolean parse_builtin_match_83 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 13)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 12
+		|| memcmp (p, "You lit the ", 12))
+		return FALSE;
+
+	p += 12;
+
+	if (end - p < 1)
+		return FALSE;
+
+	n = end - p - 1;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 1
+		|| p[0] == '\n')
+		return FALSE;
+
+	p += 1;
+
+	return p == end;
+}
+
+
+/* You have removed {*} and extinguished it. */
+
+static gboolean parse_builtin_match_84 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 38)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 17
+		|| memcmp (p, "You have removed ", 17))
+		return FALSE;
+
+	p += 17;
+
+	if (end - p < 21)
+		return FALSE;
+
+	n = end - p - 21;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 21
+		|| !(!memcmp (p, " and extinguished it", 20)
+			&& p[20] != '\n'))
+		return FALSE;
+
+	p += 21;
+
+	return p == end;
+}
+
+
+/* You already have something lit! */
+
+static gboolean parse_builtin_match_85 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 31)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 31
+		|| memcmp (p, "You already have something lit!", 31))
+		return FALSE;
+
+	p += 31;
+
+	return p == end;
+}
+
+
+/* Your {*} flickers and goes out. */
+
+static gboolean parse_builtin_match_86 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 28)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 5
+		|| memcmp (p, "Your ", 5))
+		return FALSE;
+
+	p += 5;
+
+	if (end - p < 23)
+		return FALSE;
+
+	n = end - p - 23;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 23
+		|| !(!memcmp (p, " flickers and goes out", 22)
+			&& p[22] != '\n'))
+		return FALSE;
+
+	p += 23;
+
+	return p == end;
+}
+
+
+/* MUD Internal Error - Please tell your sysop */
+
+static gboolean parse_builtin_match_87 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 43)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 43
+		|| memcmp (p, "MUD Internal Error - Please tell your sysop", 43))
+		return FALSE;
+
+	p += 43;
+
+	return p == end;
+}
+
+
+/* Sorry to interrupt, but the system will be shutting */
+
+static gboolean parse_builtin_match_88 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 51)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 51
+		|| memcmp (p, "Sorry to interrupt, but the system will be shutting", 51))
+		return FALSE;
+
+	p += 51;
+
+	return p == end;
+}
+
+
+/* Sorry to interrupt here, but the server will be shutting */
+
+static gboolean parse_builtin_match_89 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 56)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 56
+		|| memcmp (p, "Sorry to interrupt here, but the server will be shutting", 56))
+		return FALSE;
+
+	p += 56;
+
+	return p == end;
+}
+
+
+/* Your character has been saved. If you have any comments or suggestions, please */
+
+static gboolean parse_builtin_match_90 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 78)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 78
+		|| !(!memcmp (p, "Your character has been saved", 29)
+			&& p[29] != '\n'
+			&& !memcmp (p + 30, " If you have any comments or suggestions, please", 48)))
+		return FALSE;
+
+	p += 78;
+
+	return p == end;
+}
+
+
+/* You pull open the manhole cover, and slip inside the hole. */
+
+static gboolean parse_builtin_match_91 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 58)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 58
+		|| !(!memcmp (p, "You pull open the manhole cover, and slip inside the hole", 57)
+			&& p[57] != '\n'))
+		return FALSE;
+
+	p += 58;
+
+	return p == end;
+}
+
+
+/* You walk into the wide crack, and follow a path through the rock. */
+
+static gboolean parse_builtin_match_92 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 65)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 65
+		|| !(!memcmp (p, "You walk into the wide crack, and follow a path through the rock", 64)
+			&& p[64] != '\n'))
+		return FALSE;
+
+	p += 65;
+
+	return p == end;
+}
+
+
+/* You walk through the waterfall! */
+
+static gboolean parse_builtin_match_93 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 31)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 31
+		|| memcmp (p, "You walk through the waterfall!", 31))
+		return FALSE;
+
+	p += 31;
+
+	return p == end;
+}
+
+
+/* You squeeze through the narrow hole. */
+
+static gboolean parse_builtin_match_94 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 36)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 36
+		|| !(!memcmp (p, "You squeeze through the narrow hole", 35)
+			&& p[35] != '\n'))
+		return FALSE;
+
+	p += 36;
+
+	return p == end;
+}
+
+
+/* You move some rocks to the side. */
+
+static gboolean parse_builtin_match_95 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 32)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 32
+		|| !(!memcmp (p, "You move some rocks to the side", 31)
+			&& p[31] != '\n'))
+		return FALSE;
+
+	p += 32;
+
+	return p == end;
+}
+
+
+/* You push through the dense foliage, and walk onto a small path. */
+
+static gboolean parse_builtin_match_96 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 63)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 63
+		|| !(!memcmp (p, "You push through the dense foliage, and walk onto a small path", 62)
+			&& p[62] != '\n'))
+		return FALSE;
+
+	p += 63;
+
+	return p == end;
+}
+
+
+/* You clamber into the burnt stump. */
+
+static gboolean parse_builtin_match_97 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 33)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 33
+		|| !(!memcmp (p, "You clamber into the burnt stump", 32)
+			&& p[32] != '\n'))
+		return FALSE;
+
+	p += 33;
+
+	return p == end;
+}
+
+
+/* You climb into the pitch-dark hole. */
+
+static gboolean parse_builtin_match_98 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 35)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 35
+		|| !(!memcmp (p, "You climb into the pitch-dark hole", 34)
+			&& p[34] != '\n'))
+		return FALSE;
+
+	p += 35;
+
+	return p == end;
+}
+
+
+/* You climb into one of the skiffs, and row to Silvermere. */
+
+static gboolean parse_builtin_match_99 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 56)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 56
+		|| !(!memcmp (p, "You climb into one of the skiffs, and row to Silvermere", 55)
+			&& p[55] != '\n'))
+		return FALSE;
+
+	p += 56;
+
+	return p == end;
+}
+
+
+/* You jump into the large fountain. */
+
+static gboolean parse_builtin_match_100 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 33)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 33
+		|| !(!memcmp (p, "You jump into the large fountain", 32)
+			&& p[32] != '\n'))
+		return FALSE;
+
+	p += 33;
+
+	return p == end;
+}
+
+
+/* You wade through the salty water to the beach. */
+
+static gboolean parse_builtin_match_101 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 46)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 46
+		|| !(!memcmp (p, "You wade through the salty water to the beach", 45)
+			&& p[45] != '\n'))
+		return FALSE;
+
+	p += 46;
+
+	return p == end;
+}
+
+
+/* You wade through the salty water to the reef. */
+
+static gboolean parse_builtin_match_102 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 45)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 45
+		|| !(!memcmp (p, "You wade through the salty water to the reef", 44)
+			&& p[44] != '\n'))
+		return FALSE;
+
+	p += 45;
+
+	return p == end;
+}
+
+
+/* Dhelvanen closes his eyes, and concentrates silently, for a moment you can't */
+
+static gboolean parse_builtin_match_103 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 76)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 76
+		|| memcmp (p, "Dhelvanen closes his eyes, and concentrates silently, for a moment you can't", 76))
+		return FALSE;
+
+	p += 76;
+
+	return p == end;
+}
+
+
+/* You touch the crystal and your entire body freezes for a second! */
+
+static gboolean parse_builtin_match_104 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 64)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 64
+		|| memcmp (p, "You touch the crystal and your entire body freezes for a second!", 64))
+		return FALSE;
+
+	p += 64;
+
+	return p == end;
+}
+
+
+/* You begin to examine the book and begin to feel light headed. */
+
+static gboolean parse_builtin_match_105 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 61)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 61
+		|| !(!memcmp (p, "You begin to examine the book and begin to feel light headed", 60)
+			&& p[60] != '\n'))
+		return FALSE;
+
+	p += 61;
+
+	return p == end;
+}
+
+
+/* You rise through the air and pass through the barrier of water! */
+
+static gboolean parse_builtin_match_106 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 63)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 63
+		|| memcmp (p, "You rise through the air and pass through the barrier of water!", 63))
+		return FALSE;
+
+	p += 63;
+
+	return p == end;
+}
+
+
+/* You do not have a room ticket. */
+
+static gboolean parse_builtin_match_107 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 30)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 30
+		|| !(!memcmp (p, "You do not have a room ticket", 29)
+			&& p[29] != '\n'))
+		return FALSE;
+
+	p += 30;
+
+	return p == end;
+}
+
+
+/* You have progressed too far for this room. */
+
+static gboolean parse_builtin_match_108 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 42)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 42
+		|| !(!memcmp (p, "You have progressed too far for this room", 41)
+			&& p[41] != '\n'))
+		return FALSE;
+
+	p += 42;
+
+	return p == end;
+}
+
+
+/* You have progressed too far to go through this exit! */
+
+static gboolean parse_builtin_match_109 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 52)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 52
+		|| memcmp (p, "You have progressed too far to go through this exit!", 52))
+		return FALSE;
+
+	p += 52;
+
+	return p == end;
+}
+
+
+/* You walk into a shimmering wall! */
+
+static gboolean parse_builtin_match_110 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 32)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 32
+		|| memcmp (p, "You walk into a shimmering wall!", 32))
+		return FALSE;
+
+	p += 32;
+
+	return p == end;
+}
+
+
+/* There is no exit in that direction! */
+
+static gboolean parse_builtin_match_111 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 35)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 35
+		|| memcmp (p, "There is no exit in that direction!", 35))
+		return FALSE;
+
+	p += 35;
+
+	return p == end;
+}
+
+
+/* Your command had no effect. */
+
+static gboolean parse_builtin_match_112 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 27)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 27
+		|| !(!memcmp (p, "Your command had no effect", 26)
+			&& p[26] != '\n'))
+		return FALSE;
+
+	p += 27;
+
+	return p == end;
+}
+
+
+/* You fumble in confusion! */
+
+static gboolean parse_builtin_match_113 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 24)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 24
+		|| memcmp (p, "You fumble in confusion!", 24))
+		return FALSE;
+
+	p += 24;
+
+	return p == end;
+}
+
+
+/* There is a closed {*} in that direction! */
+
+static gboolean parse_builtin_match_114 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 37)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 18
+		|| memcmp (p, "There is a closed ", 18))
+		return FALSE;
+
+	p += 18;
+
+	if (end - p < 19)
+		return FALSE;
+
+	n = end - p - 19;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 19
+		|| memcmp (p, " in that direction!", 19))
+		return FALSE;
+
+	p += 19;
+
+	return p == end;
+}
+
+
+/* The room is pitch black - you can't see anything */
+
+static gboolean parse_builtin_match_115 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 48)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 48
+		|| memcmp (p, "The room is pitch black - you can't see anything", 48))
+		return FALSE;
+
+	p += 48;
+
+	return p == end;
+}
+
+
+/* The room is very dark - you can't see anything */
+
+static gboolean parse_builtin_match_116 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 46)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 46
+		|| memcmp (p, "The room is very dark - you can't see anything", 46))
+		return FALSE;
+
+	p += 46;
+
+	return p == end;
+}
+
+
+/* The room is pitch black - you can't see anything */
+
+static gboolean parse_builtin_match_117 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 48)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 48
+		|| memcmp (p, "The room is pitch black - you can't see anything", 48))
+		return FALSE;
+
+	p += 48;
+
+	return p == end;
+}
+
+
+/* The room is very dark - you can't see anything */
+
+static gboolean parse_builtin_match_118 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 46)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 46
+		|| memcmp (p, "The room is very dark - you can't see anything", 46))
+		return FALSE;
+
+	p += 46;
+
+	return p == end;
+}
+
+
+/* You are blind. */
+
+static gboolean parse_builtin_match_119 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 14)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 14
+		|| !(!memcmp (p, "You are blind", 13)
+			&& p[13] != '\n'))
+		return FALSE;
+
+	p += 14;
+
+	return p == end;
+}
+
+
+/* You successfully unlocked the {*}. */
+
+static gboolean parse_builtin_match_120 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 31)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 30
+		|| memcmp (p, "You successfully unlocked the ", 30))
+		return FALSE;
+
+	p += 30;
+
+	if (end - p < 1)
+		return FALSE;
+
+	n = end - p - 1;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 1
+		|| p[0] == '\n')
+		return FALSE;
+
+	p += 1;
+
+	return p == end;
+}
+
+
+/* The {*} was not locked. */
+
+static gboolean parse_builtin_match_121 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 20)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 4
+		|| memcmp (p, "The ", 4))
+		return FALSE;
+
+	p += 4;
+
+	if (end - p < 16)
+		return FALSE;
+
+	n = end - p - 16;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 16
+		|| !(!memcmp (p, " was not locked", 15)
+			&& p[15] != '\n'))
+		return FALSE;
+
+	p += 16;
+
+	return p == end;
+}
+
+
+/* You bashed the {*} open. */
+
+static gboolean parse_builtin_match_122 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 21)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 15
+		|| memcmp (p, "You bashed the ", 15))
+		return FALSE;
+
+	p += 15;
+
+	if (end - p < 6)
+		return FALSE;
+
+	n = end - p - 6;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 6
+		|| !(!memcmp (p, " open", 5)
+			&& p[5] != '\n'))
+		return FALSE;
+
+	p += 6;
+
+	return p == end;
+}
+
+
+/* The {*} is now open. */
+
+static gboolean parse_builtin_match_123 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 17)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 4
+		|| memcmp (p, "The ", 4))
+		return FALSE;
+
+	p += 4;
+
+	if (end - p < 13)
+		return FALSE;
+
+	n = end - p - 13;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 13
+		|| !(!memcmp (p, " is now open", 12)
+			&& p[12] != '\n'))
+		return FALSE;
+
+	p += 13;
+
+	return p == end;
+}
+
+
+/* Your attempts to bash through fail! */
+
+static gboolean parse_builtin_match_124 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 35)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 35
+		|| memcmp (p, "Your attempts to bash through fail!", 35))
+		return FALSE;
+
+	p += 35;
+
+	return p == end;
+}
+
+
+/* Your skill fails you this time. */
+
+static gboolean parse_builtin_match_125 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 31)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 31
+		|| !(!memcmp (p, "Your skill fails you this time", 30)
+			&& p[30] != '\n'))
+		return FALSE;
+
+	p += 31;
+
+	return p == end;
+}
+
+
+/* The {*} is locked. */
+
+static gboolean parse_builtin_match_126 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 15)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 4
+		|| memcmp (p, "The ", 4))
+		return FALSE;
+
+	p += 4;
+
+	if (end - p < 11)
+		return FALSE;
+
+	n = end - p - 11;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 11
+		|| !(!memcmp (p, " is locked", 10)
+			&& p[10] != '\n'))
+		return FALSE;
+
+	p += 11;
+
+	return p == end;
+}
+
+
+/* ........ {1} {2} +\-  {3}{*} */
+
+static gboolean parse_builtin_match_127_1 (const gchar *subject, const gchar *p,
+	const gchar *end, PCRE2_SIZE *ovector)
+{
+	const gchar *q;
+	gsize n;
+
+	n = end - p;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[8] = p - subject;
+	ovector[9] = p + n - subject;
+	p += n;
+
+	return p == end;
+}
+
+static gboolean parse_builtin_match_127 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	gsize n;
+
+	if (length < 17)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 9
+		|| !(p[0] != '\n'
+			&& p[1] != '\n'
+			&& p[2] != '\n'
+			&& p[3] != '\n'
+			&& p[4] != '\n'
+			&& p[5] != '\n'
+			&& p[6] != '\n'
+			&& p[7] != '\n'
+			&& p[8] == ' '))
+		return FALSE;
+
+	p += 9;
+
+	for (n = 0; p + n < end && !PARSE_BUILTIN_SPACE (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 1
+		|| p[0] != ' ')
+		return FALSE;
+
+	p += 1;
+
+	for (n = 0; p + n < end && !PARSE_BUILTIN_SPACE (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[4] = p - subject;
+	ovector[5] = p + n - subject;
+	p += n;
+
+	for (n = 0; p + n < end && p[n] == ' '; n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	p += n;
+
+	if (end - p < 3
+		|| memcmp (p, "-  ", 3))
+		return FALSE;
+
+	p += 3;
+
+	for (n = 0; p + n < end && !PARSE_BUILTIN_SPACE (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[6] = p - subject;
+
+	for (;; n--)
+	{
+		ovector[7] = p + n - subject;
+
+		if (parse_builtin_match_127_1 (subject, p + n, end, ovector))
+			return TRUE;
+
+		if (n == 1)
+			return FALSE;
+	}
+}
+
+
+/* ............... {1} {2} +.......... .................... */
+
+static gboolean parse_builtin_match_128 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 51)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 16
+		|| !(p[0] != '\n'
+			&& p[1] != '\n'
+			&& p[2] != '\n'
+			&& p[3] != '\n'
+			&& p[4] != '\n'
+			&& p[5] != '\n'
+			&& p[6] != '\n'
+			&& p[7] != '\n'
+			&& p[8] != '\n'
+			&& p[9] != '\n'
+			&& p[10] != '\n'
+			&& p[11] != '\n'
+			&& p[12] != '\n'
+			&& p[13] != '\n'
+			&& p[14] != '\n'
+			&& p[15] == ' '))
+		return FALSE;
+
+	p += 16;
+
+	for (n = 0; p + n < end && !PARSE_BUILTIN_SPACE (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 1
+		|| p[0] != ' ')
+		return FALSE;
+
+	p += 1;
+
+	for (n = 0; p + n < end && !PARSE_BUILTIN_SPACE (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[4] = p - subject;
+	ovector[5] = p + n - subject;
+	p += n;
+
+	if (end - p < 32)
+		return FALSE;
+
+	n = end - p - 31;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q != ' ')
+			return FALSE;
+	}
+
+	p += n;
+
+	if (end - p < 31
+		|| !(p[0] != '\n'
+			&& p[1] != '\n'
+			&& p[2] != '\n'
+			&& p[3] != '\n'
+			&& p[4] != '\n'
+			&& p[5] != '\n'
+			&& p[6] != '\n'
+			&& p[7] != '\n'
+			&& p[8] != '\n'
+			&& p[9] != '\n'
+			&& p[10] == ' '
+			&& p[11] != '\n'
+			&& p[12] != '\n'
+			&& p[13] != '\n'
+			&& p[14] != '\n'
+			&& p[15] != '\n'
+			&& p[16] != '\n'
+			&& p[17] != '\n'
+			&& p[18] != '\n'
+			&& p[19] != '\n'
+			&& p[20] != '\n'
+			&& p[21] != '\n'
+			&& p[22] != '\n'
+			&& p[23] != '\n'
+			&& p[24] != '\n'
+			&& p[25] != '\n'
+			&& p[26] != '\n'
+			&& p[27] != '\n'
+			&& p[28] != '\n'
+			&& p[29] != '\n'
+			&& p[30] != '\n'))
+		return FALSE;
+
+	p += 31;
+
+	return p == end;
+}
+
+
+/* {player} just entered the Realm. */
+
+static gboolean parse_builtin_match_129 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 25)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 25)
+		return FALSE;
+
+	n = end - p - 24;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (!PARSE_BUILTIN_WORD (*q))
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 24
+		|| !(!memcmp (p, " just entered the Realm", 23)
+			&& p[23] != '\n'))
+		return FALSE;
+
+	p += 24;
+
+	return p == end;
+}
+
+
+/* {player} just left the Realm. */
+
+static gboolean parse_builtin_match_130 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 22)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 22)
+		return FALSE;
+
+	n = end - p - 21;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (!PARSE_BUILTIN_WORD (*q))
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 21
+		|| !(!memcmp (p, " just left the Realm", 20)
+			&& p[20] != '\n'))
+		return FALSE;
+
+	p += 21;
+
+	return p == end;
+}
+
+
+/* {player} just hung up!!! */
+
+static gboolean parse_builtin_match_131 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 17)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 17)
+		return FALSE;
+
+	n = end - p - 16;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (!PARSE_BUILTIN_WORD (*q))
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 16
+		|| memcmp (p, " just hung up!!!", 16))
+		return FALSE;
+
+	p += 16;
+
+	return p == end;
+}
+
+
+/* {player} just disconnected!!! */
+
+static gboolean parse_builtin_match_132 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 22)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 22)
+		return FALSE;
+
+	n = end - p - 21;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (!PARSE_BUILTIN_WORD (*q))
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 21
+		|| memcmp (p, " just disconnected!!!", 21))
+		return FALSE;
+
+	p += 21;
+
+	return p == end;
+}
+
+
+/* You are now following {player} */
+
+static gboolean parse_builtin_match_133 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 23)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 22
+		|| memcmp (p, "You are now following ", 22))
+		return FALSE;
+
+	p += 22;
+
+	if (end - p < 1)
+		return FALSE;
+
+	n = end - p;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (!PARSE_BUILTIN_WORD (*q))
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	return p == end;
+}
+
+
+/* You are no longer following {player}. */
+
+static gboolean parse_builtin_match_134 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 30)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 28
+		|| memcmp (p, "You are no longer following ", 28))
+		return FALSE;
+
+	p += 28;
+
+	if (end - p < 2)
+		return FALSE;
+
+	n = end - p - 1;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (!PARSE_BUILTIN_WORD (*q))
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 1
+		|| p[0] == '\n')
+		return FALSE;
+
+	p += 1;
+
+	return p == end;
+}
+
+
+/* You have invited {player} to follow you. */
+
+static gboolean parse_builtin_match_135 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 33)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 17
+		|| memcmp (p, "You have invited ", 17))
+		return FALSE;
+
+	p += 17;
+
+	if (end - p < 16)
+		return FALSE;
+
+	n = end - p - 15;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (!PARSE_BUILTIN_WORD (*q))
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 15
+		|| !(!memcmp (p, " to follow you", 14)
+			&& p[14] != '\n'))
+		return FALSE;
+
+	p += 15;
+
+	return p == end;
+}
+
+
+/* {player} started to follow you. */
+
+static gboolean parse_builtin_match_136 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 24)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 24)
+		return FALSE;
+
+	n = end - p - 23;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (!PARSE_BUILTIN_WORD (*q))
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 23
+		|| !(!memcmp (p, " started to follow you", 22)
+			&& p[22] != '\n'))
+		return FALSE;
+
+	p += 23;
+
+	return p == end;
+}
+
+
+/* {player} has been removed from your followers. */
+
+static gboolean parse_builtin_match_137 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 39)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 39)
+		return FALSE;
+
+	n = end - p - 38;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (!PARSE_BUILTIN_WORD (*q))
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 38
+		|| !(!memcmp (p, " has been removed from your followers", 37)
+			&& p[37] != '\n'))
+		return FALSE;
+
+	p += 38;
+
+	return p == end;
+}
+
+
+/* {player} gossips: {*} */
+
+static gboolean parse_builtin_match_138 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 11)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	for (n = 0; p + n < end && PARSE_BUILTIN_WORD (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 10
+		|| memcmp (p, " gossips: ", 10))
+		return FALSE;
+
+	p += 10;
+
+	n = end - p;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[4] = p - subject;
+	ovector[5] = p + n - subject;
+	p += n;
+
+	return p == end;
+}
+
+
+/* {player} auctions: {*} */
+
+static gboolean parse_builtin_match_139 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 12)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	for (n = 0; p + n < end && PARSE_BUILTIN_WORD (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 11
+		|| memcmp (p, " auctions: ", 11))
+		return FALSE;
+
+	p += 11;
+
+	n = end - p;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[4] = p - subject;
+	ovector[5] = p + n - subject;
+	p += n;
+
+	return p == end;
+}
+
+
+/* {player} gangpaths: {*} */
+
+static gboolean parse_builtin_match_140 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 13)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	for (n = 0; p + n < end && PARSE_BUILTIN_WORD (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 12
+		|| memcmp (p, " gangpaths: ", 12))
+		return FALSE;
+
+	p += 12;
+
+	n = end - p;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[4] = p - subject;
+	ovector[5] = p + n - subject;
+	p += n;
+
+	return p == end;
+}
+
+
+/* {player} telepaths: {*} */
+
+static gboolean parse_builtin_match_141 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 13)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	for (n = 0; p + n < end && PARSE_BUILTIN_WORD (p[n]); n++)
+		;
+
+	if (n < 1)
+		return FALSE;
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 12
+		|| memcmp (p, " telepaths: ", 12))
+		return FALSE;
+
+	p += 12;
+
+	n = end - p;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[4] = p - subject;
+	ovector[5] = p + n - subject;
+	p += n;
+
+	return p == end;
+}
+
+
+/* You push some rocks to the side and opening gaping hole! */
+
+static gboolean parse_builtin_match_142 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 56)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 56
+		|| memcmp (p, "You push some rocks to the side and opening gaping hole!", 56))
+		return FALSE;
+
+	p += 56;
+
+	return p == end;
+}
+
+
+/* A secret trapdoor is uncovered from under the sand! */
+
+static gboolean parse_builtin_match_143 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 51)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 51
+		|| memcmp (p, "A secret trapdoor is uncovered from under the sand!", 51))
+		return FALSE;
+
+	p += 51;
+
+	return p == end;
+}
+
+
+/* A hidden panel in the fireplace slides open. */
+
+static gboolean parse_builtin_match_144 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 44)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 44
+		|| !(!memcmp (p, "A hidden panel in the fireplace slides open", 43)
+			&& p[43] != '\n'))
+		return FALSE;
+
+	p += 44;
+
+	return p == end;
+}
+
+
+/* As you push the hidden stone, you hear a slight click! */
+
+static gboolean parse_builtin_match_145 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 54)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 54
+		|| memcmp (p, "As you push the hidden stone, you hear a slight click!", 54))
+		return FALSE;
+
+	p += 54;
+
+	return p == end;
+}
+
+
+/* As you push the hidden stone, you hear a slight click! */
+
+static gboolean parse_builtin_match_146 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 54)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 54
+		|| memcmp (p, "As you push the hidden stone, you hear a slight click!", 54))
+		return FALSE;
+
+	p += 54;
+
+	return p == end;
+}
+
+
+/* You push some rocks to the side and opening gaping hole! */
+
+static gboolean parse_builtin_match_147 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 56)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 56
+		|| memcmp (p, "You push some rocks to the side and opening gaping hole!", 56))
+		return FALSE;
+
+	p += 56;
+
+	return p == end;
+}
+
+
+/* You say the word .Faith. out loud. */
+
+static gboolean parse_builtin_match_148 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 34)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 34
+		|| !(!memcmp (p, "You say the word ", 17)
+			&& p[17] != '\n'
+			&& !memcmp (p + 18, "Faith", 5)
+			&& p[23] != '\n'
+			&& !memcmp (p + 24, " out loud", 9)
+			&& p[33] != '\n'))
+		return FALSE;
+
+	p += 34;
+
+	return p == end;
+}
+
+
+/* A cleverly concealed passage opens! */
+
+static gboolean parse_builtin_match_149 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 35)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 35
+		|| memcmp (p, "A cleverly concealed passage opens!", 35))
+		return FALSE;
+
+	p += 35;
+
+	return p == end;
+}
+
+
+/* A groaning crack in the darkwood tree yawns open! */
+
+static gboolean parse_builtin_match_150 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 49)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 49
+		|| memcmp (p, "A groaning crack in the darkwood tree yawns open!", 49))
+		return FALSE;
+
+	p += 49;
+
+	return p == end;
+}
+
+
+/* A groaning crack in the darkwood tree yawns open! */
+
+static gboolean parse_builtin_match_151 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 49)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 49
+		|| memcmp (p, "A groaning crack in the darkwood tree yawns open!", 49))
+		return FALSE;
+
+	p += 49;
+
+	return p == end;
+}
+
+
+/* A small hidden passage silently slides open. */
+
+static gboolean parse_builtin_match_152 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 44)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 44
+		|| !(!memcmp (p, "A small hidden passage silently slides open", 43)
+			&& p[43] != '\n'))
+		return FALSE;
+
+	p += 44;
+
+	return p == end;
+}
+
+
+/* A small hidden passage silently slides open. */
+
+static gboolean parse_builtin_match_153 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 44)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 44
+		|| !(!memcmp (p, "A small hidden passage silently slides open", 43)
+			&& p[43] != '\n'))
+		return FALSE;
+
+	p += 44;
+
+	return p == end;
+}
+
+
+/* You pull the switch and the bookcase moves aside. */
+
+static gboolean parse_builtin_match_154 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 49)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 49
+		|| !(!memcmp (p, "You pull the switch and the bookcase moves aside", 48)
+			&& p[48] != '\n'))
+		return FALSE;
+
+	p += 49;
+
+	return p == end;
+}
+
+
+/* The knight statue slides aside, revealing a small passage. */
+
+static gboolean parse_builtin_match_155 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 58)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 58
+		|| !(!memcmp (p, "The knight statue slides aside, revealing a small passage", 57)
+			&& p[57] != '\n'))
+		return FALSE;
+
+	p += 58;
+
+	return p == end;
+}
+
+
+/* You push the switch, and you hear a loud grinding noise! */
+
+static gboolean parse_builtin_match_156 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 56)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 56
+		|| memcmp (p, "You push the switch, and you hear a loud grinding noise!", 56))
+		return FALSE;
+
+	p += 56;
+
+	return p == end;
+}
+
+
+/* You twist the opal stone! */
+
+static gboolean parse_builtin_match_157 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 25)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 25
+		|| memcmp (p, "You twist the opal stone!", 25))
+		return FALSE;
+
+	p += 25;
+
+	return p == end;
+}
+
+
+/* You pull the lever. */
+
+static gboolean parse_builtin_match_158 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 19)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 19
+		|| !(!memcmp (p, "You pull the lever", 18)
+			&& p[18] != '\n'))
+		return FALSE;
+
+	p += 19;
+
+	return p == end;
+}
+
+
+/* Meditation will not help at this time. */
+
+static gboolean parse_builtin_match_159 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 38)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 38
+		|| !(!memcmp (p, "Meditation will not help at this time", 37)
+			&& p[37] != '\n'))
+		return FALSE;
+
+	p += 38;
+
+	return p == end;
+}
+
+
+/* You awake from deep meditation feeling stronger! */
+
+static gboolean parse_builtin_match_160 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 48)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 48
+		|| memcmp (p, "You awake from deep meditation feeling stronger!", 48))
+		return FALSE;
+
+	p += 48;
+
+	return p == end;
+}
+
+
+/* You are too sick to meditate! */
+
+static gboolean parse_builtin_match_161 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 29)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 29
+		|| memcmp (p, "You are too sick to meditate!", 29))
+		return FALSE;
+
+	p += 29;
+
+	return p == end;
+}
+
+
+/* You are now meditating. */
+
+static gboolean parse_builtin_match_162 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 23)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 23
+		|| !(!memcmp (p, "You are now meditating", 22)
+			&& p[22] != '\n'))
+		return FALSE;
+
+	p += 23;
+
+	return p == end;
+}
+
+
+/* You are now resting. */
+
+static gboolean parse_builtin_match_163 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 20)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 20
+		|| !(!memcmp (p, "You are now resting", 19)
+			&& p[19] != '\n'))
+		return FALSE;
+
+	p += 20;
+
+	return p == end;
+}
+
+
+/* You will exit after a period of silent meditation. */
+
+static gboolean parse_builtin_match_164 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 50)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 50
+		|| !(!memcmp (p, "You will exit after a period of silent meditation", 49)
+			&& p[49] != '\n'))
+		return FALSE;
+
+	p += 50;
+
+	return p == end;
+}
+
+
+/* {*}Your meditation has been interrupted - you may not exit now! */
+
+static gboolean parse_builtin_match_165 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 60)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 60)
+		return FALSE;
+
+	n = end - p - 60;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 60
+		|| memcmp (p, "Your meditation has been interrupted - you may not exit now!", 60))
+		return FALSE;
+
+	p += 60;
+
+	return p == end;
+}
+
+
+/* Attempting to sneak... */
+
+static gboolean parse_builtin_match_166 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 22)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 22
+		|| !(!memcmp (p, "Attempting to sneak", 19)
+			&& p[19] != '\n'
+			&& p[20] != '\n'
+			&& p[21] != '\n'))
+		return FALSE;
+
+	p += 22;
+
+	return p == end;
+}
+
+
+/* Attempting to sneak...You don't think you're sneaking. */
+
+static gboolean parse_builtin_match_167 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 54)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 54
+		|| !(!memcmp (p, "Attempting to sneak", 19)
+			&& p[19] != '\n'
+			&& p[20] != '\n'
+			&& p[21] != '\n'
+			&& !memcmp (p + 22, "You don't think you're sneaking", 31)
+			&& p[53] != '\n'))
+		return FALSE;
+
+	p += 54;
+
+	return p == end;
+}
+
+
+/* You may not sneak right now! */
+
+static gboolean parse_builtin_match_168 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 28)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 28
+		|| memcmp (p, "You may not sneak right now!", 28))
+		return FALSE;
+
+	p += 28;
+
+	return p == end;
+}
+
+
+/* Sneaking... */
+
+static gboolean parse_builtin_match_169 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 11)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 11
+		|| !(!memcmp (p, "Sneaking", 8)
+			&& p[8] != '\n'
+			&& p[9] != '\n'
+			&& p[10] != '\n'))
+		return FALSE;
+
+	p += 11;
+
+	return p == end;
+}
+
+
+/* You make a sound as you enter the room! */
+
+static gboolean parse_builtin_match_170 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 39)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 39
+		|| memcmp (p, "You make a sound as you enter the room!", 39))
+		return FALSE;
+
+	p += 39;
+
+	return p == end;
+}
+
+
+/* You are no longer sneaking. */
+
+static gboolean parse_builtin_match_171 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 27)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 27
+		|| !(!memcmp (p, "You are no longer sneaking", 26)
+			&& p[26] != '\n'))
+		return FALSE;
+
+	p += 27;
+
+	return p == end;
+}
+
+
+/* The effects of confusion wear off! */
+
+static gboolean parse_builtin_match_172 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 34)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 34
+		|| memcmp (p, "The effects of confusion wear off!", 34))
+		return FALSE;
+
+	p += 34;
+
+	return p == end;
+}
+
+
+/* The effects of the death dog's shriek wear off! */
+
+static gboolean parse_builtin_match_173 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 47)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 47
+		|| memcmp (p, "The effects of the death dog's shriek wear off!", 47))
+		return FALSE;
+
+	p += 47;
+
+	return p == end;
+}
+
+
+/* The effects of the poison wear off! */
+
+static gboolean parse_builtin_match_174 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 35)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 35
+		|| memcmp (p, "The effects of the poison wear off!", 35))
+		return FALSE;
+
+	p += 35;
+
+	return p == end;
+}
+
+
+/* You can see again! */
+
+static gboolean parse_builtin_match_175 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 18)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 18
+		|| memcmp (p, "You can see again!", 18))
+		return FALSE;
+
+	p += 18;
+
+	return p == end;
+}
+
+
+/* The unnatural darkness lifts. */
+
+static gboolean parse_builtin_match_176 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 29)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 29
+		|| !(!memcmp (p, "The unnatural darkness lifts", 28)
+			&& p[28] != '\n'))
+		return FALSE;
+
+	p += 29;
+
+	return p == end;
+}
+
+
+/* Your vision returns to normal. */
+
+static gboolean parse_builtin_match_177 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 30)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 30
+		|| !(!memcmp (p, "Your vision returns to normal", 29)
+			&& p[29] != '\n'))
+		return FALSE;
+
+	p += 30;
+
+	return p == end;
+}
+
+
+/* The effects of the mummy's breath wears off! */
+
+static gboolean parse_builtin_match_178 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 44)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 44
+		|| memcmp (p, "The effects of the mummy's breath wears off!", 44))
+		return FALSE;
+
+	p += 44;
+
+	return p == end;
+}
+
+
+/* You are confused! */
+
+static gboolean parse_builtin_match_179 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 17)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 17
+		|| memcmp (p, "You are confused!", 17))
+		return FALSE;
+
+	p += 17;
+
+	return p == end;
+}
+
+
+/* You feel confused! */
+
+static gboolean parse_builtin_match_180 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 18)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 18
+		|| memcmp (p, "You feel confused!", 18))
+		return FALSE;
+
+	p += 18;
+
+	return p == end;
+}
+
+
+/* {*} casts blind on you! */
+
+static gboolean parse_builtin_match_181 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+	const gchar *q;
+	gsize n;
+
+	if (length < 20)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 20)
+		return FALSE;
+
+	n = end - p - 20;
+
+	for (q = p; q < p + n; q++)
+	{
+		if (*q == '\n')
+			return FALSE;
+	}
+
+	ovector[2] = p - subject;
+	ovector[3] = p + n - subject;
+	p += n;
+
+	if (end - p < 20
+		|| memcmp (p, " casts blind on you!", 20))
+		return FALSE;
+
+	p += 20;
+
+	return p == end;
+}
+
+
+/* The large mummy breathes on you! */
+
+static gboolean parse_builtin_match_182 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 32)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 32
+		|| memcmp (p, "The large mummy breathes on you!", 32))
+		return FALSE;
+
+	p += 32;
+
+	return p == end;
+}
+
+
+/* A black curse is upon you! */
+
+static gboolean parse_builtin_match_183 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 26)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 26
+		|| memcmp (p, "A black curse is upon you!", 26))
+		return FALSE;
+
+	p += 26;
+
+	return p == end;
+}
+
+
+/* You are enveloped in darkness! */
+
+static gboolean parse_builtin_match_184 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 30)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 30
+		|| memcmp (p, "You are enveloped in darkness!", 30))
+		return FALSE;
+
+	p += 30;
+
+	return p == end;
+}
+
+
+/* You are blind. */
+
+static gboolean parse_builtin_match_185 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 14)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 14
+		|| !(!memcmp (p, "You are blind", 13)
+			&& p[13] != '\n'))
+		return FALSE;
+
+	p += 14;
+
+	return p == end;
+}
+
+
+/* Poison burns through your veins! */
+
+static gboolean parse_builtin_match_186 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 32)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 32
+		|| memcmp (p, "Poison burns through your veins!", 32))
+		return FALSE;
+
+	p += 32;
+
+	return p == end;
+}
+
+
+/* You feel ill. */
+
+static gboolean parse_builtin_match_187 (const gchar *subject, gsize length,
+	PCRE2_SIZE *ovector)
+{
+	const gchar *p = subject, *end = subject + length;
+
+	if (length != 13)
+		return FALSE;
+
+	ovector[0] = 0;
+	ovector[1] = length;
+
+	if (end - p < 13
+		|| !(!memcmp (p, "You feel ill", 12)
+			&& p[12] != '\n'))
+		return FALSE;
+
+	p += 13;
+
+	return p == end;
+}
+
+
+static const parse_builtin_regexp_t parse_builtin_db_0[] = {
+	{ "\\[HP=([^/]+)\\]:",
+		parse_builtin_match_0, 1 },
+	{ "\\[HP={1}/(MA|KAI)={2}\\]:",
+		NULL, 0 },
+	{ "Health: +{1}/{2} +\\[{3}%\\] +(Mana|Kai): +{4}/{5} +\\[{6}%\\]",
+		NULL, 0 },
+	{ "Health: +{1}/{2} +\\[{3}%\\]",
+		parse_builtin_match_1, 3 },
+	{ "Exp: {1} Level: {2} Exp needed for next level: {3} \\({4}\\) \\[{5}%\\]",
+		parse_builtin_match_2, 5 },
+	{ "You gain {#} experience.",
+		parse_builtin_match_3, 1 },
+	{ "Name: {1} {2} +Lives/CP: +{3}/{4}{*}",
+		parse_builtin_match_4, 5 },
+	{ "Race: {1} +Exp: {2} +Perception: +{3}",
+		parse_builtin_match_5, 3 },
+	{ "Class: {1} +Level: {2} +Stealth: +{3}",
+		parse_builtin_match_6, 3 },
+	{ "Hits: +{1}/{2} +Armour Class: +{3}/{4} +Thievery: +{5}",
+		parse_builtin_match_7, 5 },
+	{ "Mana: +{1}/{2} +Spellcasting: {3} +Traps: +{4}",
+		parse_builtin_match_8, 4 },
+	{ "Kai: +{1}/{2} +Traps: +{3}",
+		parse_builtin_match_9, 3 },
+	{ " +Traps: +{1}",
+		parse_builtin_match_10, 1 },
+	{ " +Picklocks: +{1}",
+		parse_builtin_match_11, 1 },
+	{ "Strength: +\\**{1} +Agility: +\\**{2} +Tracking: +{3}",
+		parse_builtin_match_12, 3 },
+	{ "Intellect: +\\**{1} +Health: +\\**{2} +Martial Arts: +{3}",
+		parse_builtin_match_13, 3 },
+	{ "Willpower: +\\**{1} +Charm: +\\**{2} +MagicRes: +{3}",
+		parse_builtin_match_14, 3 },
+	{ "The following people are in your travel party:",
+		parse_builtin_match_15, 0 },
+	{ "  {1} {2} +.\\w+. +\\[M: ?{3}%\\] \\[H: ?{4}%\\]...- \\w+",
+		parse_builtin_match_16, 4 },
+	{ "  {1} {2} +.\\w+. +\\[H: ?{3}%\\]...- \\w+",
+		parse_builtin_match_17, 3 },
+	{ "sea(rch)?",
+		NULL, 0 },
+	{ "Your search revealed nothing.",
+		parse_builtin_match_18, 0 },
+	{ "l(ook)? +{direction}",
+		NULL, 0 },
+	{ "Obvious exits: {*}",
+		parse_builtin_match_19, 1 },
+	{ NULL, NULL, 0 }
+};
+
+static const parse_builtin_regexp_t parse_builtin_db_1[] = {
+	{ "A horde of shrieking spirits ravages your foe for {#} damage!",
+		parse_builtin_match_20, 1 },
+	{ "Dancing blades slice the foe for {#} damage!",
+		parse_builtin_match_21, 1 },
+	{ "The fireball explodes, causing {#} damage!",
+		parse_builtin_match_22, 1 },
+	{ "A withering blast of dragonfire sears {monster} for {#} damage!",
+		parse_builtin_match_23, 2 },
+	{ "You fire {*} at {monster} for {#} damage!",
+		parse_builtin_match_24, 3 },
+	{ "Your {*} strikes {monster} for {#} damage!",
+		parse_builtin_match_25, 3 },
+	{ "You {hit} {monster} for {#} damage!",
+		NULL, 0 },
+	{ "You critically {hit} {monster} for {#} damage!",
+		NULL, 0 },
+	{ "You surprise {hit} {monster} for {#} damage!",
+		NULL, 0 },
+	{ "You {miss} {monster}!",
+		NULL, 0 },
+	{ "You attempt to cast {*}, but fail.",
+		parse_builtin_match_26, 1 },
+	{ "{player} moves to attack {monster}.",
+		parse_builtin_match_27, 2 },
+	{ "The {monster} {hits} you for {#} damage!",
+		NULL, 0 },
+	{ "The {monster} {hits} you with its {*} for {#} damage!",
+		NULL, 0 },
+	{ "The {monster} all-out {hits} you for {#} damage!",
+		NULL, 0 },
+	{ "The {monster} fires {*} at you for {#} damage!",
+		parse_builtin_match_28, 3 },
+	{ "The {monster} casts {*} on you for {#} damage!",
+		parse_builtin_match_29, 3 },
+	{ "The {monster} {hits} you with {*} for {#} damage!",
+		NULL, 0 },
+	{ "The {monster} touches you with a ghostly hand for {#} damage!",
+		parse_builtin_match_30, 2 },
+	{ "The {monster} draws the breath from your body for {#} damage!",
+		parse_builtin_match_31, 2 },
+	{ "The {monster} sprays the area with thorns for {#} damage!",
+		parse_builtin_match_32, 2 },
+	{ "The {monster} breathes its ice breath on you for {#} damage!",
+		parse_builtin_match_33, 2 },
+	{ "The {monster} {misses} you, but your armour deflects the blow!",
+		NULL, 0 },
+	{ "The {monster} {misses} you, but you dodge!",
+		NULL, 0 },
+	{ "The {monster} {misses} you with their {*}!",
+		NULL, 0 },
+	{ "The {monster} {misses} you with its {*}",
+		NULL, 0 },
+	{ "The {monster} {misses} you, but you dodge out of the way!",
+		NULL, 0 },
+	{ "The {monster} {misses} you!",
+		NULL, 0 },
+	{ "{monster} draws the breath from your body for {#} damage!",
+		parse_builtin_match_34, 2 },
+	{ "{monster} fires {*} at you for {#} damage!",
+		parse_builtin_match_35, 3 },
+	{ "{monster} {enters} in from the {*}.",
+		NULL, 0 },
+	{ "{monster} {enters} into the room from {*}.",
+		NULL, 0 },
+	{ "{monster} {enters} into the room.",
+		NULL, 0 },
+	{ "{monster} {enters} in the room from {*}.",
+		NULL, 0 },
+	{ "{monster} {enters} right beside you!",
+		NULL, 0 },
+	{ "The {monster} just left to the {direction}.",
+		NULL, 0 },
+	{ "{monster} just left to the {direction}.",
+		NULL, 0 },
+	{ "{monster} moves to protect {*}.",
+		parse_builtin_match_36, 2 },
+	{ NULL, NULL, 0 }
+};
+
+static const parse_builtin_regexp_t parse_builtin_db_2[] = {
+	{ "You notice nothing different to the {direction}.",
+		NULL, 0 },
+	{ "You cast {*}.",
+		parse_builtin_match_37, 1 },
+	{ "You draw {*}!",
+		parse_builtin_match_38, 1 },
+	{ "You invoke {*}.",
+		parse_builtin_match_39, 1 },
+	{ "You feel strange for a moment.",
+		parse_builtin_match_40, 0 },
+	{ "You attempt to cast {*}, but fail.",
+		parse_builtin_match_41, 1 },
+	{ "You have already cast a spell this round!",
+		parse_builtin_match_42, 0 },
+	{ "You do not have enough mana to cast that spell.",
+		parse_builtin_match_43, 0 },
+	{ "Why would you want to cast a spell on that?",
+		parse_builtin_match_44, 0 },
+	{ "You may not cast that spell on an item!",
+		parse_builtin_match_45, 0 },
+	{ "Your spell has no effect in this room!",
+		parse_builtin_match_46, 0 },
+	{ "You do not see {*} here!",
+		parse_builtin_match_47, 1 },
+	{ "You don't see that anywhere!",
+		parse_builtin_match_48, 0 },
+	{ "You are not carrying {*}",
+		parse_builtin_match_49, 1 },
+	{ "Your spell has no effect in this room!",
+		parse_builtin_match_50, 0 },
+	{ "{player} gangpaths: {*}",
+		parse_builtin_match_51, 2 },
+	{ "You say .{*}.",
+		parse_builtin_match_52, 1 },
+	{ "You say .{*}.",
+		parse_builtin_match_53, 1 },
+	{ "You yell .{*}.",
+		parse_builtin_match_54, 1 },
+	{ "--- Message Directed to {player} ---",
+		parse_builtin_match_55, 1 },
+	{ "--- Telepath Sent to {player} ---",
+		parse_builtin_match_56, 1 },
+	{ "You have to telepath something!",
+		parse_builtin_match_57, 0 },
+	{ "Cannot find user!",
+		parse_builtin_match_58, 0 },
+	{ "Why are you telepathing to yourself?",
+		parse_builtin_match_59, 0 },
+	{ "You must be invited first!",
+		parse_builtin_match_60, 0 },
+	{ "You have moved to the {*} ranks of your group.",
+		parse_builtin_match_61, 1 },
+	{ NULL, NULL, 0 }
+};
+
+static const parse_builtin_regexp_t parse_builtin_db_3[] = {
+	{ NULL, NULL, 0 }
+};
+
+static const parse_builtin_regexp_t parse_builtin_db_4[] = {
+	{ "You deposit {*}",
+		parse_builtin_match_62, 1 },
+	{ "You withdrew {*}",
+		parse_builtin_match_63, 1 },
+	{ "You cannot DEPOSIT if you are not in a bank!",
+		parse_builtin_match_64, 0 },
+	{ "Please specify a more reasonable amount.",
+		parse_builtin_match_65, 0 },
+	{ "You just bought {*} for {*}",
+		parse_builtin_match_66, 2 },
+	{ "{*} is not a known item.",
+		parse_builtin_match_67, 1 },
+	{ "You sold {*} for {*}",
+		parse_builtin_match_68, 2 },
+	{ "You don't have {*} to sell!",
+		parse_builtin_match_69, 1 },
+	{ "You just paid {*} in toll charges.",
+		parse_builtin_match_70, 1 },
+	{ "use {*} {direction}",
+		NULL, 0 },
+	{ "You took {*}.",
+		parse_builtin_match_71, 1 },
+	{ "You picked up {*}",
+		parse_builtin_match_72, 1 },
+	{ "You don't see {*} here.",
+		parse_builtin_match_73, 1 },
+	{ "You don't see {*}",
+		parse_builtin_match_74, 1 },
+	{ "You don't have {*} to drop!",
+		parse_builtin_match_75, 1 },
+	{ "You dropped {*}.",
+		parse_builtin_match_76, 1 },
+	{ "You hid {*}.",
+		parse_builtin_match_77, 1 },
+	{ "You don't have {*} to hide!",
+		parse_builtin_match_78, 1 },
+	{ "You cannot carry that much!",
+		parse_builtin_match_79, 0 },
+	{ "Syntax: GET {*} {Currency}",
+		NULL, 0 },
+	{ "You do not have {*} left unequipped.",
+		parse_builtin_match_80, 1 },
+	{ "You are now holding {*}.",
+		parse_builtin_match_81, 1 },
+	{ "You are now wearing {*}.",
+		parse_builtin_match_82, 1 },
+	{ "You lit the {*}.",
+		parse_builtin_match_83, 1 },
+	{ "You have removed {*} and extinguished it.",
+		parse_builtin_match_84, 1 },
+	{ "You already have something lit!",
+		parse_builtin_match_85, 0 },
+	{ "Your {*} flickers and goes out.",
+		parse_builtin_match_86, 1 },
+	{ "{cash} drop to the ground.",
+		NULL, 0 },
+	{ NULL, NULL, 0 }
+};
+
+static const parse_builtin_regexp_t parse_builtin_db_5[] = {
+	{ "{Realm Of Legends}",
+		NULL, 0 },
+	{ "MUD Internal Error - Please tell your sysop",
+		parse_builtin_match_87, 0 },
+	{ "Sorry to interrupt, but the system will be shutting",
+		parse_builtin_match_88, 0 },
+	{ "Sorry to interrupt here, but the server will be shutting",
+		parse_builtin_match_89, 0 },
+	{ "Your character has been saved. If you have any comments or suggestions, please",
+		parse_builtin_match_90, 0 },
+	{ NULL, NULL, 0 }
+};
+
+static const parse_builtin_regexp_t parse_builtin_db_6[] = {
+	{ "You hear movement to the {direction}.",
+		NULL, 0 },
+	{ "You pull open the manhole cover, and slip inside the hole.",
+		parse_builtin_match_91, 0 },
+	{ "You walk into the wide crack, and follow a path through the rock.",
+		parse_builtin_match_92, 0 },
+	{ "You walk through the waterfall!",
+		parse_builtin_match_93, 0 },
+	{ "You squeeze through the narrow hole.",
+		parse_builtin_match_94, 0 },
+	{ "You move some rocks to the side.",
+		parse_builtin_match_95, 0 },
+	{ "You push through the dense foliage, and walk onto a small path.",
+		parse_builtin_match_96, 0 },
+	{ "You clamber into the burnt stump.",
+		parse_builtin_match_97, 0 },
+	{ "You climb into the pitch-dark hole.",
+		parse_builtin_match_98, 0 },
+	{ "You climb into one of the skiffs, and row to Silvermere.",
+		parse_builtin_match_99, 0 },
+	{ "You jump into the large fountain.",
+		parse_builtin_match_100, 0 },
+	{ "You wade through the salty water to the beach.",
+		parse_builtin_match_101, 0 },
+	{ "You wade through the salty water to the reef.",
+		parse_builtin_match_102, 0 },
+	{ "Dhelvanen closes his eyes, and concentrates silently, for a moment you can't",
+		parse_builtin_match_103, 0 },
+	{ "You touch the crystal and your entire body freezes for a second!",
+		parse_builtin_match_104, 0 },
+	{ "You begin to examine the book and begin to feel light headed.",
+		parse_builtin_match_105, 0 },
+	{ "You rise through the air and pass through the barrier of water!",
+		parse_builtin_match_106, 0 },
+	{ "You do not have a room ticket.",
+		parse_builtin_match_107, 0 },
+	{ "You have progressed too far for this room.",
+		parse_builtin_match_108, 0 },
+	{ "You have progressed too far to go through this exit!",
+		parse_builtin_match_109, 0 },
+	{ "You walk into a shimmering wall!",
+		parse_builtin_match_110, 0 },
+	{ "There is no exit in that direction!",
+		parse_builtin_match_111, 0 },
+	{ "There are no exits to the {direction}!",
+		NULL, 0 },
+	{ "There are no exits {direction}!",
+		NULL, 0 },
+	{ "Your command had no effect.",
+		parse_builtin_match_112, 0 },
+	{ "You fumble in confusion!",
+		parse_builtin_match_113, 0 },
+	{ "The {*} is (C|c)losed!",
+		NULL, 0 },
+	{ "There is a closed {*} in that direction!",
+		parse_builtin_match_114, 1 },
+	{ "The room is pitch black - you can't see anything",
+		parse_builtin_match_115, 0 },
+	{ "The room is very dark - you can't see anything",
+		parse_builtin_match_116, 0 },
+	{ "The room is pitch black - you can't see anything",
+		parse_builtin_match_117, 0 },
+	{ "The room is very dark - you can't see anything",
+		parse_builtin_match_118, 0 },
+	{ "You are blind.",
+		parse_builtin_match_119, 0 },
+	{ "You successfully unlocked the {*}.",
+		parse_builtin_match_120, 1 },
+	{ "The {*} was not locked.",
+		parse_builtin_match_121, 1 },
+	{ "You bashed the {*} open.",
+		parse_builtin_match_122, 1 },
+	{ "The {*} is now open.",
+		parse_builtin_match_123, 1 },
+	{ "The {*} (is|was) already open.",
+		NULL, 0 },
+	{ "Your attempts to bash through fail!",
+		parse_builtin_match_124, 0 },
+	{ "You see {player} bash the {*} to the {direction}.",
+		NULL, 0 },
+	{ "The {*} to the {direction} just flew open.",
+		NULL, 0 },
+	{ "You see {player} close the {*} to the {direction}.",
+		NULL, 0 },
+	{ "You see {player} attempt to bash the {*} to the {direction}.",
+		NULL, 0 },
+	{ "The {*} to the {direction} just locked!",
+		NULL, 0 },
+	{ "The {*} to the {direction} just (C|c)losed.",
+		NULL, 0 },
+	{ "Your skill fails you this time.",
+		parse_builtin_match_125, 0 },
+	{ "Syntax: PICKLOCK {direction}",
+		NULL, 0 },
+	{ "The {*} is locked.",
+		parse_builtin_match_126, 1 },
+	{ "You found an exit to the {direction}!",
+		NULL, 0 },
+	{ "You found an exit {direction}!",
+		NULL, 0 },
+	{ "A concealed passage opens to the {direction}.",
+		NULL, 0 },
+	{ "A gigantic stone door opens in the {direction} wall!",
+		NULL, 0 },
+	{ "After twisting the skull, an opening appears to the {direction}!",
+		NULL, 0 },
+	{ "After pulling the lever, an opening appears to the {direction}!",
+		NULL, 0 },
+	{ " -- Following your Party leader {direction} --",
+		NULL, 0 },
+	{ NULL, NULL, 0 }
+};
+
+static const parse_builtin_regexp_t parse_builtin_db_7[] = {
+	{ "........ {1} {2} +\\-  {3}{*}",
+		parse_builtin_match_127, 4 },
+	{ "............... {1} {2} +.......... ....................",
+		parse_builtin_match_128, 2 },
+	{ "{player} just entered the Realm.",
+		parse_builtin_match_129, 1 },
+	{ "{player} just left the Realm.",
+		parse_builtin_match_130, 1 },
+	{ "{player} just hung up!!!",
+		parse_builtin_match_131, 1 },
+	{ "{player} just disconnected!!!",
+		parse_builtin_match_132, 1 },
+	{ "You are now following {player}",
+		parse_builtin_match_133, 1 },
+	{ "You are no longer following {player}.",
+		parse_builtin_match_134, 1 },
+	{ "You have invited {player} to follow you.",
+		parse_builtin_match_135, 1 },
+	{ "{player} started to follow you.",
+		parse_builtin_match_136, 1 },
+	{ "{player} has been removed from your followers.",
+		parse_builtin_match_137, 1 },
+	{ "{player} gossips: {*}",
+		parse_builtin_match_138, 2 },
+	{ "{player} auctions: {*}",
+		parse_builtin_match_139, 2 },
+	{ "{player} gangpaths: {*}",
+		parse_builtin_match_140, 2 },
+	{ "{player} telepaths: {*}",
+		parse_builtin_match_141, 2 },
+	{ "{player} says( .to you.)? .{*}.",
+		NULL, 0 },
+	{ NULL, NULL, 0 }
+};
+
+static const parse_builtin_regexp_t parse_builtin_db_8[] = {
+	{ "You push some rocks to the side and opening gaping hole!",
+		parse_builtin_match_142, 0 },
+	{ "A secret trapdoor is uncovered from under the sand!",
+		parse_builtin_match_143, 0 },
+	{ "A hidden panel in the fireplace slides open.",
+		parse_builtin_match_144, 0 },
+	{ "As you push the hidden stone, you hear a slight click!",
+		parse_builtin_match_145, 0 },
+	{ "As you push the hidden stone, you hear a slight click!",
+		parse_builtin_match_146, 0 },
+	{ "You push some rocks to the side and opening gaping hole!",
+		parse_builtin_match_147, 0 },
+	{ "You say the word .Faith. out loud.",
+		parse_builtin_match_148, 0 },
+	{ "A cleverly concealed passage opens!",
+		parse_builtin_match_149, 0 },
+	{ "A groaning crack in the darkwood tree yawns open!",
+		parse_builtin_match_150, 0 },
+	{ "A groaning crack in the darkwood tree yawns open!",
+		parse_builtin_match_151, 0 },
+	{ "A small hidden passage silently slides open.",
+		parse_builtin_match_152, 0 },
+	{ "A small hidden passage silently slides open.",
+		parse_builtin_match_153, 0 },
+	{ "You pull the switch and the bookcase moves aside.",
+		parse_builtin_match_154, 0 },
+	{ "The knight statue slides aside, revealing a small passage.",
+		parse_builtin_match_155, 0 },
+	{ "You push the switch, and you hear a loud grinding noise!",
+		parse_builtin_match_156, 0 },
+	{ "You twist the opal stone!",
+		parse_builtin_match_157, 0 },
+	{ "You pull the lever.",
+		parse_builtin_match_158, 0 },
+	{ NULL, NULL, 0 }
+};
+
+static const parse_builtin_regexp_t parse_builtin_db_9[] = {
+	{ "Meditation will not help at this time.",
+		parse_builtin_match_159, 0 },
+	{ "You awake from deep meditation feeling stronger!",
+		parse_builtin_match_160, 0 },
+	{ "You are too sick to meditate!",
+		parse_builtin_match_161, 0 },
+	{ "You are now meditating.",
+		parse_builtin_match_162, 0 },
+	{ "You are now resting.",
+		parse_builtin_match_163, 0 },
+	{ "You will exit after a period of silent meditation.",
+		parse_builtin_match_164, 0 },
+	{ "{*}Your meditation has been interrupted - you may not exit now!",
+		parse_builtin_match_165, 1 },
+	{ "Attempting to sneak...",
+		parse_builtin_match_166, 0 },
+	{ "Attempting to sneak...You don't think you're sneaking.",
+		parse_builtin_match_167, 0 },
+	{ "You may not sneak right now!",
+		parse_builtin_match_168, 0 },
+	{ "Sneaking...",
+		parse_builtin_match_169, 0 },
+	{ "You make a sound as you enter the room!",
+		parse_builtin_match_170, 0 },
+	{ "You are no longer sneaking.",
+		parse_builtin_match_171, 0 },
+	{ NULL, NULL, 0 }
+};
+
+static const parse_builtin_regexp_t parse_builtin_db_10[] = {
+	{ "The effects of confusion wear off!",
+		parse_builtin_match_172, 0 },
+	{ "The effects of the death dog's shriek wear off!",
+		parse_builtin_match_173, 0 },
+	{ "The effects of the poison wear off!",
+		parse_builtin_match_174, 0 },
+	{ "You can see again!",
+		parse_builtin_match_175, 0 },
+	{ "The unnatural darkness lifts.",
+		parse_builtin_match_176, 0 },
+	{ "Your vision returns to normal.",
+		parse_builtin_match_177, 0 },
+	{ "The effects of the mummy's breath wears off!",
+		parse_builtin_match_178, 0 },
+	{ "You are confused!",
+		parse_builtin_match_179, 0 },
+	{ "You feel confused!",
+		parse_builtin_match_180, 0 },
+	{ "{*} casts blind on you!",
+		parse_builtin_match_181, 1 },
+	{ "The large mummy breathes on you!",
+		parse_builtin_match_182, 0 },
+	{ "A black curse is upon you!",
+		parse_builtin_match_183, 0 },
+	{ "You are enveloped in darkness!",
+		parse_builtin_match_184, 0 },
+	{ "You are blind.",
+		parse_builtin_match_185, 0 },
+	{ "Poison burns through your veins!",
+		parse_builtin_match_186, 0 },
+	{ "You feel ill.",
+		parse_builtin_match_187, 0 },
+	{ NULL, NULL, 0 }
+};
+
+const parse_builtin_db_t parse_builtin_dbs[] = {
+	{ "character.db",
+		"1dc64ddb8059627e661bbdb2329098eb440f153b896fa0334585bf3f30ad99bf",
+		parse_builtin_db_0 },
+	{ "combat.db",
+		"15ccd212bab78aae3f84640ea73851bdb4d7aa8f9f1014561ee112a9026df698",
+		parse_builtin_db_1 },
+	{ "command.db",
+		"2241594bd2a5058651eaeb639cd651f326f2ba59ce8fe43fdcb468d1626fb62d",
+		parse_builtin_db_2 },
+	{ "custom.db",
+		"ebac91e840f2ff22cd7a31157e5fe1d3e20a03f2dd524258045d84870736d4d1",
+		parse_builtin_db_3 },
+	{ "item.db",
+		"49926b378e1deae4bd1a3cc2b5f3959a307c8257bbff4a00a93d78bdf320e9db",
+		parse_builtin_db_4 },
+	{ "misc.db",
+		"131d1e9850a8c50eae5f236a4191ab5b14267445201f19a4df4da3f7a238e2c3",
+		parse_builtin_db_5 },
+	{ "movement.db",
+		"cc607be20e925e6806f021a777cda08b9c8df7aa26859d3ee402af0ebfa594e7",
+		parse_builtin_db_6 },
+	{ "player.db",
+		"616434f17e0bd532b5556de8c3f71888798b2498ae889f044216fdf4552ad8f6",
+		parse_builtin_db_7 },
+	{ "secret.db",
+		"42d717f306495638c971230e4faf39d9b2fbe7f99a10e9ea5907f79b51d0038e",
+		parse_builtin_db_8 },
+	{ "state.db",
+		"e2a48373ed761342af6499dfa1013329f004663125ed7db6f99a6302ed17fe3c",
+		parse_builtin_db_9 },
+	{ "status.db",
+		"4e0dcd3298f92bbd91dce8321feed598b0eaec638c91d942941312b7d1d2fc7a",
+		parse_builtin_db_10 },
+	{ NULL, NULL, NULL }
+};
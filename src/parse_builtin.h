@@ -0,0 +1,42 @@
+/*  MudPRO: An advanced client for the online game MajorMUD
+ *  Copyright (C) 2002-2018  David Slusky
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+#ifndef __PARSE_BUILTIN_H__
+#define __PARSE_BUILTIN_H__
+
+#include <glib.h>
+
+#include "parse.h"
+
+typedef struct
+{
+	const gchar *pattern;       /* pattern as it appears in the database */
+	parse_builtin_func_t match; /* generated matcher, NULL to use PCRE */
+	gint captures;              /* capture groups set by match */
+} parse_builtin_regexp_t;
+
+typedef struct
+{
+	const gchar *name;   /* database filename */
+	const gchar *digest; /* SHA-256 of the contents regexps were made from */
+	const parse_builtin_regexp_t *regexps; /* in file order */
+} parse_builtin_db_t;
+
+extern const parse_builtin_db_t parse_builtin_dbs[];
+
+#endif /* __PARSE_BUILTIN_H__ */
@@ -0,0 +1,377 @@
+/*  MudPRO: An advanced client for the online game MajorMUD
+ *  Copyright (C) 2002-2018  David Slusky
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+#include <string.h>
+
+#include "character.h"
+#include "dispatch.h"
+#include "parse.h"
+#include "parse_cache.h"
+
+#define PARSE_CACHE_NULL 0xffffffff /* length of a NULL string */
+
+typedef struct
+{
+	const guchar *pos; /* current read position */
+	const guchar *end; /* end of cache contents */
+	gboolean error;    /* read past the end */
+} parse_cache_reader_t;
+
+static gchar *parse_cache_filename (const gchar *filename);
+static void parse_cache_put_uint (GByteArray *buf, guint32 value);
+static void parse_cache_put_str (GByteArray *buf, const gchar *str);
+static guint32 parse_cache_get_uint (parse_cache_reader_t *r);
+static gchar *parse_cache_get_str (parse_cache_reader_t *r);
+
+
+/* =========================================================================
+ = PARSE_CACHE_FILENAME
+ =
+ = Returns cache filename for the specified parse database
+ ======================================================================== */
+
+static gchar *parse_cache_filename (const gchar *filename)
+{
+	gchar *base, *path;
+
+	base = g_path_get_basename (filename);
+	path = g_strdup_printf ("%s%c%s%c%s.cache", character.data_path,
+		G_DIR_SEPARATOR, PARSE_CACHE_DIR, G_DIR_SEPARATOR, base);
+	g_free (base);
+
+	return path;
+}
+
+
+/* =========================================================================
+ = PARSE_CACHE_KEY
+ =
+ = Returns key identifying the compiled form of a parse database: a hash
+ = of its contents, salt (anything else affecting compilation, such as
+ = tag substitutions) and the PCRE2 version. The SHA-256 of the contents
+ = alone is stored in digest, if given. NULL if it can't be read
+ ======================================================================== */
+
+gchar *parse_cache_key (const gchar *filename, const gchar *salt,
+	gchar **digest)
+{
+	GChecksum *checksum;
+	gchar version[64], *contents, *contents_digest, *key;
+	gsize length;
+
+	g_assert (filename != NULL);
+
+	if (digest)
+		*digest = NULL;
+
+	if (!g_file_get_contents (filename, &contents, &length, NULL))
+		return NULL;
+
+	memset (version, 0, sizeof (version));
+	pcre2_config (PCRE2_CONFIG_VERSION, version);
+
+	contents_digest = g_compute_checksum_for_data (G_CHECKSUM_SHA256,
+		(guchar *) contents, length);
+	g_free (contents);
+
+	checksum = g_checksum_new (G_CHECKSUM_SHA256);
+	g_checksum_update (checksum, (guchar *) contents_digest,
+		strlen (contents_digest));
+	g_checksum_update (checksum, (guchar *) salt, salt ? strlen (salt) : 0);
+	g_checksum_update (checksum, (guchar *) version, strlen (version));
+	key = g_strdup_printf ("%d:%d:%s", PARSE_CACHE_VERSION,
+		(gint) sizeof (gpointer), g_checksum_get_string (checksum));
+	g_checksum_free (checksum);
+
+	if (digest)
+		*digest = contents_digest;
+	else
+		g_free (contents_digest);
+
+	return key;
+}
+
+
+/* =========================================================================
+ = PARSE_CACHE_LOAD
+ =
+ = Load compiled regexps for a parse database from its cache, in parse
+ = list order. Returns FALSE if there is no valid cache for key
+ ======================================================================== */
+
+gboolean parse_cache_load (const gchar *filename, const gchar *key,
+	GSList **regexps)
+{
+	parse_cache_reader_t r;
+	parse_regexp_t *regexp;
+	parse_action_t *action;
+	GMappedFile *mapped;
+	GSList *list = NULL, *node;
+	pcre2_code **codes = NULL;
+	const guchar *blob;
+	gchar *path, *stored;
+	guint32 count, actions, size, pad, i, j;
+	gboolean valid = FALSE;
+
+	g_assert (filename != NULL);
+	g_assert (key != NULL);
+	g_assert (regexps != NULL);
+
+	path = parse_cache_filename (filename);
+	mapped = g_mapped_file_new (path, FALSE, NULL);
+	g_free (path);
+
+	if (!mapped)
+		return FALSE;
+
+	r.pos   = (const guchar *) g_mapped_file_get_contents (mapped);
+	r.end   = r.pos + g_mapped_file_get_length (mapped);
+	r.error = FALSE;
+
+	if (parse_cache_get_uint (&r) != PARSE_CACHE_MAGIC)
+		goto done;
+
+	stored = parse_cache_get_str (&r);
+	valid = (stored && !strcmp (stored, key));
+	g_free (stored);
+
+	if (!valid)
+		goto done;
+
+	count = parse_cache_get_uint (&r);
+
+	for (i = 0; i < count && !r.error; i++)
+	{
+		regexp = g_malloc0 (sizeof (parse_regexp_t));
+		regexp->pattern  = parse_cache_get_str (&r);
+		regexp->expanded = parse_cache_get_str (&r);
+		regexp->literal  = parse_cache_get_str (&r);
+		regexp->exclusive = parse_cache_get_uint (&r);
+
+		if (!regexp->pattern || !regexp->expanded)
+			r.error = TRUE;
+
+		actions = parse_cache_get_uint (&r);
+
+		for (j = 0; j < actions && !r.error; j++)
+		{
+			action = g_malloc0 (sizeof (parse_action_t));
+			action->type  = parse_cache_get_str (&r);
+			action->arg   = parse_cache_get_str (&r);
+			action->value = (gint32) parse_cache_get_uint (&r);
+			regexp->actions = g_slist_append (regexp->actions, action);
+
+			if (!r.error && !parse_action_resolve (action))
+				r.error = TRUE; /* actions changed since cached */
+		}
+
+		list = g_slist_append (list, regexp);
+	}
+
+	/* serialized patterns follow, aligned for pcre2_serialize_decode */
+	size = parse_cache_get_uint (&r);
+	pad  = parse_cache_get_uint (&r);
+	blob = r.pos + pad;
+
+	if (r.error || pad >= 8 || (gsize) (r.end - r.pos) < (gsize) pad + size)
+		valid = FALSE;
+	else if (count)
+	{
+		codes = g_malloc0 (count * sizeof (pcre2_code *));
+		valid = (pcre2_serialize_decode (codes, count, blob, NULL) == (gint) count);
+	}
+
+	if (!valid)
+		goto done;
+
+	for (node = list, i = 0; node; node = node->next, i++)
+	{
+		regexp = node->data;
+		regexp->compiled = codes[i];
+		regexp->jit = !pcre2_jit_compile (codes[i], PCRE2_JIT_COMPLETE);
+	}
+
+done:
+	if (!valid)
+	{
+		for (node = list; node; node = node->next)
+			parse_regexp_free (node->data);
+		g_slist_free (list);
+		list = NULL;
+	}
+
+	g_free (codes);
+	g_mapped_file_unref (mapped);
+
+	*regexps = list;
+	return valid;
+}
+
+
+/* =========================================================================
+ = PARSE_CACHE_SAVE
+ =
+ = Write compiled regexps (in parse list order) for a parse database to
+ = its cache
+ ======================================================================== */
+
+void parse_cache_save (const gchar *filename, const gchar *key,
+	GSList *regexps)
+{
+	parse_regexp_t *regexp;
+	parse_action_t *action;
+	GByteArray *buf;
+	GSList *node, *link;
+	pcre2_code **codes;
+	PCRE2_SIZE size = 0;
+	guint8 *blob = NULL;
+	gchar *path;
+	guint32 count, pad, i;
+	guint8 zero[8];
+
+	g_assert (filename != NULL);
+	g_assert (key != NULL);
+
+	count = g_slist_length (regexps);
+	codes = g_malloc0 ((count + 1) * sizeof (pcre2_code *));
+
+	for (node = regexps, i = 0; node; node = node->next, i++)
+		codes[i] = ((parse_regexp_t *) node->data)->compiled;
+
+	if (count && pcre2_serialize_encode ((const pcre2_code **) codes, count,
+		&blob, &size, NULL) != (gint) count)
+	{
+		g_free (codes);
+		return; /* patterns can't be serialized, don't cache */
+	}
+
+	buf = g_byte_array_new ();
+
+	parse_cache_put_uint (buf, PARSE_CACHE_MAGIC);
+	parse_cache_put_str (buf, key);
+	parse_cache_put_uint (buf, count);
+
+	for (node = regexps; node; node = node->next)
+	{
+		regexp = node->data;
+		parse_cache_put_str (buf, regexp->pattern);
+		parse_cache_put_str (buf, regexp->expanded);
+		parse_cache_put_str (buf, regexp->literal);
+		parse_cache_put_uint (buf, regexp->exclusive);
+		parse_cache_put_uint (buf, g_slist_length (regexp->actions));
+
+		for (link = regexp->actions; link; link = link->next)
+		{
+			action = link->data;
+			parse_cache_put_str (buf, action->type);
+			parse_cache_put_str (buf, action->arg);
+			parse_cache_put_uint (buf, (guint32) action->value);
+		}
+	}
+
+	pad = (8 - (buf->len + 8) % 8) % 8;
+	parse_cache_put_uint (buf, size);
+	parse_cache_put_uint (buf, pad);
+
+	memset (zero, 0, sizeof (zero));
+	g_byte_array_append (buf, zero, pad);
+	if (size)
+		g_byte_array_append (buf, blob, size);
+
+	path = g_strdup_printf ("%s%c%s", character.data_path,
+		G_DIR_SEPARATOR, PARSE_CACHE_DIR);
+	g_mkdir_with_parents (path, 0755);
+	g_free (path);
+
+	path = parse_cache_filename (filename);
+	g_file_set_contents (path, (gchar *) buf->data, buf->len, NULL);
+	g_free (path);
+
+	if (blob)
+		pcre2_serialize_free (blob);
+	g_byte_array_free (buf, TRUE);
+	g_free (codes);
+}
+
+
+/* =========================================================================
+ = PARSE_CACHE_PUT_UINT / PARSE_CACHE_PUT_STR
+ =
+ = Append values to cache buffer (native byte order)
+ ======================================================================== */
+
+static void parse_cache_put_uint (GByteArray *buf, guint32 value)
+{
+	g_byte_array_append (buf, (guint8 *) &value, sizeof (value));
+}
+
+static void parse_cache_put_str (GByteArray *buf, const gchar *str)
+{
+	if (!str)
+	{
+		parse_cache_put_uint (buf, PARSE_CACHE_NULL);
+		return;
+	}
+
+	parse_cache_put_uint (buf, strlen (str));
+	g_byte_array_append (buf, (guint8 *) str, strlen (str));
+}
+
+
+/* =========================================================================
+ = PARSE_CACHE_GET_UINT / PARSE_CACHE_GET_STR
+ =
+ = Read values from cache, flagging an error on truncated data
+ ======================================================================== */
+
+static guint32 parse_cache_get_uint (parse_cache_reader_t *r)
+{
+	guint32 value;
+
+	if (r->error || r->end - r->pos < (gint) sizeof (value))
+	{
+		r->error = TRUE;
+		return 0;
+	}
+
+	memcpy (&value, r->pos, sizeof (value));
+	r->pos += sizeof (value);
+
+	return value;
+}
+
+static gchar *parse_cache_get_str (parse_cache_reader_t *r)
+{
+	guint32 length = parse_cache_get_uint (r);
+	gchar *str;
+
+	if (r->error || length == PARSE_CACHE_NULL)
+		return NULL;
+
+	if ((guint32) (r->end - r->pos) < length)
+	{
+		r->error = TRUE;
+		return NULL;
+	}
+
+	str = g_strndup ((const gchar *) r->pos, length);
+	r->pos += length;
+
+	return str;
+}
+
@@ -0,0 +1,35 @@
+/*  MudPRO: An advanced client for the online game MajorMUD
+ *  Copyright (C) 2002-2018  David Slusky
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+#ifndef __PARSE_CACHE_H__
+#define __PARSE_CACHE_H__
+
+#include <glib.h>
+
+#define PARSE_CACHE_DIR     "parse.cache" /* alongside the parse directory */
+#define PARSE_CACHE_MAGIC   0x4d505043    /* "MPPC" */
+#define PARSE_CACHE_VERSION 2             /* bump when the layout changes */
+
+gchar *parse_cache_key (const gchar *filename, const gchar *salt,
+	gchar **digest);
+gboolean parse_cache_load (const gchar *filename, const gchar *key,
+	GSList **regexps);
+void parse_cache_save (const gchar *filename, const gchar *key,
+	GSList *regexps);
+
+#endif /* __PARSE_CACHE_H__ */
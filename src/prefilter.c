@@ -0,0 +1,491 @@
+/*  MudPRO: An advanced client for the online game MajorMUD
+ *  Copyright (C) 2002-2018  David Slusky
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+#include <ctype.h>
+#include <string.h>
+
+#include "prefilter.h"
+
+/* escapes which match a class of characters (or nothing) rather than
+   a literal, anything else alphanumeric is too exotic to index */
+#define CLASS_ESCAPES "dDwWsShHvVRbBAzZG"
+
+static gint prefilter_state_new (prefilter_t *pf);
+static gint prefilter_goto (prefilter_t *pf, gint state, guchar ch);
+static void prefilter_edge_new (prefilter_t *pf, gint state, guchar ch, gint target);
+static const gchar *prefilter_skip_class (const gchar *p);
+static const gchar *prefilter_skip_group (const gchar *p);
+static const gchar *prefilter_skip_quantifier (const gchar *p);
+static void prefilter_literal_flush (GString *run, GString *best);
+
+
+/* =========================================================================
+ = PREFILTER_NEW
+ =
+ = Allocate an empty literal index
+ ======================================================================== */
+
+prefilter_t *prefilter_new (void)
+{
+	prefilter_t *pf = g_malloc0 (sizeof (prefilter_t));
+
+	prefilter_state_new (pf); /* root */
+
+	return pf;
+}
+
+
+/* =========================================================================
+ = PREFILTER_FREE
+ =
+ = Free memory allocated to literal index
+ ======================================================================== */
+
+void prefilter_free (prefilter_t *pf)
+{
+	gint i;
+
+	if (!pf)
+		return;
+
+	for (i = 0; i < pf->state_count; i++)
+		g_slist_free (pf->states[i].matches);
+
+	g_free (pf->states);
+	g_free (pf->edges);
+	g_free (pf);
+}
+
+
+/* =========================================================================
+ = PREFILTER_STATE_NEW
+ =
+ = Append a new state to the automaton, returns its index
+ ======================================================================== */
+
+static gint prefilter_state_new (prefilter_t *pf)
+{
+	prefilter_state_t *state;
+
+	if (pf->state_count == pf->state_max)
+	{
+		pf->state_max = MAX (64, pf->state_max * 2);
+		pf->states = g_realloc (pf->states,
+			pf->state_max * sizeof (prefilter_state_t));
+	}
+
+	state = &pf->states[pf->state_count];
+	state->fail    = 0;
+	state->output  = -1;
+	state->edges   = -1;
+	state->matches = NULL;
+
+	return pf->state_count++;
+}
+
+
+/* =========================================================================
+ = PREFILTER_EDGE_NEW
+ =
+ = Add a labelled edge between two states
+ ======================================================================== */
+
+static void prefilter_edge_new (prefilter_t *pf, gint state, guchar ch, gint target)
+{
+	prefilter_edge_t *edge;
+
+	if (pf->edge_count == pf->edge_max)
+	{
+		pf->edge_max = MAX (64, pf->edge_max * 2);
+		pf->edges = g_realloc (pf->edges,
+			pf->edge_max * sizeof (prefilter_edge_t));
+	}
+
+	edge = &pf->edges[pf->edge_count];
+	edge->ch     = ch;
+	edge->target = target;
+	edge->next   = pf->states[state].edges;
+
+	pf->states[state].edges = pf->edge_count++;
+
+	if (state == 0)
+		pf->root[ch] = target;
+}
+
+
+/* =========================================================================
+ = PREFILTER_GOTO
+ =
+ = Returns the goto transition for state/ch, or -1 if there is none
+ ======================================================================== */
+
+static gint prefilter_goto (prefilter_t *pf, gint state, guchar ch)
+{
+	gint e;
+
+	if (state == 0)
+		return pf->root[ch] ? pf->root[ch] : -1;
+
+	for (e = pf->states[state].edges; e >= 0; e = pf->edges[e].next)
+		if (pf->edges[e].ch == ch)
+			return pf->edges[e].target;
+
+	return -1;
+}
+
+
+/* =========================================================================
+ = PREFILTER_ADD
+ =
+ = Add a literal to the index, data is passed back when it is found
+ ======================================================================== */
+
+void prefilter_add (prefilter_t *pf, const gchar *literal, gpointer data)
+{
+	const guchar *p;
+	gint state = 0, next;
+
+	g_assert (pf != NULL);
+	g_assert (literal != NULL);
+
+	for (p = (const guchar *) literal; *p; p++)
+	{
+		if ((next = prefilter_goto (pf, state, *p)) < 0)
+		{
+			next = prefilter_state_new (pf);
+			prefilter_edge_new (pf, state, *p, next);
+		}
+		state = next;
+	}
+
+	pf->states[state].matches = g_slist_prepend (pf->states[state].matches, data);
+	pf->literals++;
+}
+
+
+/* =========================================================================
+ = PREFILTER_COMPILE
+ =
+ = Compute failure and output links (must follow the last prefilter_add)
+ ======================================================================== */
+
+void prefilter_compile (prefilter_t *pf)
+{
+	gint *queue, head = 0, tail = 0;
+	gint state, e, target, f, next;
+
+	g_assert (pf != NULL);
+
+	queue = g_malloc (pf->state_count * sizeof (gint));
+
+	for (e = pf->states[0].edges; e >= 0; e = pf->edges[e].next)
+	{
+		target = pf->edges[e].target;
+		pf->states[target].fail = 0;
+		queue[tail++] = target;
+	}
+
+	/* breadth-first, so failure targets are always resolved first */
+	while (head < tail)
+	{
+		state = queue[head++];
+
+		for (e = pf->states[state].edges; e >= 0; e = pf->edges[e].next)
+		{
+			target = pf->edges[e].target;
+			f = pf->states[state].fail;
+
+			while (f && prefilter_goto (pf, f, pf->edges[e].ch) < 0)
+				f = pf->states[f].fail;
+
+			next = prefilter_goto (pf, f, pf->edges[e].ch);
+			pf->states[target].fail = (next > 0 && next != target) ? next : 0;
+
+			queue[tail++] = target;
+		}
+
+		pf->states[state].output = pf->states[state].matches ?
+			state : pf->states[pf->states[state].fail].output;
+	}
+
+	g_free (queue);
+}
+
+
+/* =========================================================================
+ = PREFILTER_SCAN
+ =
+ = Scan subject, calling func for each data whose literal occurs within
+ ======================================================================== */
+
+void prefilter_scan (prefilter_t *pf, const gchar *subject, gint len,
+	GFunc func, gpointer user_data)
+{
+	const guchar *p, *end;
+	GSList *node;
+	gint state = 0, next = -1, out;
+
+	g_assert (pf != NULL);
+	g_assert (subject != NULL);
+
+	for (p = (const guchar *) subject, end = p + len; p < end; p++)
+	{
+		while (state && (next = prefilter_goto (pf, state, *p)) < 0)
+			state = pf->states[state].fail;
+
+		state = state ? next : pf->root[*p];
+
+		for (out = pf->states[state].output; out > 0;
+			out = pf->states[pf->states[out].fail].output)
+		{
+			for (node = pf->states[out].matches; node; node = node->next)
+				func (node->data, user_data);
+		}
+	}
+}
+
+
+/* =========================================================================
+ = PREFILTER_LITERAL_EXTRACT
+ =
+ = Returns the longest literal any match of pattern must contain, or NULL
+ = if one could not be determined (pattern should always be attempted)
+ ======================================================================== */
+
+gchar *prefilter_literal_extract (const gchar *pattern)
+{
+	GString *run, *best;
+	const gchar *p;
+	gboolean literal = FALSE; /* last token appended to the current run */
+	gchar *str;
+
+	g_assert (pattern != NULL);
+
+	run  = g_string_new ("");
+	best = g_string_new ("");
+
+	for (p = pattern; p && *p; p++)
+	{
+		switch (*p)
+		{
+		case '\\':
+			if (!isalnum ((guchar) p[1]))
+			{
+				if (p[1] == '\0')
+				{
+					p = NULL;
+					break;
+				}
+				run = g_string_append_c (run, *(++p));
+				literal = TRUE;
+			}
+			else if (strchr (CLASS_ESCAPES, p[1]))
+			{
+				prefilter_literal_flush (run, best);
+				literal = FALSE;
+				p++;
+			}
+			else
+				p = NULL; /* backrefs, \x, \Q, etc */
+			break;
+
+		case '?':
+		case '*':
+			if (literal) /* preceding character is optional */
+				run = g_string_truncate (run, run->len - 1);
+			prefilter_literal_flush (run, best);
+			literal = FALSE;
+			break;
+
+		case '{':
+			if (prefilter_skip_quantifier (p) == NULL)
+			{
+				run = g_string_append_c (run, *p);
+				literal = TRUE;
+				break;
+			}
+			if (literal)
+				run = g_string_truncate (run, run->len - 1);
+			prefilter_literal_flush (run, best);
+			p = prefilter_skip_quantifier (p);
+			literal = FALSE;
+			break;
+
+		case '+':
+			prefilter_literal_flush (run, best);
+			literal = FALSE;
+			break;
+
+		case '(':
+			if (p[1] == '?' && (isalpha ((guchar) p[2]) || p[2] == '-'))
+			{
+				p = NULL; /* inline options may change how literals match */
+				break;
+			}
+			prefilter_literal_flush (run, best);
+			p = prefilter_skip_group (p);
+			literal = FALSE;
+			break;
+
+		case '[':
+			prefilter_literal_flush (run, best);
+			p = prefilter_skip_class (p);
+			literal = FALSE;
+			break;
+
+		case '.':
+		case '^':
+		case '$':
+			prefilter_literal_flush (run, best);
+			literal = FALSE;
+			break;
+
+		case '|': /* top level alternation, nothing is required */
+		case ')':
+			p = NULL;
+			break;
+
+		default:
+			run = g_string_append_c (run, *p);
+			literal = TRUE;
+		}
+
+		if (!p)
+			break;
+	}
+
+	if (!p) /* unable to determine required literal */
+	{
+		g_string_free (run, TRUE);
+		g_string_free (best, TRUE);
+		return NULL;
+	}
+
+	prefilter_literal_flush (run, best);
+	g_string_free (run, TRUE);
+
+	if (best->len < PREFILTER_LITERAL_MIN)
+	{
+		g_string_free (best, TRUE);
+		return NULL;
+	}
+
+	str = best->str;
+	g_string_free (best, FALSE);
+
+	return str;
+}
+
+
+/* =========================================================================
+ = PREFILTER_LITERAL_FLUSH
+ =
+ = Keep current run if it is the longest so far, then start a new one
+ ======================================================================== */
+
+static void prefilter_literal_flush (GString *run, GString *best)
+{
+	if (run->len > best->len)
+		g_string_assign (best, run->str);
+
+	g_string_truncate (run, 0);
+}
+
+
+/* =========================================================================
+ = PREFILTER_SKIP_QUANTIFIER
+ =
+ = Returns the closing brace of a {n}, {n,} or {n,m} quantifier, or NULL
+ = if p does not start one (PCRE treats it as a literal brace)
+ ======================================================================== */
+
+static const gchar *prefilter_skip_quantifier (const gchar *p)
+{
+	g_assert (*p == '{');
+
+	if (!isdigit ((guchar) *(++p)))
+		return NULL;
+
+	while (isdigit ((guchar) *p)) p++;
+
+	if (*p == ',')
+		for (p++; isdigit ((guchar) *p); p++);
+
+	return (*p == '}') ? p : NULL;
+}
+
+
+/* =========================================================================
+ = PREFILTER_SKIP_CLASS
+ =
+ = Returns the closing bracket of a character class, or NULL
+ ======================================================================== */
+
+static const gchar *prefilter_skip_class (const gchar *p)
+{
+	g_assert (*p == '[');
+
+	p++;
+	if (*p == '^') p++;
+	if (*p == ']') p++; /* leading bracket is literal */
+
+	for (; *p; p++)
+	{
+		if (*p == '\\' && p[1])
+			p++;
+		else if (*p == '[' && p[1] == ':')
+		{
+			if ((p = strstr (p, ":]")) == NULL)
+				return NULL;
+			p++;
+		}
+		else if (*p == ']')
+			return p;
+	}
+
+	return NULL;
+}
+
+
+/* =========================================================================
+ = PREFILTER_SKIP_GROUP
+ =
+ = Returns the closing parenthesis of a group, or NULL if unbalanced
+ ======================================================================== */
+
+static const gchar *prefilter_skip_group (const gchar *p)
+{
+	gint depth = 0;
+
+	for (; *p; p++)
+	{
+		if (*p == '\\' && p[1])
+			p++;
+		else if (*p == '[')
+		{
+			if ((p = prefilter_skip_class (p)) == NULL)
+				return NULL;
+		}
+		else if (*p == '(')
+			depth++;
+		else if (*p == ')' && --depth == 0)
+			return p;
+	}
+
+	return NULL;
+}
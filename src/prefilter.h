@@ -0,0 +1,59 @@
+/*  MudPRO: An advanced client for the online game MajorMUD
+ *  Copyright (C) 2002-2018  David Slusky
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+#ifndef __PREFILTER_H__
+#define __PREFILTER_H__
+
+#include <glib.h>
+
+#define PREFILTER_LITERAL_MIN 2 /* shorter literals are not worth indexing */
+
+typedef struct
+{
+	gint fail;       /* failure transition */
+	gint output;     /* nearest state along failure chain with matches */
+	gint edges;      /* first outgoing edge (-1 if none) */
+	GSList *matches; /* data for literals ending at this state */
+} prefilter_state_t;
+
+typedef struct
+{
+	guchar ch;       /* edge label */
+	gint target;     /* destination state */
+	gint next;       /* next edge of the same state */
+} prefilter_edge_t;
+
+typedef struct /* Aho-Corasick automaton over required literals */
+{
+	prefilter_state_t *states;
+	prefilter_edge_t *edges;
+	gint state_count, state_max;
+	gint edge_count, edge_max;
+	gint literals;   /* number of literals added */
+	gint root[256];  /* dense transitions out of the root state */
+} prefilter_t;
+
+prefilter_t *prefilter_new (void);
+void prefilter_free (prefilter_t *pf);
+gchar *prefilter_literal_extract (const gchar *pattern);
+void prefilter_add (prefilter_t *pf, const gchar *literal, gpointer data);
+void prefilter_compile (prefilter_t *pf);
+void prefilter_scan (prefilter_t *pf, const gchar *subject, gint len,
+	GFunc func, gpointer user_data);
+
+#endif /* __PREFILTER_H__ */
@@ -48,8 +48,16 @@ key_value_t spell_flags[] = {
 };
 
 static GSList *spell_db;
+static GHashTable *spell_msg_index; /* exact message -> list of spells */
+static GSList *spell_msg_regexps;   /* spells with regexp messages */
+static pcre2_match_data *spell_msg_match;
 
 static void spell_db_free (GSList *db);
+static void spell_db_index_build (void);
+static void spell_db_index_add (const gchar *msg, spell_t *spell);
+static void spell_db_index_free (void);
+static gboolean spell_db_regexp_match (pcre2_code *regexp, gchar *str);
+static pcre2_code *spell_db_regexp_compile (spell_t *spell, gchar *pattern);
 static void spell_db_parse_option (spell_t *spell, gchar *str);
 static void spell_db_merge_active (gpointer data, gpointer user_data);
 #ifdef NEW_SPELLCASTING
@@ -70,6 +78,7 @@ void spell_db_init (void)
 		"%s%cspells.db", character.data_path, G_DIR_SEPARATOR);
 
 	spell_db = NULL;
+	spell_msg_match = pcre2_match_data_create (1, NULL);
 	spell_db_load ();
 }
 
@@ -82,9 +91,13 @@ void spell_db_init (void)
 
 void spell_db_cleanup (void)
 {
+	spell_db_index_free ();
 	spell_db_free (spell_db);
 	spell_db = NULL;
 
+	pcre2_match_data_free (spell_msg_match);
+	spell_msg_match = NULL;
+
 	g_free (mudpro_db.spells.filename);
 }
 
@@ -154,6 +167,8 @@ void spell_db_load (void)
 	}
 	fclose (fp);
 
+	spell_db_index_build (); /* old index refers to old_db */
+
 	if (old_db) /* mark active spells and free old data */
 	{
 		g_slist_foreach (spell_db, spell_db_merge_active, old_db);
@@ -181,12 +196,89 @@ static void spell_db_free (GSList *db)
 		g_free (spell->name);
 		g_free (spell->msg.start);
 		g_free (spell->msg.end);
+		g_free (spell->msg.start_match);
+		g_free (spell->msg.end_match);
+		if (spell->msg.start_regexp)
+			pcre2_code_free (spell->msg.start_regexp);
+		if (spell->msg.end_regexp)
+			pcre2_code_free (spell->msg.end_regexp);
 		g_free (spell);
 	}
 	g_slist_free (db);
 }
 
 
+/* =========================================================================
+ = SPELL_DB_INDEX_BUILD
+ =
+ = Index spells by their exact start/end messages
+ ======================================================================== */
+
+static void spell_db_index_build (void)
+{
+	GSList *node;
+	spell_t *spell;
+
+	spell_db_index_free ();
+
+	spell_msg_index = g_hash_table_new_full (g_str_hash, g_str_equal,
+		NULL, (GDestroyNotify) g_slist_free);
+
+	for (node = spell_db; node; node = node->next)
+	{
+		spell = node->data;
+
+		if (spell->msg.start)
+			spell_db_index_add (spell->msg.start, spell);
+
+		/* the start message wins if both are the same */
+		if (spell->msg.end && !(spell->msg.start
+			&& !strcmp (spell->msg.start, spell->msg.end)))
+			spell_db_index_add (spell->msg.end, spell);
+
+		if (spell->msg.start_regexp || spell->msg.end_regexp)
+			spell_msg_regexps = g_slist_append (spell_msg_regexps, spell);
+	}
+}
+
+
+/* =========================================================================
+ = SPELL_DB_INDEX_ADD
+ =
+ = Add spell to the list for a message (keyed by the spell's own copy)
+ ======================================================================== */
+
+static void spell_db_index_add (const gchar *msg, spell_t *spell)
+{
+	GSList *list;
+
+	list = g_hash_table_lookup (spell_msg_index, msg);
+
+	if (list) /* list head is already in place, key stays valid */
+		list->next = g_slist_prepend (list->next, spell);
+	else
+		g_hash_table_insert (spell_msg_index, (gpointer) msg,
+			g_slist_prepend (NULL, spell));
+}
+
+
+/* =========================================================================
+ = SPELL_DB_INDEX_FREE
+ =
+ = Free message index
+ ======================================================================== */
+
+static void spell_db_index_free (void)
+{
+	if (spell_msg_index)
+		g_hash_table_destroy (spell_msg_index);
+	spell_msg_index = NULL;
+
+	g_slist_free (spell_msg_regexps);
+	spell_msg_regexps = NULL;
+}
+
+
 /* =========================================================================
  = SPELL_DB_PARSE
  =
@@ -198,16 +290,79 @@ void spell_db_parse (gchar *str)
 	GSList *node;
 	spell_t *spell;
 
-	for (node = spell_db; node; node = node->next)
+	if (!spell_msg_index)
+		return;
+
+	for (node = g_hash_table_lookup (spell_msg_index, str); node;
+		node = node->next)
 	{
 		spell = node->data;
-		g_assert (spell != NULL);
 
 		if (spell->msg.start && !strcmp (str, spell->msg.start))
 			spell->active = TRUE;
-		else if (spell->msg.end && !strcmp (str, spell->msg.end))
+		else
 			spell->active = FALSE;
 	}
+
+	for (node = spell_msg_regexps; node; node = node->next)
+	{
+		spell = node->data;
+
+		if (spell->msg.start && !strcmp (str, spell->msg.start))
+			continue; /* already started above */
+
+		if (spell_db_regexp_match (spell->msg.start_regexp, str))
+			spell->active = TRUE;
+		else if (spell_db_regexp_match (spell->msg.end_regexp, str))
+			spell->active = FALSE;
+	}
+}
+
+
+/* =========================================================================
+ = SPELL_DB_REGEXP_MATCH
+ =
+ = Returns TRUE if str matches regexp (if defined)
+ ======================================================================== */
+
+static gboolean spell_db_regexp_match (pcre2_code *regexp, gchar *str)
+{
+	if (!regexp)
+		return FALSE;
+
+	return pcre2_match (regexp, (PCRE2_SPTR) str, PCRE2_ZERO_TERMINATED,
+		0, 0, spell_msg_match, NULL) >= 0;
+}
+
+
+/* =========================================================================
+ = SPELL_DB_REGEXP_COMPILE
+ =
+ = Compile spell message regexp, NULL if invalid
+ ======================================================================== */
+
+static pcre2_code *spell_db_regexp_compile (spell_t *spell, gchar *pattern)
+{
+	pcre2_code *regexp;
+	PCRE2_SIZE offset;
+	gchar error[STD_STRBUF];
+	gint errcode;
+
+	if (!pattern)
+		return NULL;
+
+	if ((regexp = pcre2_compile ((PCRE2_SPTR) pattern, PCRE2_ZERO_TERMINATED,
+		0, &errcode, &offset, NULL)) == NULL)
+	{
+		pcre2_get_error_message (errcode, (PCRE2_UCHAR *) error, sizeof (error));
+		printt ("Error compiling message for spell %s: %s (at offset %ld)",
+			spell->name, error, (glong) offset);
+		return NULL;
+	}
+
+	pcre2_jit_compile (regexp, PCRE2_JIT_COMPLETE);
+
+	return regexp;
 }
 
 
@@ -310,6 +465,30 @@ static void spell_db_parse_option (spell_t *spell, gchar *str)
 		spell->msg.end = get_token_as_str (&offset);
 	}
 
+	else if (!strcasecmp (option, "MessageStartMatch"))
+	{
+		g_free (option);
+		g_free (spell->msg.start_match);
+		if (spell->msg.start_regexp)
+			pcre2_code_free (spell->msg.start_regexp);
+
+		spell->msg.start_match = get_token_as_str (&offset);
+		spell->msg.start_regexp = spell_db_regexp_compile (spell,
+			spell->msg.start_match);
+	}
+
+	else if (!strcasecmp (option, "MessageEndMatch"))
+	{
+		g_free (option);
+		g_free (spell->msg.end_match);
+		if (spell->msg.end_regexp)
+			pcre2_code_free (spell->msg.end_regexp);
+
+		spell->msg.end_match = get_token_as_str (&offset);
+		spell->msg.end_regexp = spell_db_regexp_compile (spell,
+			spell->msg.end_match);
+	}
+
 	else if (!strcasecmp (option, "RecastTick"))
 	{
 		g_free (option);
@@ -384,6 +563,10 @@ static void spell_db_merge_active (gpointer data, gpointer user_data)
 			strcmp (spell->msg.end, old_spell->msg.end))
 			continue; /* end message mismatch */
 
+		if (g_strcmp0 (spell->msg.start_match, old_spell->msg.start_match) ||
+			g_strcmp0 (spell->msg.end_match, old_spell->msg.end_match))
+			continue; /* message regexp mismatch */
+
 		/* looks like we got a winner */
 		spell->lastcast = old_spell->lastcast;
 		spell->active   = old_spell->active;
@@ -21,6 +21,11 @@
 
 #include <glib.h>
 
+#ifndef PCRE2_CODE_UNIT_WIDTH
+#define PCRE2_CODE_UNIT_WIDTH 8
+#endif
+#include <pcre2.h>
+
 #define SPELL_FLAG(x)	(spell->flags & x)
 
 typedef struct
@@ -36,6 +41,10 @@ typedef struct
 	{
 		gchar *start;
 		gchar *end;
+		gchar *start_match;       /* regexp forms, eg: including the caster */
+		gchar *end_match;
+		pcre2_code *start_regexp; /* compiled start_match/end_match */
+		pcre2_code *end_regexp;
 	} msg;
 
 	struct
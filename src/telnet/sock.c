@@ -1,3 +1,5 @@
+#include <errno.h>
+#include <fcntl.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -5,6 +7,7 @@
 #include <unistd.h>
 #include <sys/socket.h>
 #include <netinet/in.h>
+#include <netinet/tcp.h>
 #include <arpa/inet.h>
 #include <netdb.h>
 
@@ -19,7 +22,32 @@
 #include "timers.h"
 #include "utils.h"
 
+static enum
+{
+	SRL_NORM, SRL_IAC, SRL_CMD, SRL_SB,
+	SRL_SBC,  SRL_SBS, SRL_SBI, SRL_SBZ
+} state;
+
+/* name lookup handed to the resolver thread, which passes it back
+ * through the notify pipe once getaddrinfo() returns */
+typedef struct
+{
+	char *host;
+	char *port;
+	struct addrinfo *res;
+	int err;
+} sockResolve_t;
+
+static sockResolve_t *resolving;     /* lookup the current attempt awaits */
+static struct addrinfo *addrs, *addr; /* resolved addresses, next to try */
+static int notify = -1;              /* write end of the notify pipe */
+
 static void sockReadLoopState (int c);
+static gpointer sockResolveThread(gpointer data);
+static void sockResolveFree(sockResolve_t *req);
+static void sockConnectNext(void);
+static void sockConnectDone(void);
+static void sockConnectFailed(int err);
 
 
 void sockClose(void)
@@ -58,69 +86,251 @@ void sockShutdown(void)
 
 int sockOpen(char *host, char *port)
 {
-	struct sockaddr_in sa;
-/*	struct in_addr inaddr; */
-	struct hostent *he_p;
-	int tmp;
+	sockResolve_t *req;
+	GThread *thread;
+	int fds[2];
 
-	memset(&sa, 0, sizeof(sa));
+	sockOpenCancel();
 
-#if 0 /* XXX this causes problems when DNS not available */
-	if(inet_aton(host,&inaddr))
-		he_p = gethostbyaddr((char *)&inaddr,sizeof(inaddr),AF_INET);
-	else
-#endif
-		he_p = gethostbyname(host);
+	if(sock.notify <= 0)
+	{
+		if(pipe(fds) < 0)
+		{
+			printt ("sock: pipe failed");
+			return 1;
+		}
+		fcntl(fds[0], F_SETFL, O_NONBLOCK);
+		sock.notify = fds[0];
+		notify = fds[1];
+	}
 
-	if(he_p == NULL)
+	req = g_new0(sockResolve_t, 1);
+	req->host = g_strdup(host);
+	req->port = g_strdup(port != NULL ? port : G_STRINGIFY(DEFAULT_PORT));
+
+	/* getaddrinfo() can block for as long as DNS takes, keep it off
+	 * the main loop */
+	thread = g_thread_try_new("resolver", sockResolveThread, req, NULL);
+	if(thread == NULL)
 	{
-		printt ("sock: failed looking up host '%s'", host);
+		printt ("sock: failed starting resolver");
+		sockResolveFree(req);
 		return 1;
 	}
+	g_thread_unref(thread);
+
+	resolving = req;
+	sock.state = SOCK_RESOLVING;
+
+	return 0;
+}
+
+
+/* collect finished lookups, returns nonzero once the attempt is over */
+int sockOpenResolved(void)
+{
+	sockResolve_t *req;
+
+	while(read(sock.notify, &req, sizeof(req)) == sizeof(req))
+	{
+		if(req != resolving)
+		{
+			sockResolveFree(req); /* lookup of a cancelled attempt */
+			continue;
+		}
+		resolving = NULL;
+
+		if(req->err)
+		{
+			printt ("sock: failed looking up host '%s': %s", req->host,
+				gai_strerror(req->err));
+			sockResolveFree(req);
+			sock.state = SOCK_IDLE;
+			return 1;
+		}
+
+		addrs = addr = req->res;
+		req->res = NULL;
+		sockResolveFree(req);
 
-	sa.sin_family = AF_INET;
-	if(port != NULL)
-		sa.sin_port = htons(atoi(port));
+		sockConnectNext();
+	}
+
+	return !sockIsPending();
+}
+
+
+/* sock.fd became writable, returns nonzero once the attempt is over */
+int sockOpenConnected(void)
+{
+	socklen_t len;
+	int err;
+
+	if(sock.state != SOCK_CONNECTING)
+		return !sockIsPending();
+
+	err = 0;
+	len = sizeof(err);
+	if(getsockopt(sock.fd, SOL_SOCKET, SO_ERROR, &err, &len) < 0)
+		err = errno;
+
+	if(err == EINPROGRESS)
+		return 0;
+
+	if(err)
+		sockConnectFailed(err);
 	else
-		sa.sin_port = htons(DEFAULT_PORT);
+		sockConnectDone();
+
+	return !sockIsPending();
+}
 
-	memcpy(&sa.sin_addr,he_p->h_addr_list[0],sizeof(sa.sin_addr));
 
-	sock.fd = socket(AF_INET, SOCK_STREAM, 0);
-	if(sock.fd < 0)
+/* the connect timer ran out, returns nonzero once the attempt is over */
+int sockOpenTimeout(void)
+{
+	if(sock.state == SOCK_CONNECTING && addr->ai_next != NULL)
 	{
-		printt ("sock: socket error");
-		return 1;
+		sockConnectFailed(ETIMEDOUT);
+		return !sockIsPending();
 	}
 
-	tmp = 1;
-	if(setsockopt(sock.fd, SOL_SOCKET, SO_OOBINLINE, &tmp, sizeof(tmp)) < 0)
+	if(sockIsPending())
+		printt ("sock: connect timed out");
+
+	sockOpenCancel();
+	return 1;
+}
+
+
+void sockOpenCancel(void)
+{
+	/* a lookup in flight is freed once it reports back */
+	resolving = NULL;
+
+	if(sock.state == SOCK_CONNECTING && sock.fd > 0)
 	{
-		printt ("sock: setsockopt failed");
-		sockClose();
-		return 1;
+		close(sock.fd);
+		sock.fd = 0;
 	}
 
-	if(connect(sock.fd, (struct sockaddr *)&sa, sizeof(sa)) < 0)
+	if(addrs != NULL)
+		freeaddrinfo(addrs);
+	addrs = addr = NULL;
+
+	sock.state = SOCK_IDLE;
+}
+
+
+static gpointer sockResolveThread(gpointer data)
+{
+	sockResolve_t *req = data;
+	struct addrinfo hints;
+
+	memset(&hints, 0, sizeof(hints));
+	hints.ai_family = AF_UNSPEC;
+	hints.ai_socktype = SOCK_STREAM;
+
+	req->err = getaddrinfo(req->host, req->port, &hints, &req->res);
+
+	/* pointer sized writes to a pipe are atomic */
+	if(write(notify, &req, sizeof(req)) != sizeof(req))
+		sockResolveFree(req);
+
+	return NULL;
+}
+
+
+static void sockResolveFree(sockResolve_t *req)
+{
+	if(req->res != NULL)
+		freeaddrinfo(req->res);
+	g_free(req->host);
+	g_free(req->port);
+	g_free(req);
+}
+
+
+/* start connecting to addr, moving on to the following addresses
+ * until one is underway */
+static void sockConnectNext(void)
+{
+	int tmp, flags;
+
+	for(; addr != NULL; addr = addr->ai_next)
 	{
-		printt ("sock: connect failed");
-		sockShutdown();
-		return 1;
+		sock.fd = socket(addr->ai_family, addr->ai_socktype, addr->ai_protocol);
+		if(sock.fd < 0)
+		{
+			sock.fd = 0;
+			continue;
+		}
+
+		/* commands are flushed whole, no need to wait for Nagle */
+		tmp = 1;
+		if(setsockopt(sock.fd, SOL_SOCKET, SO_OOBINLINE, &tmp, sizeof(tmp)) < 0
+			|| setsockopt(sock.fd, IPPROTO_TCP, TCP_NODELAY, &tmp, sizeof(tmp)) < 0
+			|| (flags = fcntl(sock.fd, F_GETFL)) < 0
+			|| fcntl(sock.fd, F_SETFL, flags | O_NONBLOCK) < 0)
+		{
+			printt ("sock: setsockopt failed");
+			close(sock.fd);
+			sock.fd = 0;
+			continue;
+		}
+
+		sock.state = SOCK_CONNECTING;
+
+		if(connect(sock.fd, addr->ai_addr, addr->ai_addrlen) == 0)
+		{
+			sockConnectDone();
+			return;
+		}
+
+		if(errno == EINPROGRESS)
+			return; /* wait for sock.fd to become writable */
+
+		sockConnectFailed(errno);
+		return;
 	}
 
+	printt ("sock: connect failed");
+	sockOpenCancel();
+}
+
+
+static void sockConnectDone(void)
+{
+	/* back to the blocking socket sockBuf expects */
+	fcntl(sock.fd, F_SETFL, fcntl(sock.fd, F_GETFL) & ~O_NONBLOCK);
+
+	sock.state = SOCK_IDLE;
+	sockOpenCancel(); /* frees the address list */
 	sock.alive = 1;
+}
 
-	return 0;
+
+/* report a failed address and try the next one */
+static void sockConnectFailed(int err)
+{
+	char host[NI_MAXHOST];
+
+	if(getnameinfo(addr->ai_addr, addr->ai_addrlen, host, sizeof(host),
+		NULL, 0, NI_NUMERICHOST))
+		strcpy(host, "?");
+
+	printt ("sock: connect to %s failed: %s", host, strerror(err));
+
+	close(sock.fd);
+	sock.fd = 0;
+	sock.state = SOCK_IDLE;
+
+	addr = addr->ai_next;
+	sockConnectNext();
 }
 
 static void sockReadLoopState (int c)
 {
-	static enum
-	{
-		SRL_NORM, SRL_IAC, SRL_CMD, SRL_SB,
-		SRL_SBC,  SRL_SBS, SRL_SBI
-	} state;
-
 	static int cmd;
 	static int opt;
 
@@ -156,7 +366,10 @@ static void sockReadLoopState (int c)
 		state = SRL_SBC;
 		break;
 	case SRL_SBC:
-		state = (c == TELQUAL_SEND)? SRL_SBS : SRL_NORM;
+		if(opt == TELOPT_COMPRESS2 && c == IAC)
+			state = SRL_SBZ;
+		else
+			state = (c == TELQUAL_SEND)? SRL_SBS : SRL_NORM;
 		break;
 	case SRL_SBS:
 		state = (c == IAC)? SRL_SBI : SRL_NORM;
@@ -165,6 +378,12 @@ static void sockReadLoopState (int c)
 		telOptSBHandle (opt);
 		state = SRL_NORM;
 		break;
+	case SRL_SBZ:
+		/* IAC SB COMPRESS2 IAC SE, compressed from here on */
+		if(c == SE && telOpt.compress)
+			sockBufZStart();
+		state = SRL_NORM;
+		break;
 	default:
 		if (c == IAC) state = SRL_IAC;
 		else terminal_sequence_read (c);
@@ -173,8 +392,26 @@ static void sockReadLoopState (int c)
 
 void sockReadLoop(void)
 {
+	uchar *run, *iac;
 	int c;
 
-	while((c = getSock1()) >= 0)
-		sockReadLoopState (c);
+	do
+	{
+		while(sockBufR.ptr < sockBufR.end)
+		{
+			if(state == SRL_NORM && *sockBufR.ptr != IAC)
+			{
+				/* everything up to the next IAC goes to the terminal at once */
+				run = sockBufR.ptr;
+				iac = memchr(run, IAC, sockBufR.end - run);
+				sockBufR.ptr = iac ? iac : sockBufR.end;
+
+				terminal_write(run, sockBufR.ptr - run);
+				continue;
+			}
+
+			c = getSock1();
+			sockReadLoopState (c);
+		}
+	} while(sockBufZFill()); /* more waiting to be inflated */
 }
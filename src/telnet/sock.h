@@ -16,18 +16,36 @@
 #define OPT_REMOTE_SGA          2
 #define OPT_REMOTE_ECHO         2
 
+/* 0: accept MCCP v2 when offered   1: refuse it */
+#define OPT_REMOTE_COMPRESS2    0
+
 #define DEFAULT_PORT	23
 #define sockIsAlive()	(sock.alive)
+#define sockIsPending()	(sock.state != SOCK_IDLE)
+
+/* progress of a connection attempt started by sockOpen() */
+enum
+{
+	SOCK_IDLE,       /* connected or not trying to be */
+	SOCK_RESOLVING,  /* waiting on the resolver, sock.notify */
+	SOCK_CONNECTING  /* waiting on connect(), sock.fd writable */
+};
 
 struct
 {
 	int fd;
 	int alive;
+	int state;
+	int notify;
 } sock;
 
 void sockClose(void);
 void sockShutdown(void);
 int sockOpen(char *host, char *port);
+int sockOpenResolved(void);
+int sockOpenConnected(void);
+int sockOpenTimeout(void);
+void sockOpenCancel(void);
 void sockReadLoop(void);
 
 #endif /* __SOCK_H__ */
@@ -1,29 +1,75 @@
+#include <errno.h>
 #include <stdio.h>
+#include <string.h>
 #include <sys/types.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
+#include <zlib.h>
 
 #include "mudpro.h"
 #include "sock.h"
 #include "sockbuf.h"
 #include "terminal.h"
 
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+/* compressed input waiting to be inflated, or plain input left over
+ * from the end of a stream, always handed to sockBufR before new input */
+static struct
+{
+	z_stream zs;
+	int active;
+	uchar buf[SOCKBUFR_SIZE];
+	uchar *ptr;
+	uchar *end;
+} sockBufZ;
+
+static int sockBufWGrow(size_t n);
+static void sockBufWQueued(size_t n);
+static void sockBufClosed(int l);
+
 
 void sockBufRead(void)
 {
+	uchar *buf;
+	size_t size;
 	int l;
 
-	l = recv(sock.fd, sockBufR.buf, sizeof(sockBufR.buf), 0);
+	if(sockBufZ.ptr < sockBufZ.end || sockBufZ.active)
+	{
+		/* keep what is still waiting, receive behind it */
+		l = sockBufZ.end - sockBufZ.ptr;
+		memmove(sockBufZ.buf, sockBufZ.ptr, l);
+		sockBufZ.ptr = sockBufZ.buf;
+		sockBufZ.end = sockBufZ.buf + l;
+
+		buf = sockBufZ.end;
+		size = sizeof(sockBufZ.buf) - l;
+		if(size == 0)
+			return; /* sockReadLoop() has not caught up */
+	}
+	else
+	{
+		buf = sockBufR.buf;
+		size = sizeof(sockBufR.buf);
+	}
+
+	l = recv(sock.fd, buf, size, 0);
 	if(l <= 0)
 	{
-		sock.alive = 0;
+		sockBufClosed(l);
+		return;
+	}
 
-		mudpro_reset_state (TRUE /* disconnected */);
-#if 0
-		if(l == 0)
-			printt ("sock: connection closed by peer");
-		else
-			printt ("sock: recv failed");
-#endif
+	sockBufR.stats.received += l;
+
+	if(buf != sockBufR.buf)
+	{
+		sockBufZ.end += l;
+		sockBufR.ptr = sockBufR.end = sockBufR.buf;
+		sockBufZFill();
 		return;
 	}
 
@@ -32,15 +78,145 @@ void sockBufRead(void)
 }
 
 
+static void sockBufClosed(int l)
+{
+	sock.alive = 0;
+
+	mudpro_reset_state (TRUE /* disconnected */);
+#if 0
+	if(l == 0)
+		printt ("sock: connection closed by peer");
+	else
+		printt ("sock: recv failed");
+#endif
+}
+
+
+/* the unread part of sockBufR is the start of a zlib stream */
+void sockBufZStart(void)
+{
+	size_t n, waiting;
+
+	if(sockBufZ.active)
+		return;
+
+	memset(&sockBufZ.zs, 0, sizeof(sockBufZ.zs));
+	if(inflateInit(&sockBufZ.zs) != Z_OK)
+	{
+		printt ("sock: failed starting MCCP");
+		return;
+	}
+
+	/* sockBufR may itself hold input left over from an earlier stream,
+	 * the rest of which is still in sockBufZ, so the two fit together */
+	n = sockBufR.end - sockBufR.ptr;
+	waiting = sockBufZ.end - sockBufZ.ptr;
+
+	memmove(sockBufZ.buf + n, sockBufZ.ptr, waiting);
+	memcpy(sockBufZ.buf, sockBufR.ptr, n);
+	sockBufZ.ptr = sockBufZ.buf;
+	sockBufZ.end = sockBufZ.buf + n + waiting;
+
+	sockBufR.ptr = sockBufR.end;
+	sockBufZ.active = 1;
+	sockBufR.stats.streams++;
+}
+
+
+/* refill an empty sockBufR from sockBufZ, returns nonzero on progress */
+int sockBufZFill(void)
+{
+	uchar *ptr;
+	size_t n;
+	int ret;
+
+	if(sockBufZ.ptr >= sockBufZ.end)
+		return 0;
+
+	sockBufR.ptr = sockBufR.end = sockBufR.buf;
+
+	if(!sockBufZ.active)
+	{
+		/* stream ended, what followed it is plain */
+		n = MIN(sockBufZ.end - sockBufZ.ptr, sizeof(sockBufR.buf));
+		memcpy(sockBufR.buf, sockBufZ.ptr, n);
+		sockBufZ.ptr += n;
+		sockBufR.end += n;
+		return 1;
+	}
+
+	ptr = sockBufZ.ptr;
+
+	sockBufZ.zs.next_in = sockBufZ.ptr;
+	sockBufZ.zs.avail_in = sockBufZ.end - sockBufZ.ptr;
+	sockBufZ.zs.next_out = sockBufR.buf;
+	sockBufZ.zs.avail_out = sizeof(sockBufR.buf);
+
+	ret = inflate(&sockBufZ.zs, Z_SYNC_FLUSH);
+
+	sockBufZ.ptr = sockBufZ.zs.next_in;
+	sockBufR.end = sockBufZ.zs.next_out;
+
+	sockBufR.stats.compressed += sockBufZ.ptr - ptr;
+	sockBufR.stats.inflated += sockBufR.end - sockBufR.buf;
+
+	if(ret == Z_STREAM_END)
+	{
+		inflateEnd(&sockBufZ.zs);
+		sockBufZ.active = 0;
+	}
+	else if(ret != Z_OK && ret != Z_BUF_ERROR)
+	{
+		printt ("sock: MCCP stream corrupt");
+		sockBufZEnd();
+		sockBufR.ptr = sockBufR.end = sockBufR.buf;
+		sockBufClosed(-1);
+		return 0;
+	}
+
+	return sockBufZ.ptr > ptr || sockBufR.end > sockBufR.buf;
+}
+
+
+void sockBufZEnd(void)
+{
+	if(sockBufZ.active)
+		inflateEnd(&sockBufZ.zs);
+
+	sockBufZ.active = 0;
+	sockBufZ.ptr = sockBufZ.end = sockBufZ.buf;
+}
+
+
+/* send what the socket takes without blocking, the rest waits for the
+ * I/O loop to see sock.fd writable */
 void sockBufWrite(void)
 {
-	int wl, l;
+	struct iovec iov[2];
+	struct msghdr msg;
+	size_t first;
+	gint64 latency;
+	ssize_t l;
 
-	wl = sockBufW.ptr - sockBufW.top;
-	if(wl == 0)
+	if(sockBufW.len == 0)
 		return;
 
-	l = send(sock.fd, sockBufW.top, wl, 0);
+	first = MIN(sockBufW.len, sockBufW.size - sockBufW.head);
+	iov[0].iov_base = sockBufW.buf + sockBufW.head;
+	iov[0].iov_len = first;
+	iov[1].iov_base = sockBufW.buf;
+	iov[1].iov_len = sockBufW.len - first;
+
+	memset(&msg, 0, sizeof(msg));
+	msg.msg_iov = iov;
+	msg.msg_iovlen = iov[1].iov_len ? 2 : 1;
+
+	l = sendmsg(sock.fd, &msg, MSG_DONTWAIT | MSG_NOSIGNAL);
+	if(l < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR))
+	{
+		sockBufW.stats.partial++;
+		return;
+	}
 	if(l <= 0)
 	{
 		sock.alive = 0;
@@ -54,14 +230,50 @@ void sockBufWrite(void)
 #endif
 		return;
 	}
-	else if(l < wl)
+
+	sockBufW.head = (sockBufW.head + l) % sockBufW.size;
+	sockBufW.len -= l;
+	sockBufW.stats.sent += l;
+
+	if(sockBufW.len > 0)
 	{
-		sockBufW.top += l;
-		return; /* need retry? */
+		sockBufW.stats.partial++;
+		return;
 	}
 
-	sockBufW.ptr = sockBufW.top = sockBufW.buf;
-	sockBufW.stop = 0;
+	sockBufW.head = 0;
+	sockBufW.stats.flushes++;
+
+	latency = g_get_monotonic_time() - sockBufW.since;
+	sockBufW.stats.latency += latency;
+	if(latency > sockBufW.stats.latency_max)
+		sockBufW.stats.latency_max = latency;
+}
+
+
+void sockBufReport(FILE *fp)
+{
+	fprintf(fp, "\nSOCKET BUFFER\n"
+				"=============\n\n");
+
+	fprintf(fp, "  Bytes Received .......... %lu\n", sockBufR.stats.received);
+	fprintf(fp, "  MCCP Streams ............ %lu\n", sockBufR.stats.streams);
+	fprintf(fp, "  MCCP Compressed Bytes ... %lu\n", sockBufR.stats.compressed);
+	fprintf(fp, "  MCCP Inflated Bytes ..... %lu\n", sockBufR.stats.inflated);
+	fprintf(fp, "  Write Buffer Size ....... %lu\n", (unsigned long) sockBufW.size);
+	fprintf(fp, "  Bytes Waiting ........... %lu\n", (unsigned long) sockBufW.len);
+	fprintf(fp, "  Bytes Queued ............ %lu\n", sockBufW.stats.queued);
+	fprintf(fp, "  Bytes Sent .............. %lu\n", sockBufW.stats.sent);
+	fprintf(fp, "  Bytes Dropped ........... %lu\n", sockBufW.stats.dropped);
+	fprintf(fp, "  Buffer Reallocations .... %lu\n", sockBufW.stats.grown);
+	fprintf(fp, "  Partial Writes .......... %lu\n", sockBufW.stats.partial);
+	fprintf(fp, "  Flushes ................. %lu\n", sockBufW.stats.flushes);
+
+	if(sockBufW.stats.flushes)
+		fprintf(fp, "  Flush Latency Avg ....... %ldus\n",
+			(long) (sockBufW.stats.latency / sockBufW.stats.flushes));
+	fprintf(fp, "  Flush Latency Max ....... %ldus\n",
+		(long) sockBufW.stats.latency_max);
 }
 
 
@@ -70,22 +282,77 @@ void putSock1(uchar c)
 	if (!sockIsAlive ())
 		return;
 
-	if(sockBufW.ptr >= sockBufW.buf + SOCKBUFW_SIZE)
+	if(!sockBufWGrow(1))
+		return;
+
+	sockBufWQueued(1);
+	sockBufW.buf[(sockBufW.head + sockBufW.len++) % sockBufW.size] = c;
+}
+
+
+void putSockN(const char *cp, int n)
+{
+	size_t tail, first;
+
+	if (!sockIsAlive () || n <= 0)
+		return;
+
+	if(!sockBufWGrow(n))
+		return;
+
+	sockBufWQueued(n);
+
+	tail = (sockBufW.head + sockBufW.len) % sockBufW.size;
+	first = MIN((size_t) n, sockBufW.size - tail);
+	memcpy(sockBufW.buf + tail, cp, first);
+	memcpy(sockBufW.buf, cp + first, n - first);
+	sockBufW.len += n;
+}
+
+
+/* make room for n more bytes, unwrapping the ring into larger storage */
+static int sockBufWGrow(size_t n)
+{
+	uchar *buf;
+	size_t size, first;
+
+	if(sockBufW.len + n <= sockBufW.size)
+		return 1;
+
+	size = sockBufW.size ? sockBufW.size : SOCKBUFW_SIZE;
+	while(size < sockBufW.len + n)
+		size *= 2;
+
+	if(size > SOCKBUFW_SIZE_MAX)
 	{
-		if(sockBufW.ptr >= sockBufW.buf + SOCKBUFW_SIZE_A)
-		{
+		if(!sockBufW.stats.dropped)
 			printt ("sockBufW overrun");
-			return;
-		}
-		else
-			sockBufW.stop = 1; /* flow control */
+		sockBufW.stats.dropped += n;
+		return 0;
 	}
-	*sockBufW.ptr++ = c;
+
+	buf = g_malloc(size);
+
+	if(sockBufW.len)
+	{
+		first = MIN(sockBufW.len, sockBufW.size - sockBufW.head);
+		memcpy(buf, sockBufW.buf + sockBufW.head, first);
+		memcpy(buf + first, sockBufW.buf, sockBufW.len - first);
+	}
+
+	g_free(sockBufW.buf);
+	sockBufW.buf = buf;
+	sockBufW.size = size;
+	sockBufW.head = 0;
+	sockBufW.stats.grown++;
+
+	return 1;
 }
 
 
-void putSockN(const char *cp, int n)
+static void sockBufWQueued(size_t n)
 {
-	for(; n > 0; n--,cp++)
-		putSock1(*cp);
+	if(sockBufW.len == 0)
+		sockBufW.since = g_get_monotonic_time();
+	sockBufW.stats.queued += n;
 }
@@ -1,6 +1,9 @@
 #ifndef __SOCKBUF_H__
 #define __SOCKBUF_H__
 
+#include <stdio.h>
+#include <glib.h>
+
 typedef unsigned char uchar;
 
 #define SOCKBUFR_SIZE 16384
@@ -12,33 +15,65 @@ struct
 	uchar buf[SOCKBUFR_SIZE];
 	uchar *ptr;
 	uchar *end;
+
+	struct
+	{
+		unsigned long received;		/* bytes off the socket */
+		unsigned long compressed;	/* of those, inflated from MCCP streams */
+		unsigned long inflated;		/* bytes the MCCP streams expanded to */
+		unsigned long streams;		/* MCCP streams started */
+	} stats;
 } sockBufR;
 
-#define sockBufRReset()		{ sockBufR.ptr = sockBufR.end = sockBufR.buf; }
+#define sockBufRReset() \
+	{ sockBufR.ptr = sockBufR.end = sockBufR.buf; sockBufZEnd(); }
 #define sockBufRHasData()	(sockBufR.ptr > sockBufR.buf)
 #define getSock1()			((sockBufR.ptr >= sockBufR.end)? -1 : *sockBufR.ptr++)
 
 void sockBufRead(void);
 
+/* == MCCP v2 ============================================================ */
+
+/* once the server sends IAC SB COMPRESS2 IAC SE everything after it is a
+ * zlib stream, received into a buffer of its own and inflated into
+ * sockBufR as sockReadLoop() drains it */
+
+void sockBufZStart(void);
+int sockBufZFill(void);
+void sockBufZEnd(void);
+
 /* == writing socket ==================================================== */
 
-#define SOCKBUFW_SIZE		1024
-#define SOCKBUFW_SIZE_A		(SOCKBUFW_SIZE * 2)
+#define SOCKBUFW_SIZE		1024	/* initial ring size, doubled as needed */
+#define SOCKBUFW_SIZE_MAX	(1024 * 1024)
 
 struct
 {
-	uchar buf[SOCKBUFW_SIZE_A];
-	uchar *top;
-	uchar *ptr;
-	int stop;
+	uchar *buf;		/* ring of size bytes, len of them from head waiting */
+	size_t size;
+	size_t head;
+	size_t len;
+	gint64 since;	/* when the ring last went from empty to queued */
+
+	struct
+	{
+		unsigned long queued;	/* bytes queued */
+		unsigned long sent;		/* bytes sent */
+		unsigned long dropped;	/* bytes lost past SOCKBUFW_SIZE_MAX */
+		unsigned long grown;	/* ring reallocations */
+		unsigned long partial;	/* flushes left waiting on the socket */
+		unsigned long flushes;	/* times the ring drained */
+		gint64 latency;			/* usec from queued to drained, total */
+		gint64 latency_max;
+	} stats;
 } sockBufW;
 
-#define sockBufWReset() \
-	{ sockBufW.ptr = sockBufW.top = sockBufW.buf; sockBufW.stop = 0; }
-#define sockBufWHasData()	(sockBufW.ptr > sockBufW.buf)
-#define sockBufWReady()		(!sockBufW.stop)
+#define sockBufWReset()		{ sockBufW.head = sockBufW.len = 0; }
+#define sockBufWHasData()	(sockBufW.len > 0)
+#define sockBufWReady()		(sockBufW.len < SOCKBUFW_SIZE)
 
 void sockBufWrite(void);
+void sockBufReport(FILE *fp);
 void putSock1(uchar c);
 void putSockN(const char *cp, int n);
 
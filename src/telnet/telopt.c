@@ -18,10 +18,11 @@ static TelOptStates stTabMaster[] = {
 	{ TELOPT_ECHO,		{TOR_MUSTNOT},	{TOR_BETTER}	}, /* 1 */
     { TELOPT_SGA,		{TOR_BETTER},	{TOR_MUST}		}, /* 3 */
     { TELOPT_TTYPE,		{TOR_NEUTRAL},	{TOR_MUSTNOT}	}, /* 24 */
+    { TELOPT_COMPRESS2,	{TOR_MUSTNOT},	{TOR_NEUTRAL}	}, /* 86 */
     { -1,				{TOR_MUSTNOT},	{TOR_MUSTNOT}	}  /* default state */
 };
 
-TelOptStates *stTab[NTELOPTS]; /* telOptInit() makes it usable */
+TelOptStates *stTab[TELOPT_TABSIZE]; /* telOptInit() makes it usable */
 
 static /*const*/ TelOptStates *defaultSt; /* used when unknown options come */
 
@@ -41,7 +42,8 @@ void telOptReset(void)
 
     telOpt.binsend =
     telOpt.binrecv =
-    telOpt.sgasend = 0;
+    telOpt.sgasend =
+    telOpt.compress = 0;
     telOpt.sentReqs = 0;
 }
 
@@ -53,7 +55,7 @@ void telOptInit(void)
     int i;
 
     for(tosp = stTabMaster; tosp->opt >= 0; tosp++) ;
-    for(i = 0; i < NTELOPTS; i++) stTab[i] = tosp; /* default entry */
+    for(i = 0; i < TELOPT_TABSIZE; i++) stTab[i] = tosp; /* default entry */
     defaultSt = tosp;
     for(tosp-- ; tosp >= stTabMaster; tosp--)
 		stTab[tosp->opt] = tosp;
@@ -71,6 +73,8 @@ static void setReqs(void)
 	stTab[TELOPT_ECHO]->remote.req = OPT_REMOTE_ECHO;
 	/* terminal-type response control */
 	stTab[TELOPT_TTYPE]->local.req = OPT_LOCAL_TTYPE ? TOR_MUSTNOT : TOR_NEUTRAL;
+	/* MCCP v2 control, only ever offered by the server */
+	stTab[TELOPT_COMPRESS2]->remote.req = OPT_REMOTE_COMPRESS2 ? TOR_MUSTNOT : TOR_NEUTRAL;
 }
 
 
@@ -135,6 +139,7 @@ static void telOptSummarize(void)
     telOpt.binsend = stTab[TELOPT_BINARY]->local.state;
     telOpt.binrecv = stTab[TELOPT_BINARY]->remote.state;
     telOpt.sgasend = stTab[TELOPT_SGA]->remote.state;
+    telOpt.compress = stTab[TELOPT_COMPRESS2]->remote.state;
 }
 
 
@@ -151,7 +156,7 @@ int telOptHandle(int cmd, int opt)
     TelOptReq betterAssert;	/* better assert if req is this */
     TelOptReq mustAssert;	/* must assert if req is this */
 
-    tosp = (opt < NTELOPTS)? stTab[opt] : defaultSt;
+    tosp = (opt < TELOPT_TABSIZE)? stTab[opt] : defaultSt;
 
     switch(cmd)
 	{
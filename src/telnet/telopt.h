@@ -4,6 +4,13 @@
 #include <arpa/telnet.h>
 #include "sockbuf.h"
 
+#ifndef TELOPT_COMPRESS2
+#define TELOPT_COMPRESS2	86	/* MCCP v2 */
+#endif
+
+/* stTab[] covers every option byte, not just those up to NTELOPTS */
+#define TELOPT_TABSIZE		256
+
 /* requirements for a telnet option */
 typedef enum
 {
@@ -34,6 +41,7 @@ struct
 	int binsend;	/* local binary opt is enabled */
 	int binrecv;	/* remote binary opt is enabled */
 	int sgasend;	/* local SGA opt is enabled (char-at-a-time mode) */
+	int compress;	/* remote COMPRESS2 opt is enabled (MCCP v2) */
 	int sentReqs;	/* have sent option requests to the peer */
 					/* or skip sending them */
 	TelOptStates **stTab; /* = stTab[] in telopt.c */
@@ -36,7 +36,9 @@ ui_charset_t widget_ui;
 gint palette[FG_COLORS][BG_COLORS];
 
 static sequence_t seq;
+static enum { S_NORM, S_ESC, S_CSI } seq_state = S_NORM;
 
+static void terminal_put_run (const gchar *str, gsize length);
 static void terminal_sequence_dispatch (void);
 
 
@@ -268,6 +270,66 @@ void terminal_put (gint ch)
 }
 
 
+/* =========================================================================
+ = TERMINAL_PUT_RUN
+ =
+ = Prints a run of printable ASCII to the terminal, in bulk wherever the
+ = line buffer can take it without per-byte handling
+ ======================================================================== */
+
+static void terminal_put_run (const gchar *str, gsize length)
+{
+	attr_t attrs;
+	short pair;
+	gsize n;
+
+	while (length)
+	{
+		if ((n = parse_line_buffer_run (str, length)) == 0)
+		{
+			terminal_put ((guchar) *str++);
+			length--;
+			continue;
+		}
+
+		/* as waddch() would combine terminal.attr with the window's */
+		wattr_get (terminal.w, &attrs, &pair, NULL);
+		wattrset (terminal.w, (terminal.attr & A_COLOR) ?
+			(attrs & ~A_COLOR) | terminal.attr : attrs | terminal.attr);
+		waddnstr (terminal.w, str, n);
+		wattr_set (terminal.w, attrs, pair, NULL);
+
+		str += n;
+		length -= n;
+	}
+}
+
+
+/* =========================================================================
+ = TERMINAL_WRITE
+ =
+ = Handles data from the server (telnet commands already removed), taking
+ = runs of plain text at a time
+ ======================================================================== */
+
+void terminal_write (const guchar *buf, gsize length)
+{
+	const guchar *end = buf + length, *run;
+
+	while (buf < end)
+	{
+		if (seq_state != S_NORM || *buf < 32 || *buf > 126)
+		{
+			terminal_sequence_read (*buf++);
+			continue;
+		}
+
+		for (run = buf; buf < end && *buf > 31 && *buf < 127; buf++);
+		terminal_put_run ((const gchar *) run, buf - run);
+	}
+}
+
+
 /* =========================================================================
  = TERMINAL_SEQUENCE_READ
  =
@@ -276,19 +338,17 @@ void terminal_put (gint ch)
 
 void terminal_sequence_read (gint ch)
 {
-	static enum { S_NORM, S_ESC, S_CSI } state = S_NORM;
-
-	switch (state)
+	switch (seq_state)
 	{
 	case S_ESC:
 		if (ch == '[')
 		{
 			memset (&seq, 0, sizeof (sequence_t));
 			seq.params = 0;
-			state = S_CSI;
+			seq_state = S_CSI;
 		}
 		else
-			state = S_NORM;
+			seq_state = S_NORM;
 		break;
 
 	case S_CSI:
@@ -326,13 +386,13 @@ void terminal_sequence_read (gint ch)
 			printt ("DEBUG: Unhandled sequence: %d (0x%x)", ch, ch);
 #endif
 		}
-		state = S_NORM;
+		seq_state = S_NORM;
 		terminal_sequence_dispatch ();
 		break;
 
 	case S_NORM:
 		if (ch == 0x1B) /* escape */
-			state = S_ESC;
+			seq_state = S_ESC;
 		else if (ch == 0x11) /* XON */
 			/* for some reason MMUD sends these while drawing 'train stats' */
 			/* the space is put so that everything is displayed correctly */
@@ -100,6 +100,7 @@ void terminal_palette_init (void);
 void terminal_charset_init (void);
 void terminal_set_title (gchar *fmt, ...);
 void terminal_put (gint ch);
+void terminal_write (const guchar *buf, gsize length);
 void terminal_sequence_read (gint ch);
 void terminal_resize (void);
 void printt (gchar *fmt, ...);
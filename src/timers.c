@@ -46,7 +46,10 @@
 gint connect_wait;
 timers_t timers;
 
+static gboolean refresh_pending = FALSE;
+
 static void timers_db_update (void);
+static void timers_deadline (_timer_t *timer, gulong timeout, gulong *next);
 
 
 /* =========================================================================
@@ -243,7 +246,17 @@ void timers_update (void)
     /* connection timer */
     sec = (gulong) timer_elapsed (timers.connect, &usec);
 
-    if ((sec >= connect_wait) && !sockIsAlive () && !character.flag.disconnected)
+    if (sockIsPending ())
+    {
+        /* connection attempt in progress, give up on slow addresses */
+        if (sec >= TIMEOUT_SEC_CONNECT)
+        {
+            timer_reset (timers.connect);
+            if (sockOpenTimeout ())
+                mudpro_connect_finish ();
+        }
+    }
+    else if ((sec >= connect_wait) && !sockIsAlive () && !character.flag.disconnected)
     {
         if (connect_wait)
         {
@@ -294,7 +307,10 @@ void timers_update (void)
     {
         doupdate ();
         timer_reset (timers.refresh);
+        refresh_pending = FALSE;
     }
+    else
+        refresh_pending = TRUE; /* flush once the throttle allows */
 
     /* game rounds */
     sec = (gulong) timer_elapsed (timers.round, &usec);
@@ -312,7 +328,26 @@ void timers_update (void)
         /* update pending party requests */
         party_request_update ();
 
-        if (!sockIsAlive () && (connect_wait > 0))
+        if (sockIsPending ())
+        {
+            gint y, x;
+            gchar *buf;
+
+            /* display connection progress */
+            getyx (terminal.w, y, x);
+            wmove (terminal.w, y, 0);
+            wclrtoeol (terminal.w);
+            wattrset (terminal.w, ATTR_NOTICE | A_BOLD);
+
+            buf = g_strdup_printf ("[%s %s (%d seconds)]",
+                (sock.state == SOCK_RESOLVING) ? "Resolving" : "Connecting to",
+                character.hostname, (gint) timer_elapsed (timers.connect, NULL));
+
+            waddstr (terminal.w, buf);
+            wattrset (terminal.w, terminal.attr);
+            g_free (buf);
+        }
+        else if (!sockIsAlive () && (connect_wait > 0))
         {
             gint y, x;
             gchar *buf;
@@ -370,6 +405,67 @@ void timers_update (void)
 }
 
 
+/* =========================================================================
+ = TIMERS_NEXT_TIMEOUT
+ =
+ = Microseconds until timers_update() next has work to do
+ ======================================================================== */
+
+gulong timers_next_timeout (void)
+{
+    gulong next = command_timers_next_timeout ();
+
+    timers_deadline (timers.dbupdate, TIMEOUT_SEC_DBUPDATE * G_USEC_PER_SEC, &next);
+    timers_deadline (timers.castwait, TIMEOUT_SEC_CASTWAIT * G_USEC_PER_SEC, &next);
+    timers_deadline (timers.client_ai, TIMEOUT_USEC_CLIENT_AI, &next);
+    timers_deadline (timers.idle, TIMEOUT_SEC_IDLE * G_USEC_PER_SEC, &next);
+    timers_deadline (timers.player_anim, TIMEOUT_USEC_PLAYER_ANIM, &next);
+    timers_deadline (timers.status, TIMEOUT_SEC_STATUS * G_USEC_PER_SEC, &next);
+    timers_deadline (timers.osd_stats, TIMEOUT_SEC_OSD_STATS * G_USEC_PER_SEC, &next);
+    timers_deadline (timers.recall, TIMEOUT_SEC_RECALL * G_USEC_PER_SEC, &next);
+    timers_deadline (timers.parcmd, character.wait.parcmd * G_USEC_PER_SEC, &next);
+
+    /* only wake for a refresh when there is something left to flush */
+    if (refresh_pending)
+        timers_deadline (timers.refresh, TIMEOUT_USEC_REFRESH, &next);
+
+    if (sockIsPending ())
+        timers_deadline (timers.connect, TIMEOUT_SEC_CONNECT * G_USEC_PER_SEC, &next);
+    else if (!sockIsAlive () && !character.flag.disconnected)
+    {
+        /* a stopped connect timer is started by the status update */
+        if (timer_elapsed (timers.connect, NULL) >= connect_wait)
+            next = 0;
+        else
+            timers_deadline (timers.connect, connect_wait * G_USEC_PER_SEC, &next);
+    }
+
+    return next;
+}
+
+
+/* =========================================================================
+ = TIMERS_DEADLINE
+ =
+ = Lower next to the time remaining until a running timer reaches timeout
+ ======================================================================== */
+
+static void timers_deadline (_timer_t *timer, gulong timeout, gulong *next)
+{
+    gulong elapsed;
+
+    if (!timer->running)
+        return; /* stopped timers never elapse */
+
+    elapsed = (gulong) (timer_elapsed (timer, NULL) * G_USEC_PER_SEC);
+
+    if (elapsed >= timeout)
+        *next = 0;
+    else
+        *next = MIN (*next, timeout - elapsed);
+}
+
+
 /* =========================================================================
  = TIMERS_DB_UPDATE
  =
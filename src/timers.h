@@ -24,6 +24,7 @@
 #include <time.h>
 
 #define TIMEOUT_SEC_DBUPDATE		1
+#define TIMEOUT_SEC_CONNECT		15
 #define TIMEOUT_SEC_CASTWAIT		5
 #define TIMEOUT_SEC_ROUND			5
 #define TIMEOUT_SEC_STATUS			1
@@ -70,6 +71,7 @@ void timers_init (void);
 void timers_cleanup (void);
 void timers_report (FILE *fp);
 void timers_update (void);
+gulong timers_next_timeout (void);
 
 _timer_t *timer_new(void);
 void timer_destroy(_timer_t *timer);
@@ -138,9 +138,8 @@ void update_display (void)
 
 void send_line (gchar *str)
 {
-	gchar *buf = g_strdup_printf ("%s\r\n", str);
-	putSockN (buf, strlen (buf));
-	g_free (buf);
+	putSockN (str, strlen (str));
+	putSockN ("\r\n", 2);
 }
 
 